@@ -0,0 +1,618 @@
+/**
+ * @file ads1263MODEL.c
+ * @brief SHRAVYA host build - ADS1263 register/command model behind ads1263_hal_t
+ * @note Models the register map, START/STOP/RESET, DRDY timing at the
+ *       programmed MODE2/ADC2CFG data rates on a virtual clock, PGA gain,
+ *       status byte new-data flags and INTERFACE checksum/CRC framing.
+ *       Conversion data comes from a pluggable ads1263_signal_source_t.
+ *       EEG_ADS1263_DEVICES independent chips share the virtual clock.
+ *       ADC1 has a per-device input offset that SFOCAL1 measures into OFCAL
+ *       (OFCAL/FSCAL are applied to every ADC1 code); ADC2MUX can select the
+ *       temperature sensor and AVDD monitor. IDAC1/IDAC2 and the MODE1 sensor
+ *       bias develop I x Z across the electrodes they drive; one electrode can
+ *       lift off mid-run, after which its input floats to the rail. Digital
+ *       filter latency, ADC2 calibration and TDAC are not modelled.
+ */
+#include "ads1263MODEL.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MODEL_VREF_VOLTS 2.5
+#define MODEL_ADC1_OFFSET_VOLTS 40e-6     // Device n input offset: (n + 1) x 40 µV
+#define MODEL_LIFTED_OHMS 10e6            // Electrode off the skin
+#define MODEL_FLOATING_VOLTS 3.0          // Where an input with no electrode drifts (past either ADC's full scale)
+
+/* MODE2 DR[3:0] data rates (datasheet Table 9-13) */
+static const double adc1_rates_sps[16] = {
+    2.5, 5.0, 10.0, 16.6, 20.0, 50.0, 60.0, 100.0,
+    400.0, 1200.0, 2400.0, 4800.0, 7200.0, 14400.0, 19200.0, 38400.0
+};
+
+/* ADC2CFG DR2[1:0] data rates */
+static const double adc2_rates_sps[4] = { 10.0, 100.0, 400.0, 800.0 };
+
+/* IDACMAG MAG1/MAG2 currents (datasheet Table 9-36), µA */
+static const double idac_currents_ua[16] = {
+    0.0, 50.0, 100.0, 250.0, 500.0, 750.0, 1000.0, 1500.0, 2000.0, 2500.0, 3000.0, 0.0, 0.0, 0.0, 0.0, 0.0
+};
+
+/* MODE1 SBMAG[2:0] sensor bias currents, µA (6 = 10 MOhm resistor, not modelled) */
+static const double bias_currents_ua[8] = { 0.0, 0.5, 2.0, 10.0, 50.0, 200.0, 0.0, 0.0 };
+
+/* Reset values of registers 0x00-0x1A */
+static const uint8_t register_defaults[ADS1263_REG_COUNT] = {
+    0x21, 0x11, 0x05, 0x00, 0x80, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xBB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40
+};
+
+typedef struct {
+    bool running;
+    uint64_t start_ns;        // Conversion k completes at start_ns + (k + 1) * period
+    int64_t last_read;        // Last conversion index returned by RDATA (-1 = none)
+} model_adc_t;
+
+typedef struct {
+    uint8_t regs[ADS1263_REG_COUNT];
+    model_adc_t adc1;
+    model_adc_t adc2;
+} model_device_t;
+
+/* EEG_ADS1263_DEVICES chips on one SPI bus; CS selects which one the HAL talks to */
+static struct {
+    ads1263_model_config_t config;
+    model_device_t device[EEG_ADS1263_DEVICES];
+    uint8_t selected;
+    uint64_t now_ns;
+    ads1263_model_stats_t stats;
+} model;
+
+#define SELECTED (&model.device[model.selected])
+
+static uint64_t model_period_ns(double sps)
+{
+    return (uint64_t) (1e9 / sps + 0.5);
+}
+
+double ads1263_model_adc1_rate_sps(void)
+{
+    return adc1_rates_sps[SELECTED->regs[ADS1263_REG_MODE2] & 0x0F];
+}
+
+double ads1263_model_adc2_rate_sps(void)
+{
+    return adc2_rates_sps[(SELECTED->regs[ADS1263_REG_ADC2CFG] >> 6) & 0x03];
+}
+
+/**
+ * @brief Nearest MODE2 DR code for a requested ADC1 rate
+ */
+uint8_t ads1263_model_adc1_rate_code(double sps)
+{
+    uint8_t best = 0;
+    for (uint8_t code = 1; code < 16; code++) {
+        if (fabs(adc1_rates_sps[code] - sps) < fabs(adc1_rates_sps[best] - sps)) best = code;
+    }
+    return best;
+}
+
+/**
+ * @brief Index of the latest completed conversion at the current time (-1 = none)
+ */
+static int64_t model_latest_conversion(const model_adc_t *adc, double sps)
+{
+    if (!adc->running || model.now_ns < adc->start_ns) return -1;
+    return (int64_t) ((model.now_ns - adc->start_ns) / model_period_ns(sps)) - 1;
+}
+
+static void model_adc_restart(model_adc_t *adc)
+{
+    adc->start_ns = model.now_ns;
+    adc->last_read = -1;
+}
+
+static uint8_t model_status_byte(void)
+{
+    uint8_t status = 0;
+    if (model_latest_conversion(&SELECTED->adc2, ads1263_model_adc2_rate_sps()) > SELECTED->adc2.last_read) {
+        status |= ADS1263_STATUS_ADC2_NEW;
+    }
+    if (model_latest_conversion(&SELECTED->adc1, ads1263_model_adc1_rate_sps()) > SELECTED->adc1.last_read) {
+        status |= ADS1263_STATUS_ADC1_NEW;
+    }
+    return status;
+}
+
+/**
+ * @brief True once the electrode at analog input @p pin of the selected device is off the skin
+ */
+static bool model_lifted(uint8_t pin, double t_s)
+{
+    return model.config.lift_at_s > 0.0 && t_s >= model.config.lift_at_s &&
+           model.selected == model.config.lift_device && pin == model.config.lift_pin;
+}
+
+/**
+ * @brief Electrode impedance at analog input @p pin of the selected device at @p t_s
+ */
+static double model_electrode_ohms(uint8_t pin, double t_s)
+{
+    return model_lifted(pin, t_s) ? MODEL_LIFTED_OHMS : model.config.electrode_kohms * 1e3;
+}
+
+/**
+ * @brief Voltage the IDACs develop across the electrodes of mux pair @p inpmux at @p t_s
+ */
+static double model_idac_volts(uint8_t inpmux, double t_s)
+{
+    const uint8_t *r = SELECTED->regs;
+    double volts = 0.0;
+
+    for (int idac = 0; idac < 2; idac++) {
+        uint8_t pin = (uint8_t) ((r[ADS1263_REG_IDACMUX] >> (4 * idac)) & 0x0F);
+        double amps = idac_currents_ua[(r[ADS1263_REG_IDACMAG] >> (4 * idac)) & 0x0F] * 1e-6;
+        if (amps <= 0.0 || pin > 9) continue;
+
+        double ohms = model_electrode_ohms(pin, t_s);
+        if (pin == (inpmux >> 4)) volts += amps * ohms;
+        if (pin == (inpmux & 0x0F)) volts -= amps * ohms;
+    }
+    return volts;
+}
+
+/**
+ * @brief Voltage the MODE1 sensor bias develops across the electrodes of mux pair @p inpmux
+ * @param adc2 true when @p inpmux is ADC2's pair (SBADC picks which ADC's pair is biased)
+ * @note Sources into AINP and sinks from AINN (SBPOL=0), so both electrodes add.
+ */
+static double model_bias_volts(bool adc2, uint8_t inpmux, double t_s)
+{
+    uint8_t mode1 = SELECTED->regs[ADS1263_REG_MODE1];
+    double amps = bias_currents_ua[mode1 & 0x07] * 1e-6;
+
+    if (amps <= 0.0 || ((mode1 & ADS1263_MODE1_SBADC2) != 0) != adc2) return 0.0;
+    return amps * (model_electrode_ohms((uint8_t) (inpmux >> 4), t_s) +
+                   model_electrode_ohms((uint8_t) (inpmux & 0x0F), t_s));
+}
+
+/**
+ * @brief ADC output code for conversion @p k of one ADC
+ * @param bits 32 for ADC1, 24 for ADC2
+ */
+static int32_t model_convert(const model_adc_t *adc, double sps, int64_t k, uint8_t inpmux,
+                             double gain, int bits)
+{
+    if (k < 0 || !model.config.source) return 0;
+
+    double t_s = (double) (adc->start_ns + (uint64_t) (k + 1) * model_period_ns(sps)) * 1e-9;
+    double volts;
+    if (inpmux == ADS1263_MUX_TEMPERATURE) {
+        volts = 0.1224 + 420e-6 * (model.config.temperature_c - 25.0);
+    } else if (inpmux == ADS1263_MUX_AVDD_MONITOR) {
+        volts = model.config.avdd_v / 4.0;
+    } else {
+        volts = model.config.source->sample_volts(model.config.source->context, model.selected, inpmux, t_s);
+        volts += model_idac_volts(inpmux, t_s) + model_bias_volts(bits == 24, inpmux, t_s);
+        if (model_lifted((uint8_t) (inpmux >> 4), t_s)) volts += MODEL_FLOATING_VOLTS;
+        if (model_lifted((uint8_t) (inpmux & 0x0F), t_s)) volts -= MODEL_FLOATING_VOLTS;
+    }
+    double full_scale = ldexp(1.0, bits - 1);
+    if (bits == 32) volts += MODEL_ADC1_OFFSET_VOLTS * (double) (model.selected + 1);
+    double code = floor(volts * gain / MODEL_VREF_VOLTS * full_scale + 0.5);
+
+    /* ADC1 calibration: (code - OFCAL << 8) * FSCAL / 0x400000 */
+    if (bits == 32) {
+        const uint8_t *r = SELECTED->regs;
+        int32_t ofcal = (int32_t) ((uint32_t) r[ADS1263_REG_OFCAL0 + 2] << 24 | (uint32_t) r[ADS1263_REG_OFCAL0 + 1] << 16 |
+                                   (uint32_t) r[ADS1263_REG_OFCAL0] << 8) >> 8;
+        uint32_t fscal = (uint32_t) r[ADS1263_REG_FSCAL0 + 2] << 16 | (uint32_t) r[ADS1263_REG_FSCAL0 + 1] << 8 |
+                         r[ADS1263_REG_FSCAL0];
+        code = (code - ldexp((double) ofcal, 8)) * (double) fscal / 4194304.0;
+    }
+
+    if (code > full_scale - 1.0 || code < -full_scale) {
+        if (bits == 32) model.stats.adc1_clipped++;
+        code = (code > 0.0) ? full_scale - 1.0 : -full_scale;
+    }
+    return (int32_t) (int64_t) code;
+}
+
+static uint8_t model_crc8(const uint8_t *data, uint32_t length)
+{
+    uint8_t crc = 0xFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (uint8_t) ((crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1));
+        }
+    }
+    return crc;
+}
+
+/* ==================== HAL implementation ==================== */
+
+static fsp_err_t model_open(void)
+{
+    return FSP_SUCCESS;
+}
+
+static void model_select_device(uint8_t device)
+{
+    if (device < EEG_ADS1263_DEVICES) model.selected = device;
+}
+
+/**
+ * @brief ADC1 input offset as a 24-bit OFCAL value at the current PGA gain
+ */
+static int32_t model_adc1_offset_ofcal(void)
+{
+    uint8_t mode2 = SELECTED->regs[ADS1263_REG_MODE2];
+    double gain = (mode2 & 0x80) ? 1.0 : (double) (1u << ((mode2 >> 4) & 0x07));
+    double code = MODEL_ADC1_OFFSET_VOLTS * (double) (model.selected + 1) * gain / MODEL_VREF_VOLTS * ldexp(1.0, 31);
+    return (int32_t) floor(code / 256.0 + 0.5);
+}
+
+static void model_write_register(uint8_t reg_addr, uint8_t data)
+{
+    if (reg_addr >= ADS1263_REG_COUNT || reg_addr == ADS1263_REG_ID) return;
+
+    SELECTED->regs[reg_addr] = data;
+    model.stats.register_writes++;
+
+    /* Writes to MODE0-INPMUX restart ADC1; ADC2CFG/ADC2MUX restart ADC2 */
+    if (reg_addr >= ADS1263_REG_MODE0 && reg_addr <= ADS1263_REG_INPMUX && SELECTED->adc1.running) {
+        model_adc_restart(&SELECTED->adc1);
+    }
+    if ((reg_addr == ADS1263_REG_ADC2CFG || reg_addr == ADS1263_REG_ADC2MUX) && SELECTED->adc2.running) {
+        model_adc_restart(&SELECTED->adc2);
+    }
+}
+
+static void model_write_registers(uint8_t start, const uint8_t *data, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        model_write_register((uint8_t) (start + i), data[i]);
+    }
+    model.stats.register_bursts++;
+}
+
+static uint8_t model_read_register(uint8_t reg_addr)
+{
+    if (reg_addr >= ADS1263_REG_COUNT) return 0x00;
+    return SELECTED->regs[reg_addr];
+}
+
+static void model_send_command(uint8_t opcode)
+{
+    /* START/STOP/RESET ignore bit 0; calibration opcodes (0x16-0x1F) are exact */
+    uint8_t op = (opcode >= 0x16 && opcode <= 0x1F) ? opcode : (uint8_t) (opcode & 0xFE);
+    switch (op) {
+        case ADS1263_OP_NOP:
+            break;
+        case ADS1263_OP_RESET:
+            memcpy(SELECTED->regs, register_defaults, sizeof(SELECTED->regs));
+            SELECTED->regs[ADS1263_REG_ID] = model.config.device_id;
+            SELECTED->adc1.running = false;
+            SELECTED->adc2.running = false;
+            break;
+        case ADS1263_OP_START1:
+            SELECTED->adc1.running = true;
+            model_adc_restart(&SELECTED->adc1);
+            break;
+        case ADS1263_OP_STOP1:
+            SELECTED->adc1.running = false;
+            break;
+        case ADS1263_OP_START2:
+            SELECTED->adc2.running = true;
+            model_adc_restart(&SELECTED->adc2);
+            break;
+        case ADS1263_OP_STOP2:
+            SELECTED->adc2.running = false;
+            break;
+        case ADS1263_OP_SFOCAL1: {
+            /* Inputs shorted internally: OFCAL takes the measured offset, conversion restarts */
+            int32_t ofcal = model_adc1_offset_ofcal();
+            SELECTED->regs[ADS1263_REG_OFCAL0] = (uint8_t) ofcal;
+            SELECTED->regs[ADS1263_REG_OFCAL0 + 1] = (uint8_t) (ofcal >> 8);
+            SELECTED->regs[ADS1263_REG_OFCAL0 + 2] = (uint8_t) (ofcal >> 16);
+            if (SELECTED->adc1.running) model_adc_restart(&SELECTED->adc1);
+            model.stats.calibrations++;
+            break;
+        }
+        case ADS1263_OP_SFOCAL2:
+            model.stats.calibrations++;
+            break;
+        default:
+            model.stats.unknown_opcodes++;
+            break;
+    }
+}
+
+static void model_read_data(uint8_t opcode, uint8_t *frame, uint32_t length)
+{
+    uint8_t bytes[ADS1263_RDATA_FRAME_BYTES];
+    uint8_t data[4];
+    uint32_t n = 0;
+    uint8_t status = model_status_byte();
+    uint8_t interface = SELECTED->regs[ADS1263_REG_INTERFACE];
+
+    if ((opcode & 0xFE) == ADS1263_OP_RDATA2) {
+        double sps = ads1263_model_adc2_rate_sps();
+        int64_t k = model_latest_conversion(&SELECTED->adc2, sps);
+        double gain = (double) (1u << (SELECTED->regs[ADS1263_REG_ADC2CFG] & 0x07));
+        int32_t code = model_convert(&SELECTED->adc2, sps, k, SELECTED->regs[ADS1263_REG_ADC2MUX], gain, 24);
+        data[0] = (uint8_t) (code >> 16);
+        data[1] = (uint8_t) (code >> 8);
+        data[2] = (uint8_t) code;
+        data[3] = 0x00;   // Pad byte
+        if (k > SELECTED->adc2.last_read) SELECTED->adc2.last_read = k;
+        if (k >= 0) model.stats.adc2_conversions = (uint64_t) k + 1;
+    } else {
+        double sps = ads1263_model_adc1_rate_sps();
+        int64_t k = model_latest_conversion(&SELECTED->adc1, sps);
+        uint8_t mode2 = SELECTED->regs[ADS1263_REG_MODE2];
+        double gain = (mode2 & 0x80) ? 1.0 : (double) (1u << ((mode2 >> 4) & 0x07));
+        int32_t code = model_convert(&SELECTED->adc1, sps, k, SELECTED->regs[ADS1263_REG_INPMUX], gain, 32);
+        data[0] = (uint8_t) ((uint32_t) code >> 24);
+        data[1] = (uint8_t) ((uint32_t) code >> 16);
+        data[2] = (uint8_t) ((uint32_t) code >> 8);
+        data[3] = (uint8_t) code;
+        if (k > SELECTED->adc1.last_read) SELECTED->adc1.last_read = k;
+        if (k >= 0) model.stats.adc1_conversions = (uint64_t) k + 1;
+    }
+
+    /* INTERFACE: bit 2 = STATUS byte, bits 1:0 = 01 checksum / 10 CRC-8 */
+    if (interface & 0x04) bytes[n++] = status;
+    memcpy(&bytes[n], data, sizeof(data));
+    n += sizeof(data);
+    if ((interface & 0x03) == 0x01) {
+        uint8_t sum = ADS1263_CHECKSUM_SEED;
+        for (uint32_t i = 0; i < sizeof(data); i++) sum = (uint8_t) (sum + data[i]);
+        bytes[n++] = sum;
+    } else if ((interface & 0x03) == 0x02) {
+        bytes[n++] = model_crc8(data, sizeof(data));
+    }
+
+    model.stats.frames_read++;
+    if (model.config.corrupt_one_in && (model.stats.frames_read % model.config.corrupt_one_in) == 0) {
+        bytes[n - 1] ^= 0x01;
+        model.stats.frames_corrupted++;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        frame[i] = (i < n) ? bytes[i] : 0x00;
+    }
+}
+
+/**
+ * @brief Advance the virtual clock to the next ADC1 DRDY falling edge
+ */
+static bool model_wait_drdy(uint32_t timeout_us)
+{
+    uint64_t timeout_ns = (uint64_t) timeout_us * 1000u;
+
+    if (SELECTED->adc1.running) {
+        uint64_t period = model_period_ns(ads1263_model_adc1_rate_sps());
+        int64_t next = model_latest_conversion(&SELECTED->adc1, ads1263_model_adc1_rate_sps()) + 1;
+        uint64_t edge_ns = SELECTED->adc1.start_ns + (uint64_t) (next + 1) * period;
+
+        if (edge_ns - model.now_ns <= timeout_ns) {
+            model.now_ns = edge_ns;
+            return true;
+        }
+    }
+
+    model.now_ns += timeout_ns;
+    return false;
+}
+
+static void model_delay_ms(uint32_t milliseconds)
+{
+    model.now_ns += (uint64_t) milliseconds * 1000000u;
+}
+
+static uint32_t model_timestamp_us(void)
+{
+    return (uint32_t) (model.now_ns / 1000u);
+}
+
+static const ads1263_hal_t model_hal = {
+    .name = "ADS1263 host model",
+    .open = model_open,
+    .select_device = model_select_device,
+    .write_register = model_write_register,
+    .write_registers = model_write_registers,
+    .read_register = model_read_register,
+    .send_command = model_send_command,
+    .read_data = model_read_data,
+    .wait_drdy = model_wait_drdy,
+    .delay_ms = model_delay_ms,
+    .timestamp_us = model_timestamp_us,
+};
+
+/**
+ * @brief Power-on the model: reset register map, virtual clock at zero
+ */
+void ads1263_model_init(const ads1263_model_config_t *config)
+{
+    memset(&model, 0, sizeof(model));
+    model.config = *config;
+    if (model.config.device_id == 0) model.config.device_id = register_defaults[ADS1263_REG_ID];
+    if (model.config.avdd_v <= 0.0) model.config.avdd_v = 5.0;
+    if (model.config.electrode_kohms <= 0.0) model.config.electrode_kohms = 5.0;
+    for (uint8_t d = 0; d < EEG_ADS1263_DEVICES; d++) {
+        memcpy(model.device[d].regs, register_defaults, sizeof(model.device[d].regs));
+        model.device[d].regs[ADS1263_REG_ID] = model.config.device_id;
+        model.device[d].adc1.last_read = -1;
+        model.device[d].adc2.last_read = -1;
+    }
+}
+
+const ads1263_hal_t *ads1263_model_hal(void)
+{
+    return &model_hal;
+}
+
+void ads1263_model_get_stats(ads1263_model_stats_t *stats)
+{
+    *stats = model.stats;
+}
+
+uint64_t ads1263_model_time_ns(void)
+{
+    return model.now_ns;
+}
+
+/* ==================== Signal sources ==================== */
+
+/**
+ * @brief Electrode pair index seen by a source: ADS1263_MAX_PAIRS per device, AIN0-1 = 0, AIN2-3 = 1, ...
+ */
+uint32_t ads1263_source_channel(uint8_t device, uint8_t inpmux)
+{
+    return (uint32_t) device * ADS1263_MAX_PAIRS + (uint32_t) (inpmux >> 4) / 2u;
+}
+
+typedef struct {
+    uint32_t rng;
+    double mains_hz;
+    double artifact_every_s;       // 0 = clean
+} synthetic_source_t;
+
+static synthetic_source_t synthetic_context;
+
+static float synthetic_uniform(synthetic_source_t *s)
+{
+    /* xorshift32 */
+    s->rng ^= s->rng << 13;
+    s->rng ^= s->rng >> 17;
+    s->rng ^= s->rng << 5;
+    return ((float) (s->rng >> 8) + 0.5f) / 16777216.0f;
+}
+
+/**
+ * @brief Alpha/theta/beta rhythms, mains pickup (with 2nd/3rd harmonics) and 2µV RMS white noise
+ */
+static double synthetic_sample_volts(void *context, uint8_t device, uint8_t inpmux, double t_s)
+{
+    synthetic_source_t *s = (synthetic_source_t *) context;
+    const double two_pi = 6.283185307179586;
+    uint32_t channel = ads1263_source_channel(device, inpmux);
+    double phase = 0.7 * (double) channel;
+
+    /* Alpha waxes and wanes over ~8s like eyes-closed rest */
+    double alpha_env = 0.6 + 0.4 * sin(two_pi * 0.125 * t_s);
+    double uv = 20.0 * alpha_env * sin(two_pi * 10.0 * t_s + phase)
+              + 10.0 * sin(two_pi * 6.0 * t_s + 2.0 * phase)
+              + 6.0 * sin(two_pi * 20.0 * t_s + 0.5 * phase)
+              + 15.0 * sin(two_pi * s->mains_hz * t_s)
+              + 3.0 * sin(two_pi * 2.0 * s->mains_hz * t_s + 0.3)
+              + 5.0 * sin(two_pi * 3.0 * s->mains_hz * t_s + 1.1);
+
+    float u1 = synthetic_uniform(s);
+    float u2 = synthetic_uniform(s);
+    uv += 2.0 * sqrt(-2.0 * log((double) u1)) * cos(two_pi * (double) u2);
+
+    /* Artifact bursts: blinks on every channel, alternating with an electrode pop on channel 0 */
+    if (s->artifact_every_s > 0.0) {
+        double burst = floor(t_s / s->artifact_every_s);
+        double into_s = t_s - burst * s->artifact_every_s;
+        if ((burst >= 1.0) && (fmod(burst, 2.0) > 0.5) && (into_s < 0.3)) {
+            uv += 250.0 * sin(two_pi * into_s / 0.6);
+        } else if ((burst >= 1.0) && (channel == 0U) && (into_s < 0.2)) {
+            uv += 400.0 * exp(-into_s / 0.03);
+        }
+    }
+
+    return uv * 1e-6;
+}
+
+const ads1263_signal_source_t *ads1263_source_synthetic(uint32_t seed, double mains_hz)
+{
+    static ads1263_signal_source_t source = { "synthetic", &synthetic_context, synthetic_sample_volts };
+
+    synthetic_context.rng = seed ? seed : 0x5EED1263u;
+    synthetic_context.mains_hz = mains_hz;
+    synthetic_context.artifact_every_s = 0.0;
+    return &source;
+}
+
+/**
+ * @brief Add an artifact burst to the synthetic source every @p every_s seconds (0 = none)
+ */
+void ads1263_source_synthetic_artifacts(double every_s)
+{
+    synthetic_context.artifact_every_s = every_s;
+}
+
+typedef struct {
+    float *values;            // Row-major microvolts
+    uint32_t rows;
+    uint32_t columns;
+    double rate_hz;
+} csv_source_t;
+
+/**
+ * @brief Replay a recording: one row per sample, one column per electrode pair (µV)
+ * @note Loops at end of file; electrode pair n (see ads1263_source_channel) reads column n % columns.
+ */
+static double csv_sample_volts(void *context, uint8_t device, uint8_t inpmux, double t_s)
+{
+    csv_source_t *c = (csv_source_t *) context;
+    uint32_t row = (uint32_t) ((uint64_t) (t_s * c->rate_hz) % c->rows);
+    uint32_t column = ads1263_source_channel(device, inpmux) % c->columns;
+    return (double) c->values[row * c->columns + column] * 1e-6;
+}
+
+const ads1263_signal_source_t *ads1263_source_csv(const char *path, double file_rate_hz)
+{
+    static csv_source_t context;
+    static ads1263_signal_source_t source = { "csv", &context, csv_sample_volts };
+    char line[1024];
+    uint32_t capacity = 0;
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "SHRAVYA: ❌ Cannot open %s\n", path);
+        return NULL;
+    }
+
+    free(context.values);
+    memset(&context, 0, sizeof(context));
+    context.rate_hz = file_rate_hz;
+
+    while (fgets(line, sizeof(line), f)) {
+        float row[16];
+        uint32_t n = 0;
+        char *p = line;
+        char *end;
+
+        while (n < 16) {
+            float v = strtof(p, &end);
+            if (end == p) break;
+            row[n++] = v;
+            p = end;
+            while (*p == ',' || *p == ' ' || *p == '\t') p++;
+        }
+        if (n == 0) continue;   // Header or blank line
+        if (context.columns == 0) context.columns = n;
+        if (n < context.columns) continue;
+
+        if (context.rows == capacity) {
+            capacity = capacity ? capacity * 2u : 4096u;
+            float *grown = realloc(context.values, (size_t) capacity * context.columns * sizeof(float));
+            if (!grown) break;
+            context.values = grown;
+        }
+        memcpy(&context.values[context.rows * context.columns], row, context.columns * sizeof(float));
+        context.rows++;
+    }
+    fclose(f);
+
+    if (context.rows == 0) {
+        fprintf(stderr, "SHRAVYA: ❌ No samples in %s\n", path);
+        return NULL;
+    }
+    return &source;
+}
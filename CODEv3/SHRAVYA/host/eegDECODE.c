@@ -0,0 +1,163 @@
+/**
+ * @file eegDECODE.c
+ * @brief Host decoder for raw recorder images - validate, order and unpack blocks
+ * @note Uses the firmware's own block codec (src/eegRECORD.c, src/eegCODEC.c), so the host
+ *       reads exactly the layout the recorder writes.
+ */
+#include "eegDECODE.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    size_t offset;
+    eeg_record_header_t header;
+} decode_entry_t;
+
+static int compare_sequence(const void *a, const void *b)
+{
+    uint32_t sa = ((const decode_entry_t *) a)->header.block_sequence;
+    uint32_t sb = ((const decode_entry_t *) b)->header.block_sequence;
+    return (sa > sb) - (sa < sb);
+}
+
+/**
+ * @brief Decode one session of an in-memory image
+ * @param session_id Session to decode, 0 = the one starting the image (newest on flash)
+ * @param on_sample Per-sample callback (may be NULL for a summary only)
+ * @return 0, or -1 when the image holds no valid block of the session
+ */
+int eeg_decode_image(const uint8_t *image, size_t length, uint32_t session_id,
+                     eeg_decode_sample_fn on_sample, void *context, eeg_decode_summary_t *summary)
+{
+    eeg_record_header_t header;
+    uint32_t block_bytes = 0;
+
+    memset(summary, 0, sizeof(*summary));
+
+    /* Block size from the first header found (blocks are at least 256-byte aligned) */
+    for (size_t offset = 0; offset + EEG_RECORD_HEADER_BYTES <= length; offset += 256U) {
+        if (FSP_SUCCESS == eeg_record_header_decode(image + offset, &header)) {
+            block_bytes = header.block_bytes;
+            break;
+        }
+    }
+    if (0U == block_bytes) return -1;
+
+    size_t slots = length / block_bytes;
+    decode_entry_t *entries = calloc(slots ? slots : 1, sizeof(*entries));
+    uint32_t *session_ids = calloc(slots ? slots : 1, sizeof(*session_ids));
+    uint32_t count = 0;
+    if (!entries || !session_ids) {
+        free(entries);
+        free(session_ids);
+        return -1;
+    }
+
+    for (size_t slot = 0; slot < slots; slot++) {
+        const uint8_t *block = image + slot * block_bytes;
+        fsp_err_t err = eeg_record_block_check(block, block_bytes, &header);
+        if (FSP_ERR_NOT_FOUND == err) continue;            // Erased or foreign data
+        if (FSP_SUCCESS != err || header.block_bytes != block_bytes) {
+            summary->bad_blocks++;
+            continue;
+        }
+
+        bool known = false;
+        for (uint32_t i = 0; i < summary->sessions; i++) known = known || (session_ids[i] == header.session_id);
+        if (!known) session_ids[summary->sessions++] = header.session_id;
+        if (0U == session_id) session_id = header.session_id;
+        if (header.session_id != session_id) continue;
+
+        entries[count].offset = slot * block_bytes;
+        entries[count].header = header;
+        count++;
+    }
+    free(session_ids);
+
+    if (0U == count) {
+        free(entries);
+        return -1;
+    }
+    qsort(entries, count, sizeof(*entries), compare_sequence);
+
+    summary->session_id = session_id;
+    summary->channel_count = entries[0].header.channel_count;
+    summary->first_rate_hz = entries[0].header.sample_rate_hz;
+
+    int32_t *values = NULL;
+    size_t values_capacity = 0;
+    for (uint32_t b = 0; b < count; b++) {
+        const eeg_record_header_t *h = &entries[b].header;
+        const uint8_t *block = image + entries[b].offset;
+        size_t needed = (size_t) h->sample_count * h->channel_count;
+
+        if (needed > values_capacity) {
+            int32_t *grown = realloc(values, needed * sizeof(*values));
+            if (!grown) break;
+            values = grown;
+            values_capacity = needed;
+        }
+
+        if (b > 0) {
+            const eeg_record_header_t *prev = &entries[b - 1].header;
+            uint32_t expected = prev->first_sample + prev->sample_count;
+            if (h->block_sequence != prev->block_sequence + 1U) summary->missing_blocks++;
+            if (h->first_sample != expected) {
+                summary->gaps++;
+                summary->gap_samples += h->first_sample - expected;
+            }
+            if (h->first_sequence != prev->first_sequence + prev->sample_count) summary->sequence_gaps++;
+            if (h->sample_rate_hz != prev->sample_rate_hz) summary->rate_changes++;
+        }
+
+        /* A frame error loses the whole block: report it as a gap of its samples */
+        if (FSP_SUCCESS != eeg_record_block_samples(block, h, values)) {
+            summary->bad_blocks++;
+            summary->gaps++;
+            summary->gap_samples += h->sample_count;
+            continue;
+        }
+
+        for (uint32_t i = 0; on_sample && i < h->sample_count; i++) {
+            uint32_t offset_us = (uint32_t) ((uint64_t) i * 1000000U / (h->sample_rate_hz ? h->sample_rate_hz : 1U));
+            on_sample(context, h, i, h->timestamp_us + offset_us, &values[(size_t) i * h->channel_count]);
+        }
+
+        summary->blocks++;
+        summary->samples += h->sample_count;
+        summary->payload_bytes += h->payload_bytes;
+        if (h->flags & EEG_RECORD_FLAG_CODED) summary->coded_blocks++;
+        summary->last_rate_hz = h->sample_rate_hz;
+        if (h->sample_rate_hz) summary->duration_s += (double) h->sample_count / (double) h->sample_rate_hz;
+    }
+
+    free(values);
+    free(entries);
+    return 0;
+}
+
+/**
+ * @brief Decode one session of an image file
+ * @return 0, or -1 when the file cannot be read or holds no valid block of the session
+ */
+int eeg_decode_file(const char *path, uint32_t session_id,
+                    eeg_decode_sample_fn on_sample, void *context, eeg_decode_summary_t *summary)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *image = (size > 0) ? malloc((size_t) size) : NULL;
+    size_t got = image ? fread(image, 1, (size_t) size, f) : 0;
+    fclose(f);
+
+    int result = -1;
+    if (image && got == (size_t) size) {
+        result = eeg_decode_image(image, got, session_id, on_sample, context, summary);
+    }
+    free(image);
+    return result;
+}
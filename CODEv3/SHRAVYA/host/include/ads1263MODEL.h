@@ -0,0 +1,59 @@
+#ifndef ADS1263_MODEL_H
+#define ADS1263_MODEL_H
+
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+
+/**
+ * @brief Pluggable analog front end for the model
+ * @note sample_volts() returns the differential input voltage seen by the
+ *       mux pair selected in INPMUX/ADC2MUX (MUXP in bits 7:4, MUXN in 3:0)
+ *       of ADS1263 @p device at time @p t_s. ads1263_source_channel() maps
+ *       that to an electrode pair index.
+ */
+typedef struct st_ads1263_signal_source {
+    const char *name;
+    void *context;
+    double (*sample_volts)(void *context, uint8_t device, uint8_t inpmux, double t_s);
+} ads1263_signal_source_t;
+
+typedef struct {
+    const ads1263_signal_source_t *source;
+    uint32_t corrupt_one_in;       // Flip a checksum every N frames (0 = never)
+    uint8_t device_id;             // ID register (DEV_ID=001 -> ADS1263)
+    double temperature_c;          // Die temperature at the ADC2MUX temperature sensor (°C)
+    double avdd_v;                 // AVDD seen by the ADC2MUX monitor (0 = 5.0 V)
+    double electrode_kohms;        // Contact impedance of every electrode, seen by the IDACs and sensor bias (0 = 5 kΩ)
+    uint8_t lift_device;           // Electrode that comes off the skin: ADS1263 index ...
+    uint8_t lift_pin;              // ... and AIN pin
+    double lift_at_s;              // Time the electrode lifts (0 = never)
+} ads1263_model_config_t;
+
+typedef struct {
+    uint64_t adc1_conversions;
+    uint64_t adc2_conversions;
+    uint64_t frames_read;
+    uint64_t frames_corrupted;
+    uint64_t adc1_clipped;
+    uint32_t unknown_opcodes;
+    uint32_t register_writes;
+    uint32_t register_bursts;      // WREG bursts (profile restores)
+    uint32_t calibrations;         // SFOCAL1/SFOCAL2 commands
+} ads1263_model_stats_t;
+
+/* Device model */
+void ads1263_model_init(const ads1263_model_config_t *config);
+const ads1263_hal_t *ads1263_model_hal(void);
+void ads1263_model_get_stats(ads1263_model_stats_t *stats);
+uint64_t ads1263_model_time_ns(void);
+double ads1263_model_adc1_rate_sps(void);
+double ads1263_model_adc2_rate_sps(void);
+uint8_t ads1263_model_adc1_rate_code(double sps);
+
+/* Signal sources */
+uint32_t ads1263_source_channel(uint8_t device, uint8_t inpmux);
+const ads1263_signal_source_t *ads1263_source_synthetic(uint32_t seed, double mains_hz);
+void ads1263_source_synthetic_artifacts(double every_s);
+const ads1263_signal_source_t *ads1263_source_csv(const char *path, double file_rate_hz);
+
+#endif /* ADS1263_MODEL_H */
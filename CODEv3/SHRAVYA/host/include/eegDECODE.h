@@ -0,0 +1,47 @@
+#ifndef EEG_DECODE_H
+#define EEG_DECODE_H
+
+#include "eegRECORD.h"
+
+/**
+ * @file eegDECODE.h
+ * @brief Host decoder for raw recorder images (eegRECORD.h blocks)
+ * @note An image is the recorder region as read back from OSPI flash, or the
+ *       file the host runner records to with -o. Blocks of one session are
+ *       put back in order by block_sequence, so images that wrapped decode
+ *       from their oldest surviving block.
+ */
+
+typedef struct {
+    uint32_t session_id;
+    uint32_t sessions;              // Sessions with at least one valid block in the image
+    uint32_t blocks;                // Valid blocks of the decoded session
+    uint32_t bad_blocks;            // Blocks with a valid magic but a failing CRC/field/frame check
+    uint32_t missing_blocks;        // block_sequence steps other than 1
+    uint32_t samples;               // Samples delivered
+    uint32_t coded_blocks;          // Blocks with an eegCODEC payload
+    uint64_t payload_bytes;         // Payload bytes of the decoded blocks (ratio vs 24-bit packing)
+    uint32_t gaps;                  // Ring-index discontinuities between consecutive blocks
+    uint32_t gap_samples;           // Samples missing across those discontinuities
+    uint32_t sequence_gaps;         // Acquisition sequence discontinuities at block starts
+    uint32_t rate_changes;
+    uint32_t first_rate_hz;
+    uint32_t last_rate_hz;
+    uint8_t channel_count;
+    double duration_s;              // Sum of sample_count / rate over the decoded blocks
+} eeg_decode_summary_t;
+
+/**
+ * @brief Called once per decoded sample, in recording order
+ * @param values channel_count raw counts (ADC1 rescaled to 32-bit, ADC2 24-bit)
+ * @param timestamp_us Block timestamp plus the sample's nominal offset
+ */
+typedef void (*eeg_decode_sample_fn)(void *context, const eeg_record_header_t *header, uint32_t sample,
+                                     uint32_t timestamp_us, const int32_t *values);
+
+int eeg_decode_image(const uint8_t *image, size_t length, uint32_t session_id,
+                     eeg_decode_sample_fn on_sample, void *context, eeg_decode_summary_t *summary);
+int eeg_decode_file(const char *path, uint32_t session_id,
+                    eeg_decode_sample_fn on_sample, void *context, eeg_decode_summary_t *summary);
+
+#endif /* EEG_DECODE_H */
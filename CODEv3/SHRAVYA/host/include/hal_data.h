@@ -0,0 +1,44 @@
+#ifndef HAL_DATA_H
+#define HAL_DATA_H
+
+/**
+ * @file hal_data.h
+ * @brief Linux host stand-in for the FSP-generated ra_gen/hal_data.h
+ * @note Only what the portable sources (ads1263HAL.c, signalPROCESSING.c, eegRECORDER.c,
+ *       cognitiveCLASSIFIER.c) use. Error codes keep their FSP values.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef enum e_fsp_err
+{
+    FSP_SUCCESS = 0,
+
+    FSP_ERR_ASSERTION             = 1,
+    FSP_ERR_INVALID_POINTER       = 2,
+    FSP_ERR_INVALID_ARGUMENT      = 3,
+    FSP_ERR_NOT_OPEN              = 7,
+    FSP_ERR_IN_USE                = 8,
+    FSP_ERR_OVERFLOW              = 12,
+    FSP_ERR_UNSUPPORTED           = 13,
+    FSP_ERR_TIMEOUT               = 20,
+    FSP_ERR_INVALID_SIZE          = 23,
+    FSP_ERR_WRITE_FAILED          = 24,
+    FSP_ERR_INVALID_HW_CONDITION  = 27,
+    FSP_ERR_INVALID_STATE         = 30,
+    FSP_ERR_NOT_INITIALIZED       = 33,
+    FSP_ERR_NOT_FOUND             = 34,
+    FSP_ERR_BUFFER_EMPTY          = 36,
+    FSP_ERR_INVALID_DATA          = 37,
+    FSP_ERR_INSUFFICIENT_SPACE    = 205,
+    FSP_ERR_INSUFFICIENT_DATA     = 206,
+    FSP_ERR_HARDWARE_TIMEOUT      = 410,
+} fsp_err_t;
+
+/* Clock query used by the task loops for timing prints */
+#define FSP_PRIV_CLOCK_ICLK 0
+uint32_t R_FSP_SystemClockHzGet(int clock);
+
+#endif /* HAL_DATA_H */
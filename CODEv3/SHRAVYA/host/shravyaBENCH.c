@@ -0,0 +1,985 @@
+/**
+ * @file shravyaBENCH.c
+ * @brief SHRAVYA DSP kernel benchmarks on Linux - speed and accuracy against reference models
+ * @note Kernels run on the synthetic EEG source of the ADS1263 model (or a CSV
+ *       recording), in µV, at the chain's sample rate. Timings are host
+ *       nanoseconds: compare kernels with each other, not with the RA8D1.
+ */
+#include "hal_data.h"
+#include "ads1263MODEL.h"
+#include "signalPROCESSING.h"
+#include "eegBIQUAD.h"
+#include "eegMAINS.h"
+#include "eegDECIMATE.h"
+#include "eegWAVELET.h"
+#include "eegMEDIAN.h"
+#include "cognitiveSTATES.h"
+#include "eegRATE.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MIN_SECONDS 0.25      // Each kernel repeats until it has run this long
+#define BENCH_DC_OFFSET_UV 300.0    // Electrode offset added to the source (the highpass removes it)
+#define BENCH_SETTLE_SECONDS 5      // Mains residuals are measured after filters and canceller settle
+#define BENCH_MAINS_REJECTION_DB 40.0   // Canceller must take every tracked harmonic down at least this far
+#define BENCH_ALIAS_REJECTION_DB 60.0   // Decimator must keep tones folding onto 10-45 Hz at least this far down
+#define BENCH_DECIMATE_SNR_DB 100.0     // ... and match its double-precision direct-form FIR this closely
+#define BENCH_WAVELET_SNR_DB 100.0      // Forward + inverse DWT must give the window back this closely
+#define BENCH_WAVELET_DENOISE_DB 3.0    // Denoising must lift a tone out of white noise at least this far
+#define BENCH_WAVELET_TONE_UV 10.0      // ... a 10 Hz tone of this amplitude
+#define BENCH_WAVELET_NOISE_UV 3.0      // ... in white noise of this RMS
+#define BENCH_BLINK_UV 250.0            // Baseline bench: blink-sized pulse ...
+#define BENCH_BLINK_SECONDS 0.3         // ... this long, once a second
+
+static double wall_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/* ==================== Reference models ==================== */
+
+/** The per-sample Direct Form I section the conditioning chain used before eegBIQUAD */
+typedef struct {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} df1_section_t;
+
+/** Same section in double precision - the accuracy reference */
+typedef struct {
+    double b0, b1, b2, a1, a2;
+    double x1, x2, y1, y2;
+} df1_double_section_t;
+
+static void df1_load(const eeg_biquad_cascade_t *cascade, df1_section_t *f, df1_double_section_t *d)
+{
+    for (uint32_t s = 0; s < cascade->stages; s++) {
+        const float *k = &cascade->coeffs[s * 5U];
+        memset(&f[s], 0, sizeof(f[s]));
+        memset(&d[s], 0, sizeof(d[s]));
+        f[s].b0 = k[0]; f[s].b1 = k[1]; f[s].b2 = k[2]; f[s].a1 = -k[3]; f[s].a2 = -k[4];
+        d[s].b0 = k[0]; d[s].b1 = k[1]; d[s].b2 = k[2]; d[s].a1 = -k[3]; d[s].a2 = -k[4];
+    }
+}
+
+static float df1_sample(df1_section_t *f, uint32_t stages, float x)
+{
+    for (uint32_t s = 0; s < stages; s++) {
+        float y = f[s].b0 * x + f[s].b1 * f[s].x1 + f[s].b2 * f[s].x2 - f[s].a1 * f[s].y1 - f[s].a2 * f[s].y2;
+        f[s].x2 = f[s].x1;
+        f[s].x1 = x;
+        f[s].y2 = f[s].y1;
+        f[s].y1 = y;
+        x = y;
+    }
+    return x;
+}
+
+static double df1_double_sample(df1_double_section_t *d, uint32_t stages, double x)
+{
+    for (uint32_t s = 0; s < stages; s++) {
+        double y = d[s].b0 * x + d[s].b1 * d[s].x1 + d[s].b2 * d[s].x2 - d[s].a1 * d[s].y1 - d[s].a2 * d[s].y2;
+        d[s].x2 = d[s].x1;
+        d[s].x1 = x;
+        d[s].y2 = d[s].y1;
+        d[s].y1 = y;
+        x = y;
+    }
+    return x;
+}
+
+/**
+ * @brief Q31 cascade written out per sample with 128-bit products - must match eeg_biquad_q31_process bit for bit
+ */
+static float q31_reference_sample(const eeg_biquad_q31_t *q, int32_t x1s[], int64_t y1s[], int32_t x)
+{
+    const int64_t limit = INT64_MAX >> (q->shift + 1U);
+
+    for (uint32_t s = 0; s < q->stages; s++) {
+        const int32_t *k = &q->coeffs[s * 5U];
+        int32_t *xs = &x1s[s * 2U];
+        int64_t *ys = &y1s[s * 2U];
+        __int128 acc = (__int128) k[0] * x + (__int128) k[1] * xs[0] + (__int128) k[2] * xs[1] +
+                       (((__int128) k[3] * ys[0]) >> 32) + (((__int128) k[4] * ys[1]) >> 32);
+        if (acc > limit) acc = limit;
+        if (acc < -limit) acc = -limit;
+        int64_t y = (int64_t) (acc * ((__int128) 1 << (q->shift + 1U)));
+        xs[1] = xs[0];
+        xs[0] = x;
+        ys[1] = ys[0];
+        ys[0] = y;
+        __int128 rounded = ((__int128) y + ((__int128) 1 << 31)) >> 32;
+        x = (rounded > INT32_MAX) ? INT32_MAX : (int32_t) rounded;
+    }
+    return (float) x * (q->output_scale / 2147483648.0f);
+}
+
+/** Signal-to-noise ratio (dB) of @p a against @p reference */
+static double snr_db(const float *a, const double *reference, uint32_t count)
+{
+    double signal = 0.0, noise = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double e = (double) a[i] - reference[i];
+        signal += reference[i] * reference[i];
+        noise += e * e;
+    }
+    return (noise > 0.0) ? 10.0 * log10(signal / noise) : INFINITY;
+}
+
+/** Largest |a - b| and the RMS of @p reference */
+static double max_error(const float *a, const double *reference, uint32_t count, double *rms)
+{
+    double worst = 0.0;
+    double power = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double e = fabs((double) a[i] - reference[i]);
+        if (e > worst) worst = e;
+        power += reference[i] * reference[i];
+    }
+    if (rms) *rms = sqrt(power / (double) count);
+    return worst;
+}
+
+/** Amplitude of the tone at @p hz in x[0], x[stride], ... (Goertzel, whole seconds so the bin is exact) */
+static double tone_amplitude(const float *x, uint32_t stride, uint32_t count, double hz, double rate_hz)
+{
+    double coeff = 2.0 * cos(2.0 * 3.14159265358979323846 * hz / rate_hz);
+    double s1 = 0.0, s2 = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double s0 = (double) x[(size_t) i * stride] + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    return 2.0 * sqrt(fmax(s1 * s1 + s2 * s2 - coeff * s1 * s2, 0.0)) / (double) count;
+}
+
+/* ==================== Biquad cascade ==================== */
+
+/** The same cascade in Direct Form II Transposed (arm_biquad_cascade_df2T_f32 form), for comparison */
+static void df2t_block(const eeg_biquad_cascade_t *design, float state[][2], const float *input, float *output,
+                       uint32_t count)
+{
+    const float *in = input;
+    for (uint32_t s = 0; s < design->stages; s++) {
+        const float *k = &design->coeffs[s * 5U];
+        float d1 = state[s][0], d2 = state[s][1];
+        for (uint32_t i = 0; i < count; i++) {
+            float x = in[i];
+            float y = k[0] * x + d1;
+            d1 = k[1] * x + k[3] * y + d2;
+            d2 = k[2] * x + k[4] * y;
+            output[i] = y;
+        }
+        state[s][0] = d1;
+        state[s][1] = d2;
+        in = output;
+    }
+}
+
+/**
+ * @brief Conditioning cascade: per-sample DF1 (previous path) against the eegBIQUAD block kernel
+ * @return 0 when block and per-sample outputs agree within float tolerance at any block length
+ */
+static int bench_biquad(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    eeg_biquad_cascade_t design;
+    df1_section_t df1[EEG_BIQUAD_MAX_STAGES];
+    df1_double_section_t reference[EEG_BIQUAD_MAX_STAGES];
+    float df2t_state[EEG_BIQUAD_MAX_STAGES][2];
+    float *out_df1 = malloc(count * sizeof(float));
+    float *out_block = malloc(count * sizeof(float));
+    float *out_single = malloc(count * sizeof(float));
+    float *out_df2t = malloc(count * sizeof(float));
+    double *out_double = malloc(count * sizeof(double));
+    double t_df1 = 0.0, t_single = 0.0, t_block = 0.0, t_df2t = 0.0;
+    uint32_t passes = 0;
+
+    if (!out_df1 || !out_block || !out_single || !out_df2t || !out_double) return -1;
+
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    signal_processing_design_filters(&design, rate_hz, EEG_MAINS_HZ);
+
+    df1_load(&design, df1, reference);
+    for (uint32_t i = 0; i < count; i++) out_double[i] = df1_double_sample(reference, design.stages, input[i]);
+
+    while ((passes < 3U) || (t_block < BENCH_MIN_SECONDS)) {
+        eeg_biquad_cascade_t cascade = design;
+        double t0 = wall_seconds();
+        df1_load(&design, df1, reference);
+        for (uint32_t i = 0; i < count; i++) out_df1[i] = df1_sample(df1, design.stages, input[i]);
+        t_df1 += wall_seconds() - t0;
+
+        t0 = wall_seconds();
+        eeg_biquad_reset(&cascade);
+        for (uint32_t i = 0; i < count; i++) eeg_biquad_process(&cascade, &input[i], &out_single[i], 1U);
+        t_single += wall_seconds() - t0;
+
+        t0 = wall_seconds();
+        eeg_biquad_reset(&cascade);
+        for (uint32_t i = 0; i < count; i += block) {
+            eeg_biquad_process(&cascade, &input[i], &out_block[i], (count - i < block) ? count - i : block);
+        }
+        t_block += wall_seconds() - t0;
+
+        t0 = wall_seconds();
+        memset(df2t_state, 0, sizeof(df2t_state));
+        for (uint32_t i = 0; i < count; i += block) {
+            df2t_block(&design, df2t_state, &input[i], &out_df2t[i], (count - i < block) ? count - i : block);
+        }
+        t_df2t += wall_seconds() - t0;
+        passes++;
+    }
+
+    double rms = 0.0;
+    double err_df1 = max_error(out_df1, out_double, count, &rms);
+    double err_block = max_error(out_block, out_double, count, NULL);
+    double err_df2t = max_error(out_df2t, out_double, count, NULL);
+    double diff = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double d = fabs((double) out_block[i] - (double) out_df1[i]);
+        if (d > diff) diff = d;
+    }
+    bool same_blocking = (0 == memcmp(out_single, out_block, count * sizeof(float)));
+    double ns_df1 = t_df1 * 1e9 / ((double) passes * count);
+    double ns_single = t_single * 1e9 / ((double) passes * count);
+    double ns_block = t_block * 1e9 / ((double) passes * count);
+    double ns_df2t = t_df2t * 1e9 / ((double) passes * count);
+
+    printf("SHRAVYA: 🎛️ Biquad cascade: %lu sections, %u SPS, %u samples, %u passes (%s kernel)\n",
+           (unsigned long) design.stages, rate_hz, count, passes, EEG_BIQUAD_CMSIS_DSP ? "CMSIS-DSP" : "scalar");
+    printf("SHRAVYA:    per-sample DF1 (previous path)  %7.2f ns/sample, max error %.2e µV\n", ns_df1, err_df1);
+    printf("SHRAVYA:    block DF1, 1-sample calls       %7.2f ns/sample\n", ns_single);
+    printf("SHRAVYA:    block DF1, %3u-sample blocks     %7.2f ns/sample, max error %.2e µV (%.2fx the per-sample path)\n",
+           block, ns_block, err_block, ns_df1 / ns_block);
+    printf("SHRAVYA:    block DF2T, %3u-sample blocks    %7.2f ns/sample, max error %.2e µV\n", block, ns_df2t, err_df2t);
+    printf("SHRAVYA:    errors vs a double-precision DF1 (signal %.1f µV RMS); block - per-sample max %.2e µV, "
+           "block length %s\n", rms, diff, same_blocking ? "bit-exact" : "CHANGES OUTPUT");
+
+    free(out_df1);
+    free(out_block);
+    free(out_single);
+    free(out_df2t);
+    free(out_double);
+
+    /* Float tolerance: the block kernel may differ from the per-sample path only by rounding */
+    return (same_blocking && (diff <= 1e-5 * (rms + BENCH_DC_OFFSET_UV))) ? 0 : -1;
+}
+
+/**
+ * @brief Q31 cascade on raw ADC1 counts against the float cascade, both against a double model
+ * @return 0 when the Q31 kernel matches its 128-bit reference bit for bit at any block length
+ */
+static int bench_q31(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    /* ADC1 codes at the montage gain: Q31 of ±VREF/gain */
+    const double count_uv = ADS1263_VREF_UV / (double) (1U << ADS1263_ADC1_GAIN_CODE) / 2147483648.0;
+    eeg_biquad_cascade_t design;
+    eeg_biquad_q31_t q31;
+    df1_section_t df1[EEG_BIQUAD_MAX_STAGES];
+    df1_double_section_t reference[EEG_BIQUAD_MAX_STAGES];
+    int32_t x_ref[EEG_BIQUAD_MAX_STAGES * 2];
+    int64_t y_ref[EEG_BIQUAD_MAX_STAGES * 2];
+    int32_t *counts = malloc(count * sizeof(int32_t));
+    int32_t *work = malloc(count * sizeof(int32_t));
+    float *quantised = malloc(count * sizeof(float));
+    float *out_float = malloc(count * sizeof(float));
+    float *out_q31 = malloc(count * sizeof(float));
+    float *out_single = malloc(count * sizeof(float));
+    float *out_ref = malloc(count * sizeof(float));
+    double *out_double = malloc(count * sizeof(double));
+    double t_float = 0.0, t_q31 = 0.0;
+    uint32_t passes = 0;
+
+    if (!counts || !work || !quantised || !out_float || !out_q31 || !out_single || !out_ref || !out_double) return -1;
+
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    signal_processing_design_filters(&design, rate_hz, EEG_MAINS_HZ);
+    eeg_biquad_q31_init(&q31);
+    eeg_biquad_q31_load(&q31, &design, (float) (count_uv * 2147483648.0));
+
+    /* Both paths and the model see the same converted codes */
+    for (uint32_t i = 0; i < count; i++) {
+        counts[i] = (int32_t) lrint((double) input[i] / count_uv);
+        quantised[i] = (float) (counts[i] * count_uv);
+    }
+    df1_load(&design, df1, reference);
+    for (uint32_t i = 0; i < count; i++) {
+        out_double[i] = df1_double_sample(reference, design.stages, (double) counts[i] * count_uv);
+    }
+
+    while ((passes < 3U) || (t_q31 < BENCH_MIN_SECONDS)) {
+        eeg_biquad_cascade_t cascade = design;
+        double t0 = wall_seconds();
+        eeg_biquad_reset(&cascade);
+        for (uint32_t i = 0; i < count; i += block) {
+            eeg_biquad_process(&cascade, &quantised[i], &out_float[i], (count - i < block) ? count - i : block);
+        }
+        t_float += wall_seconds() - t0;
+
+        memcpy(work, counts, count * sizeof(int32_t));
+        t0 = wall_seconds();
+        eeg_biquad_q31_reset(&q31);
+        for (uint32_t i = 0; i < count; i += block) {
+            eeg_biquad_q31_process(&q31, &work[i], &out_q31[i], (count - i < block) ? count - i : block);
+        }
+        t_q31 += wall_seconds() - t0;
+        passes++;
+    }
+
+    memcpy(work, counts, count * sizeof(int32_t));
+    eeg_biquad_q31_reset(&q31);
+    for (uint32_t i = 0; i < count; i++) eeg_biquad_q31_process(&q31, &work[i], &out_single[i], 1U);
+    memset(x_ref, 0, sizeof(x_ref));
+    memset(y_ref, 0, sizeof(y_ref));
+    for (uint32_t i = 0; i < count; i++) out_ref[i] = q31_reference_sample(&q31, x_ref, y_ref, counts[i]);
+
+    bool exact = (0 == memcmp(out_q31, out_ref, count * sizeof(float)));
+    bool same_blocking = (0 == memcmp(out_q31, out_single, count * sizeof(float)));
+    double ns_float = t_float * 1e9 / ((double) passes * count);
+    double ns_q31 = t_q31 * 1e9 / ((double) passes * count);
+
+    printf("SHRAVYA: 🎛️ Q31 cascade on ADC1 counts (%.3f nV/count), Q%lu coefficients, %u-sample blocks\n",
+           count_uv * 1e3, (unsigned long) (31U - q31.shift), block);
+    printf("SHRAVYA:    float DF1  %7.2f ns/sample, max error %.2e µV, SNR %.1f dB\n",
+           ns_float, max_error(out_float, out_double, count, NULL), snr_db(out_float, out_double, count));
+    printf("SHRAVYA:    Q31 32x64  %7.2f ns/sample, max error %.2e µV, SNR %.1f dB\n",
+           ns_q31, max_error(out_q31, out_double, count, NULL), snr_db(out_q31, out_double, count));
+    printf("SHRAVYA:    Q31 vs 128-bit reference %s, block length %s\n",
+           exact ? "bit-exact" : "DIFFERS", same_blocking ? "bit-exact" : "CHANGES OUTPUT");
+
+    free(counts);
+    free(work);
+    free(quantised);
+    free(out_float);
+    free(out_q31);
+    free(out_single);
+    free(out_ref);
+    free(out_double);
+    return (exact && same_blocking) ? 0 : -1;
+}
+
+/**
+ * @brief Multichannel filtering: one cascade per channel in turn against lane banks in lockstep
+ * @return 0 when every lane matches its channel filtered alone, bit for bit
+ */
+static int bench_lanes(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    static const uint32_t channel_counts[] = {1, 2, 4, 8, 16};
+    enum { MAX_CHANNELS = 16 };
+    eeg_biquad_cascade_t design;
+    int status = 0;
+
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    signal_processing_design_filters(&design, rate_hz, EEG_MAINS_HZ);
+
+    printf("SHRAVYA: 🎛️ Multichannel cascade: %lu sections, %u SPS, %u-sample blocks - ns per frame (all channels)\n",
+           (unsigned long) design.stages, rate_hz, block);
+
+    for (uint32_t n = 0; n < sizeof(channel_counts) / sizeof(channel_counts[0]); n++) {
+        const uint32_t channels = channel_counts[n];
+        const uint32_t lanes = EEG_BIQUAD_LANES_FOR(channels);
+        const uint32_t groups = (channels + lanes - 1U) / lanes;
+        eeg_biquad_cascade_t serial[MAX_CHANNELS];
+        eeg_biquad_lanes_t bank[MAX_CHANNELS / 2];
+        float *planar = malloc((size_t) channels * count * sizeof(float));
+        float *out_serial = malloc((size_t) channels * count * sizeof(float));
+        float *frames = calloc((size_t) groups * lanes * count, sizeof(float));
+        float *out_lanes = malloc((size_t) groups * lanes * count * sizeof(float));
+        double t_serial = 0.0, t_lanes = 0.0;
+        uint32_t passes = 0;
+
+        if (!planar || !out_serial || !frames || !out_lanes) return -1;
+
+        /* Each channel sees the source from a different starting point */
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            for (uint32_t i = 0; i < count; i++) {
+                float x = input[(i + ch * (count / MAX_CHANNELS)) % count];
+                planar[ch * count + i] = x;
+                frames[((ch / lanes) * count + i) * lanes + ch % lanes] = x;
+            }
+        }
+
+        while ((passes < 3U) || (t_lanes < BENCH_MIN_SECONDS)) {
+            double t0 = wall_seconds();
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                serial[ch] = design;
+                eeg_biquad_reset(&serial[ch]);
+            }
+            for (uint32_t i = 0; i < count; i += block) {
+                uint32_t len = (count - i < block) ? count - i : block;
+                for (uint32_t ch = 0; ch < channels; ch++) {
+                    eeg_biquad_process(&serial[ch], &planar[ch * count + i], &out_serial[ch * count + i], len);
+                }
+            }
+            t_serial += wall_seconds() - t0;
+
+            t0 = wall_seconds();
+            for (uint32_t g = 0; g < groups; g++) {
+                eeg_biquad_lanes_init(&bank[g], design.stages, lanes);
+                eeg_biquad_lanes_load(&bank[g], &design);
+            }
+            for (uint32_t i = 0; i < count; i += block) {
+                uint32_t len = (count - i < block) ? count - i : block;
+                for (uint32_t g = 0; g < groups; g++) {
+                    const size_t at = ((size_t) g * count + i) * lanes;
+                    eeg_biquad_lanes_process(&bank[g], &frames[at], &out_lanes[at], len);
+                }
+            }
+            t_lanes += wall_seconds() - t0;
+            passes++;
+        }
+
+        bool exact = true;
+        for (uint32_t ch = 0; ch < channels && exact; ch++) {
+            for (uint32_t i = 0; i < count; i++) {
+                if (0 != memcmp(&out_lanes[((ch / lanes) * count + i) * lanes + ch % lanes], &out_serial[ch * count + i],
+                           sizeof(float))) {
+                    exact = false;
+                    break;
+                }
+            }
+        }
+        double ns_serial = t_serial * 1e9 / ((double) passes * count);
+        double ns_lanes = t_lanes * 1e9 / ((double) passes * count);
+        printf("SHRAVYA:    %2u channel(s): per channel %7.2f, %u x %u-lane bank %7.2f (%.2fx) - lanes %s\n",
+               channels, ns_serial, groups, lanes, ns_lanes, ns_serial / ns_lanes,
+               exact ? "bit-exact" : "DIFFER FROM SERIAL");
+        if (!exact) status = -1;
+
+        free(planar);
+        free(out_serial);
+        free(frames);
+        free(out_lanes);
+    }
+    return status;
+}
+
+/* ==================== Mains ==================== */
+
+/**
+ * @brief Mains rejection: the band-stop cascade against highpass/lowpass plus the adaptive canceller
+ * @return 0 when the canceller takes every harmonic it tracks down by BENCH_MAINS_REJECTION_DB
+ * @note The band-stop only covers the fundamental; covering harmonics the same
+ *       way would take another band-stop (two sections) per harmonic.
+ * @note EEG_CHANNELS channels through lane banks, as in process_eeg_block();
+ *       the canceller runs on the de-interleaved output like the pipeline.
+ */
+static int bench_mains(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    static float planar[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES];
+    eeg_biquad_cascade_t notched, plain;
+    eeg_biquad_lanes_t bank[EEG_FILTER_GROUPS];
+    eeg_mains_canceller_t canceller;
+    const size_t frame_floats = (size_t) EEG_FILTER_GROUPS * EEG_FILTER_LANES;
+    float *frames = calloc(frame_floats * count, sizeof(float));
+    float *out_notched = malloc(frame_floats * count * sizeof(float));
+    float *out_cancelled = malloc(frame_floats * count * sizeof(float));
+    double t_notched = 0.0, t_cancelled = 0.0;
+    uint32_t passes = 0;
+    int status = 0;
+
+    if (block > EEG_FILTER_BLOCK_SAMPLES) block = EEG_FILTER_BLOCK_SAMPLES;
+    if (!frames || !out_notched || !out_cancelled) return -1;
+    eeg_biquad_init(&notched, EEG_FILTER_STAGES);
+    eeg_biquad_init(&plain, EEG_FILTER_STAGES);
+    signal_processing_design_filters(&notched, rate_hz, EEG_MAINS_HZ);
+    signal_processing_design_filters(&plain, rate_hz, 0);
+
+    for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) {
+        for (uint32_t i = 0; i < count; i++) {
+            frames[((ch / EEG_FILTER_LANES) * count + i) * EEG_FILTER_LANES + ch % EEG_FILTER_LANES] =
+                input[(i + ch * (count / EEG_CHANNELS)) % count];
+        }
+    }
+
+    while ((passes < 3U) || (t_cancelled < BENCH_MIN_SECONDS)) {
+        double t0 = wall_seconds();
+        for (uint32_t g = 0; g < EEG_FILTER_GROUPS; g++) {
+            eeg_biquad_lanes_init(&bank[g], notched.stages, EEG_FILTER_LANES);
+            eeg_biquad_lanes_load(&bank[g], &notched);
+        }
+        for (uint32_t i = 0; i < count; i += block) {
+            uint32_t len = (count - i < block) ? count - i : block;
+            for (uint32_t g = 0; g < EEG_FILTER_GROUPS; g++) {
+                const size_t at = ((size_t) g * count + i) * EEG_FILTER_LANES;
+                eeg_biquad_lanes_process(&bank[g], &frames[at], &out_notched[at], len);
+            }
+        }
+        t_notched += wall_seconds() - t0;
+
+        t0 = wall_seconds();
+        for (uint32_t g = 0; g < EEG_FILTER_GROUPS; g++) {
+            eeg_biquad_lanes_init(&bank[g], plain.stages, EEG_FILTER_LANES);
+            eeg_biquad_lanes_load(&bank[g], &plain);
+        }
+        eeg_mains_canceller_init(&canceller, EEG_MAINS_HZ, rate_hz);
+        for (uint32_t i = 0; i < count; i += block) {
+            uint32_t len = (count - i < block) ? count - i : block;
+            for (uint32_t g = 0; g < EEG_FILTER_GROUPS; g++) {
+                const size_t at = ((size_t) g * count + i) * EEG_FILTER_LANES;
+                eeg_biquad_lanes_process(&bank[g], &frames[at], &out_cancelled[at], len);
+            }
+            for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) {
+                float *lane = &out_cancelled[((ch / EEG_FILTER_LANES) * count + i) * EEG_FILTER_LANES + ch % EEG_FILTER_LANES];
+                for (uint32_t j = 0; j < len; j++) planar[ch][j] = lane[j * EEG_FILTER_LANES];
+            }
+            eeg_mains_cancel(&canceller, planar, EEG_CHANNELS, len);
+            for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) {
+                float *lane = &out_cancelled[((ch / EEG_FILTER_LANES) * count + i) * EEG_FILTER_LANES + ch % EEG_FILTER_LANES];
+                for (uint32_t j = 0; j < len; j++) lane[j * EEG_FILTER_LANES] = planar[ch][j];
+            }
+        }
+        t_cancelled += wall_seconds() - t0;
+        passes++;
+    }
+
+    printf("SHRAVYA: ⚡ Mains %u Hz, %u SPS, %u channel(s): %lu-section band-stop cascade against %lu sections + "
+           "canceller (%lu harmonic(s), %.1f Hz wide)\n", (unsigned) EEG_MAINS_HZ, rate_hz, (unsigned) EEG_CHANNELS,
+           (unsigned long) notched.stages, (unsigned long) plain.stages, (unsigned long) canceller.harmonics,
+           (double) EEG_MAINS_BANDWIDTH_HZ);
+    printf("SHRAVYA:    band-stop %7.2f ns/frame, canceller %7.2f ns/frame (incl. de-interleave)\n",
+           t_notched * 1e9 / ((double) passes * count), t_cancelled * 1e9 / ((double) passes * count));
+
+    /* Channel 0 after settling, whole seconds */
+    uint32_t skip = BENCH_SETTLE_SECONDS * rate_hz;
+    uint32_t span = (count > skip) ? ((count - skip) / rate_hz) * rate_hz : 0U;
+    if (0U == span) {
+        printf("SHRAVYA:    residuals need more than %u s of input\n", BENCH_SETTLE_SECONDS);
+    }
+    for (uint32_t h = 1; (h <= EEG_MAINS_HARMONICS) && (span > 0U); h++) {
+        double hz = (double) (h * EEG_MAINS_HZ);
+        double alias = fabs(hz - rate_hz * floor(hz / rate_hz + 0.5));
+        bool tracked = false;
+        for (uint32_t k = 0; k < canceller.harmonics; k++) {
+            tracked |= fabs(canceller.alias_hz[k] - alias) < 0.5;
+        }
+        if (!tracked) {
+            printf("SHRAVYA:    %4.0f Hz (at %5.1f Hz): at DC/Nyquist or on a lower harmonic, not tracked\n", hz, alias);
+            continue;
+        }
+        double in = tone_amplitude(&frames[(size_t) skip * EEG_FILTER_LANES], EEG_FILTER_LANES, span, alias, rate_hz);
+        double a = tone_amplitude(&out_notched[(size_t) skip * EEG_FILTER_LANES], EEG_FILTER_LANES, span, alias, rate_hz);
+        double b = tone_amplitude(&out_cancelled[(size_t) skip * EEG_FILTER_LANES], EEG_FILTER_LANES, span, alias, rate_hz);
+        printf("SHRAVYA:    %4.0f Hz (at %5.1f Hz): input %7.3f µV, band-stop %9.5f µV (%6.1f dB), canceller %9.5f µV (%6.1f dB)\n",
+               hz, alias, in, a, 20.0 * log10(a / in + 1e-12), b, 20.0 * log10(b / in + 1e-12));
+        if (20.0 * log10(b / in) > -BENCH_MAINS_REJECTION_DB) status = -1;
+    }
+
+    free(frames);
+    free(out_notched);
+    free(out_cancelled);
+    return status;
+}
+
+/* ==================== Polyphase decimator ==================== */
+
+/** Decimate channel 0 of @p x (the same on every channel) into @p y, returning the outputs */
+static uint32_t decimate_signal(eeg_decimator_t *decimator, uint32_t factor, const float *x, uint32_t count,
+                                uint32_t block, float *y)
+{
+    static float planar[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES];
+    uint32_t n = 0;
+
+    eeg_decimator_init(decimator, factor);
+    for (uint32_t i = 0; i < count; i += block) {
+        uint32_t len = (count - i < block) ? count - i : block;
+        for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) memcpy(planar[ch], &x[i], len * sizeof(float));
+        uint32_t kept = eeg_decimate(decimator, planar, planar, EEG_CHANNELS, len);
+        memcpy(&y[n], planar[0], kept * sizeof(float));
+        n += kept;
+    }
+    return n;
+}
+
+/**
+ * @brief Polyphase decimator to the window rate against a double-precision direct-form FIR
+ * @return 0 when it matches the reference and aliases onto the EEG band stay BENCH_ALIAS_REJECTION_DB down
+ */
+static int bench_decimate(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    static eeg_decimator_t decimator;
+    eeg_rate_t rate = { 0 };
+    double t_decimate = 0.0;
+    uint32_t passes = 0;
+    int status = 0;
+
+    if (block > EEG_FILTER_BLOCK_SAMPLES) block = EEG_FILTER_BLOCK_SAMPLES;
+    for (uint32_t depth = 1; (depth <= ADS1263_MAX_PAIRS) && (rate.sample_rate_hz != rate_hz); depth++) {
+        eeg_rate_describe(rate_hz, depth, false, &rate);
+    }
+    if ((rate.sample_rate_hz != rate_hz) || (rate.decimation < 2U)) {
+        printf("SHRAVYA: ⬇️ Decimator: %u SPS is not decimated (EEG_DECIMATED_RATE_HZ %u)\n",
+               rate_hz, (unsigned) EEG_DECIMATED_RATE_HZ);
+        return 0;
+    }
+
+    const uint32_t factor = rate.decimation;
+    const uint32_t out_rate = rate.window_rate_hz;
+    const uint32_t taps = factor * EEG_DECIMATE_TAPS_PER_PHASE;
+    float *out = malloc((count / factor + 1U) * sizeof(float));
+    float *tone = malloc(count * sizeof(float));
+    double *reference = malloc((count / factor + 1U) * sizeof(double));
+    if (!out || !tone || !reference) return -1;
+
+    uint32_t n = 0;
+    while ((passes < 3U) || (t_decimate < BENCH_MIN_SECONDS)) {
+        double t0 = wall_seconds();
+        n = decimate_signal(&decimator, factor, input, count, block, out);
+        t_decimate += wall_seconds() - t0;
+        passes++;
+    }
+
+    /* Output m sits on input m * M + M - 1 */
+    for (uint32_t m = 0; m < n; m++) {
+        double acc = 0.0;
+        for (uint32_t k = 0; k < taps; k++) {
+            int64_t i = (int64_t) m * factor + factor - 1 - k;
+            if (i >= 0) acc += (double) decimator.coeff[k % factor][k / factor] * (double) input[i];
+        }
+        reference[m] = acc;
+    }
+    double snr = snr_db(out, reference, n);
+
+    printf("SHRAVYA: ⬇️ Decimator: %u SPS /%lu to %lu Hz, %lu taps in %lu phases, %u channel(s)\n", rate_hz,
+           (unsigned long) factor, (unsigned long) out_rate, (unsigned long) taps, (unsigned long) factor,
+           (unsigned) EEG_CHANNELS);
+    printf("SHRAVYA:    %7.2f ns/frame (incl. copy), %.1f dB SNR against a double-precision direct-form FIR\n",
+           t_decimate * 1e9 / ((double) passes * count), snr);
+    if (snr < BENCH_DECIMATE_SNR_DB) status = -1;
+
+    /* Unit tones, measured over whole seconds of output after the first */
+    const double tones_hz[] = { 10.0, 45.0, (double) out_rate - 45.0, (double) out_rate - 10.0 };
+    uint32_t span = (n > out_rate) ? ((n - out_rate) / out_rate) * out_rate : 0U;
+    for (uint32_t t = 0; (t < sizeof(tones_hz) / sizeof(tones_hz[0])) && (span > 0U); t++) {
+        double hz = tones_hz[t];
+        double alias = fabs(hz - out_rate * floor(hz / out_rate + 0.5));
+        for (uint32_t i = 0; i < count; i++) tone[i] = (float) sin(2.0 * 3.14159265358979323846 * hz * i / rate_hz);
+        decimate_signal(&decimator, factor, tone, count, block, out);
+        double db = 20.0 * log10(tone_amplitude(&out[out_rate], 1, span, alias, out_rate) + 1e-12);
+        bool folded = (fabs(alias - hz) > 1e-9);
+        printf("SHRAVYA:    %5.1f Hz %s %4.1f Hz: %7.2f dB\n", hz, folded ? "folds onto" : "passes at", alias, db);
+        if (folded ? (db > -BENCH_ALIAS_REJECTION_DB) : (fabs(db) > 0.1)) status = -1;
+    }
+    if (0U == span) printf("SHRAVYA:    alias rejection needs more than 1 s of input\n");
+
+    free(out);
+    free(tone);
+    free(reference);
+    return status;
+}
+
+/**
+ * @brief Wavelet stage per window (eegWAVELET.c) against the classifier's DFT feature path
+ * @return 0 when the transform gives the window back and denoising lifts a tone out of noise
+ * @note Both run on whole windows of the input conditioned as the chain
+ *       does it (cascade with the mains band-stop, then the decimator), after
+ *       BENCH_SETTLE_SECONDS.
+ */
+static int bench_wavelet(const float *input, uint32_t count, uint32_t rate_hz, uint32_t block)
+{
+    static const float bands_hz[5][2] = { { 0.5f, 4.0f }, { 4.0f, 8.0f }, { 8.0f, 13.0f }, { 13.0f, 30.0f },
+                                          { 30.0f, 45.0f } };   // The classifier's bands
+    static const char *const band_names[5] = { "delta", "theta", "alpha", "beta", "gamma" };
+    static eeg_decimator_t decimator;
+    static float window[EEG_WINDOW_MAX_SAMPLES];
+    static double original[EEG_WINDOW_MAX_SAMPLES];
+    static float clean[EEG_WINDOW_MAX_SAMPLES];
+    eeg_rate_t rate = { 0 };
+    eeg_wavelet_plan_t plan;
+    float energy[EEG_WAVELET_MAX_LEVELS + 1];
+    float wavelet_power[5];
+    double wavelet_sum[5] = { 0.0 }, dft_sum[5] = { 0.0 };
+    double t_wavelet = 0.0, t_dft = 0.0;
+    uint32_t passes = 0, windows = 0;
+    int status = 0;
+
+    if (block > EEG_FILTER_BLOCK_SAMPLES) block = EEG_FILTER_BLOCK_SAMPLES;
+    for (uint32_t depth = 1; (depth <= ADS1263_MAX_PAIRS) && (rate.sample_rate_hz != rate_hz); depth++) {
+        eeg_rate_describe(rate_hz, depth, false, &rate);
+    }
+    /* The classifier's DFT takes its bin spacing from the chain's rate */
+    if ((rate.sample_rate_hz != rate_hz) || (FSP_SUCCESS != signal_processing_set_rate(&rate)) ||
+        (FSP_SUCCESS != eeg_wavelet_plan(&plan, rate.window_samples, rate.window_rate_hz))) {
+        printf("SHRAVYA: 🌊 Wavelet: no window plan at %u SPS\n", rate_hz);
+        return 0;
+    }
+
+    const uint32_t n = rate.window_samples;
+    const double window_rate_hz = (double) rate.window_rate_hz;
+    const uint32_t settle = BENCH_SETTLE_SECONDS * rate.window_rate_hz;
+    float *conditioned = malloc(count * sizeof(float));
+    float *windows_in = malloc((count / rate.decimation + 1U) * sizeof(float));
+    if (!conditioned || !windows_in) return -1;
+
+    eeg_biquad_cascade_t design;
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    signal_processing_design_filters(&design, rate_hz, EEG_MAINS_HZ);
+    for (uint32_t i = 0; i < count; i += block) {
+        eeg_biquad_process(&design, &input[i], &conditioned[i], (count - i < block) ? count - i : block);
+    }
+    uint32_t total = (rate.decimation > 1U)
+                   ? decimate_signal(&decimator, rate.decimation, conditioned, count, block, windows_in)
+                   : (memcpy(windows_in, conditioned, count * sizeof(float)), count);
+    const uint32_t available = (total > settle) ? (total - settle) / n : 0U;
+    const float *y = &windows_in[settle];
+    free(conditioned);
+    if (0U == available) {
+        printf("SHRAVYA: 🌊 Wavelet: needs a %u-sample window of input after %d s\n", (unsigned) n,
+               BENCH_SETTLE_SECONDS);
+        free(windows_in);
+        return 0;
+    }
+
+    /* Cost per window: denoise + level energies + band shares, against the DFT feature extraction */
+    while ((passes < 3U) || (t_wavelet < BENCH_MIN_SECONDS) || (t_dft < BENCH_MIN_SECONDS)) {
+        for (uint32_t w = 0; w < available; w++) {
+            const float *x = &y[w * n];
+            double t0 = wall_seconds();
+            memcpy(window, x, n * sizeof(float));
+            (void) eeg_wavelet_process(&plan, window, energy, true);
+            eeg_wavelet_band_power(&plan, energy, bands_hz, 5, wavelet_power);
+            double t1 = wall_seconds();
+            extract_frequency_features(&x, 1, (int) n);
+            t_dft += wall_seconds() - t1;
+            t_wavelet += t1 - t0;
+
+            if (0U == passes) {
+                /* Bands compared on the same samples, without thresholding */
+                memcpy(window, x, n * sizeof(float));
+                (void) eeg_wavelet_process(&plan, window, energy, false);
+                eeg_wavelet_band_power(&plan, energy, bands_hz, 5, wavelet_power);
+                const float dft_power[5] = { current_features.delta_power, current_features.theta_power,
+                                             current_features.alpha_power, current_features.beta_power,
+                                             current_features.gamma_power };
+                for (int b = 0; b < 5; b++) {
+                    wavelet_sum[b] += wavelet_power[b];
+                    dft_sum[b] += dft_power[b];
+                }
+            }
+        }
+        passes++;
+    }
+    windows = passes * available;
+
+    printf("SHRAVYA: 🌊 Wavelet: CDF 9/7 lifting, %u-sample windows at %.0f Hz, %lu levels (approximation < %.2f Hz)\n",
+           (unsigned) n, window_rate_hz, (unsigned long) plan.levels, window_rate_hz / (double) (2U << plan.levels));
+    printf("SHRAVYA:    %9.2f ns/window denoise + band energies, %9.2f ns/window DFT features (%.1fx)\n",
+           t_wavelet * 1e9 / windows, t_dft * 1e9 / windows, t_dft / t_wavelet);
+    for (int b = 0; b < 5; b++) {
+        printf("SHRAVYA:    %-5s  DFT %9.4f  wavelet %9.4f\n", band_names[b], dft_sum[b] / available,
+               wavelet_sum[b] / available);
+    }
+
+    /* Perfect reconstruction: forward + inverse without thresholding */
+    for (uint32_t i = 0; i < n; i++) original[i] = y[i];
+    memcpy(window, y, n * sizeof(float));
+    eeg_wavelet_forward(&plan, window);
+    eeg_wavelet_inverse(&plan, window);
+    double snr = snr_db(window, original, n);
+    printf("SHRAVYA:    %.1f dB SNR forward + inverse\n", snr);
+    if (snr < BENCH_WAVELET_SNR_DB) status = -1;
+
+    /* Denoising: a tone in white noise, over every window's worth of noise */
+    double noisy_db = 0.0, denoised_db = 0.0;
+    srand(1);
+    for (uint32_t w = 0; w < available; w++) {
+        double noise_power = 0.0, residual_power = 0.0, tone_power = 0.0;
+        for (uint32_t i = 0; i < n; i++) {
+            double u1 = (rand() + 1.0) / ((double) RAND_MAX + 2.0);
+            double u2 = (rand() + 1.0) / ((double) RAND_MAX + 2.0);
+            double noise = BENCH_WAVELET_NOISE_UV * sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979323846 * u2);
+            clean[i] = (float) (BENCH_WAVELET_TONE_UV *
+                                sin(2.0 * 3.14159265358979323846 * 10.0 * (w * n + i) / window_rate_hz));
+            window[i] = clean[i] + (float) noise;
+            noise_power += noise * noise;
+            tone_power += (double) clean[i] * clean[i];
+        }
+        (void) eeg_wavelet_process(&plan, window, energy, true);
+        for (uint32_t i = 0; i < n; i++) {
+            double e = (double) window[i] - clean[i];
+            residual_power += e * e;
+        }
+        noisy_db += 10.0 * log10(tone_power / noise_power);
+        denoised_db += 10.0 * log10(tone_power / (residual_power + 1e-30));
+    }
+    noisy_db /= available;
+    denoised_db /= available;
+    printf("SHRAVYA:    10 Hz tone in white noise: %.1f dB SNR in, %.1f dB denoised\n", noisy_db, denoised_db);
+    if (denoised_db - noisy_db < BENCH_WAVELET_DENOISE_DB) status = -1;
+
+    free(windows_in);
+    return status;
+}
+
+static int compare_floats(const void *a, const void *b)
+{
+    float x = *(const float *) a;
+    float y = *(const float *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Running-median baseline (eegMEDIAN.c) against a sorted window and the one-pole it replaced
+ * @return 0 when every update matches the median of a sorted copy of the window
+ */
+static int bench_median(const float *input, uint32_t count, uint32_t rate_hz)
+{
+    static eeg_median_tracker_t tracker;
+    static float sorted[EEG_MEDIAN_MAX_WINDOW];
+    uint32_t decimation = rate_hz / EEG_BASELINE_UPDATE_HZ;
+    if (0U == decimation) decimation = 1U;
+    uint32_t window = (uint32_t) (EEG_BASELINE_WINDOW_S * (float) rate_hz / (float) decimation + 0.5);
+    if (window > EEG_MEDIAN_MAX_WINDOW) window = EEG_MEDIAN_MAX_WINDOW;
+    const float alpha = 1.0f / (EEG_BASELINE_WINDOW_S * (float) rate_hz);  // One-pole, same time span
+    double t_every = 0.0, t_decimated = 0.0, t_pole = 0.0;
+    uint32_t passes = 0, mismatches = 0;
+    volatile float sink = 0.0f;
+    int status = 0;
+
+    /* Exact against a sorted copy of the window at every update, all percentiles the chain could ask for */
+    const float percentiles[] = { 0.5f, 0.0f, 0.1f, 0.9f, 1.0f };
+    for (uint32_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+        uint32_t checked = (count < 20U * window) ? count : 20U * window;
+        (void) eeg_median_init(&tracker, window, percentiles[p], 1U);
+        for (uint32_t i = 0; i < checked; i++) {
+            (void) eeg_median_push(&tracker, input[i]);
+            uint32_t held = (i + 1U < window) ? i + 1U : window;
+            memcpy(sorted, &input[i + 1U - held], held * sizeof(float));
+            qsort(sorted, held, sizeof(float), compare_floats);
+            uint32_t k = (uint32_t) (percentiles[p] * (float) (held - 1U));
+            float median = eeg_median_value(&tracker);
+            mismatches += (0 != memcmp(&median, &sorted[k], sizeof(float)));
+        }
+    }
+    if (0U != mismatches) status = -1;
+
+    while ((passes < 3U) || (t_decimated < BENCH_MIN_SECONDS)) {
+        double t0 = wall_seconds();
+        (void) eeg_median_init(&tracker, window, 0.5f, 1U);
+        for (uint32_t i = 0; i < count; i++) {
+            (void) eeg_median_push(&tracker, input[i]);
+            sink += eeg_median_value(&tracker);
+        }
+        double t1 = wall_seconds();
+        (void) eeg_median_init(&tracker, window, 0.5f, decimation);
+        for (uint32_t i = 0; i < count; i++) {
+            (void) eeg_median_push(&tracker, input[i]);
+            sink += eeg_median_value(&tracker);
+        }
+        double t2 = wall_seconds();
+        float pole = 0.0f;
+        for (uint32_t i = 0; i < count; i++) {
+            pole += alpha * (input[i] - pole);
+            sink += pole;
+        }
+        t_pole += wall_seconds() - t2;
+        t_decimated += t2 - t1;
+        t_every += t1 - t0;
+        passes++;
+    }
+
+    /* Where each baseline goes under blink-sized pulses on the input, once both have settled */
+    const uint32_t period = rate_hz;
+    const uint32_t pulse = (uint32_t) (BENCH_BLINK_SECONDS * rate_hz);
+    const uint32_t settle = BENCH_SETTLE_SECONDS * rate_hz;
+    float pole = 0.0f, worst_median = 0.0f, worst_pole = 0.0f;
+    (void) eeg_median_init(&tracker, window, 0.5f, decimation);
+    for (uint32_t i = 0; i < count; i++) {
+        float x = input[i] + (((i % period) < pulse) ? (float) BENCH_BLINK_UV : 0.0f);
+        (void) eeg_median_push(&tracker, x);
+        pole += alpha * (x - pole);
+        if (i >= settle) {
+            float reference = (float) BENCH_DC_OFFSET_UV;
+            worst_median = fmaxf(worst_median, fabsf(eeg_median_value(&tracker) - reference));
+            worst_pole = fmaxf(worst_pole, fabsf(pole - reference));
+        }
+    }
+
+    printf("SHRAVYA: 📏 Baseline median: %lu-input window (%.1f s), one input in %lu at %u SPS\n",
+           (unsigned long) window, EEG_BASELINE_WINDOW_S, (unsigned long) decimation, rate_hz);
+    printf("SHRAVYA:    %7.2f ns/sample taking every input, %7.2f ns/sample decimated, %7.2f ns/sample one-pole\n",
+           t_every * 1e9 / ((double) passes * count), t_decimated * 1e9 / ((double) passes * count),
+           t_pole * 1e9 / ((double) passes * count));
+    printf("SHRAVYA:    %lu mismatches against a sorted window (5 percentiles)\n", (unsigned long) mismatches);
+    if (0U != count / period) {
+        printf("SHRAVYA:    %.0f µV %.1f s pulses every second: baseline off by up to %.1f µV (median), %.1f µV (one-pole)\n",
+               BENCH_BLINK_UV, BENCH_BLINK_SECONDS, worst_median, worst_pole);
+    }
+    (void) sink;
+    return status;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-r sps] [-t seconds] [-b block] [-f file.csv -R file_rate_hz]\n"
+            "  -r  sample rate of the chain under test (a rate with a filter table, default 2400)\n"
+            "  -t  seconds of input (default 60)\n"
+            "  -b  samples per block call (default %d)\n"
+            "  -f  CSV recording (µV, one column per electrode pair) instead of synthetic EEG\n"
+            "  -R  sample rate of the CSV recording (default %d)\n",
+            argv0, EEG_FILTER_BLOCK_SAMPLES, EEG_SAMPLE_RATE_HZ);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t rate_hz = 2400;
+    double seconds = 60.0;
+    uint32_t block = EEG_FILTER_BLOCK_SAMPLES;
+    const char *csv_path = NULL;
+    double csv_rate_hz = EEG_SAMPLE_RATE_HZ;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:t:b:f:R:h")) != -1) {
+        switch (opt) {
+            case 'r': rate_hz = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 't': seconds = atof(optarg); break;
+            case 'b': block = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'f': csv_path = optarg; break;
+            case 'R': csv_rate_hz = atof(optarg); break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+    uint32_t count = (uint32_t) (seconds * rate_hz);
+    if ((0U == rate_hz) || (0U == block) || (0U == count)) {
+        usage(argv[0]);
+        return 2;
+    }
+    eeg_biquad_cascade_t design;
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    if (FSP_SUCCESS != signal_processing_design_filters(&design, rate_hz, EEG_MAINS_HZ)) {
+        fprintf(stderr, "SHRAVYA: ❌ No conditioning filter table for %u SPS\n", rate_hz);
+        return 2;
+    }
+
+    const ads1263_signal_source_t *source = csv_path ? ads1263_source_csv(csv_path, csv_rate_hz)
+                                                     : ads1263_source_synthetic(0, EEG_MAINS_HZ);
+    if (!source) return 1;
+
+    /* Electrode pair 0 (AIN0-AIN1) in µV, on top of an electrode offset */
+    float *input = malloc(count * sizeof(float));
+    if (!input) return 1;
+    for (uint32_t i = 0; i < count; i++) {
+        input[i] = (float) (source->sample_volts(source->context, 0, 0x01, (double) i / rate_hz) * 1e6 +
+                            BENCH_DC_OFFSET_UV);
+    }
+
+    int status = 0;
+    if (0 != bench_biquad(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_lanes(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_q31(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_mains(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_decimate(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_wavelet(input, count, rate_hz, block)) status = 3;
+    if (0 != bench_median(input, count, rate_hz)) status = 3;
+
+    free(input);
+    return status;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file shravyaDECODE.c
+ * @brief SHRAVYA recorder image decoder - summary, CSV export and codec benchmark on Linux
+ * @note Reads an OSPI recorder region dump or a host runner -o file.
+ */
+#include "eegDECODE.h"
+#include "eegCODEC.h"
+#include "shravyaCONFIG.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    FILE *csv;
+    uint64_t index;
+    int32_t *samples;               // Benchmark: every sample, 24-bit as the codec sees it
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t rate_hz;
+} decode_context_t;
+
+static void on_decoded_sample(void *context, const eeg_record_header_t *header, uint32_t sample,
+                              uint32_t timestamp_us, const int32_t *values)
+{
+    decode_context_t *ctx = (decode_context_t *) context;
+    (void) sample;
+
+    if (ctx->csv) {
+        fprintf(ctx->csv, "%llu,%u,%u", (unsigned long long) ctx->index++, timestamp_us, header->sample_rate_hz);
+        for (uint32_t ch = 0; ch < header->channel_count; ch++) {
+            fprintf(ctx->csv, ",%d", values[ch]);
+        }
+        fprintf(ctx->csv, "\n");
+    }
+
+    if (ctx->capacity > 0U) {
+        if (ctx->count == ctx->capacity) {
+            int32_t *grown = realloc(ctx->samples, (size_t) ctx->capacity * 2U * header->channel_count * sizeof(int32_t));
+            if (!grown) return;
+            ctx->samples = grown;
+            ctx->capacity *= 2U;
+        }
+        int32_t *out = &ctx->samples[(size_t) ctx->count++ * header->channel_count];
+        for (uint32_t ch = 0; ch < header->channel_count; ch++) {
+            out[ch] = (1U == header->channel_map[ch][1]) ? values[ch] >> 8 : values[ch];
+        }
+        ctx->rate_hz = header->sample_rate_hz;
+    }
+}
+
+static double wall_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Code the decoded session in frames, as the recorder does, and time both directions
+ * @return 0 when every frame decoded back bit-exact
+ */
+static int benchmark_codec(const decode_context_t *ctx, uint32_t channels, uint32_t frame)
+{
+    const uint32_t bound = EEG_CODEC_FRAME_BOUND(channels, frame);
+    const uint32_t frames = (ctx->count + frame - 1U) / frame;
+    uint8_t *coded = malloc((size_t) frames * bound);
+    uint32_t *frame_bytes = malloc((size_t) frames * sizeof(uint32_t));
+    int32_t *decoded = malloc((size_t) ctx->count * channels * sizeof(int32_t));
+    eeg_codec_state_t state;
+    uint64_t coded_total = 0;
+    double encode_s = 0.0;
+    double decode_s = 0.0;
+    uint32_t passes = 0;
+
+    if (!coded || !frame_bytes || !decoded || (0U == ctx->count)) {
+        free(coded);
+        free(frame_bytes);
+        free(decoded);
+        return -1;
+    }
+
+    /* Repeat until each direction has run for a measurable time */
+    while ((passes < 3U) || (encode_s < 0.5)) {
+        const int32_t *channel[EEG_CODEC_MAX_CHANNELS];
+        double t0 = wall_seconds();
+        eeg_codec_reset(&state, (uint8_t) channels);
+        coded_total = 0;
+        for (uint32_t f = 0; f < frames; f++) {
+            uint32_t first = f * frame;
+            uint32_t n = (ctx->count - first < frame) ? ctx->count - first : frame;
+            for (uint32_t ch = 0; ch < channels; ch++) channel[ch] = &ctx->samples[(size_t) first * channels + ch];
+            frame_bytes[f] = eeg_codec_encode(&state, channel, channels, n, coded + (size_t) f * bound, bound);
+            coded_total += frame_bytes[f];
+        }
+        encode_s += wall_seconds() - t0;
+
+        t0 = wall_seconds();
+        eeg_codec_reset(&state, (uint8_t) channels);
+        for (uint32_t f = 0, done = 0; f < frames; f++) {
+            uint32_t n = 0;
+            eeg_codec_decode(&state, coded + (size_t) f * bound, frame_bytes[f],
+                             &decoded[(size_t) done * channels], ctx->count - done, &n);
+            done += n;
+        }
+        decode_s += wall_seconds() - t0;
+        passes++;
+    }
+
+    bool exact = (0 == memcmp(decoded, ctx->samples, (size_t) ctx->count * channels * sizeof(int32_t)));
+    double raw_bytes = (double) ctx->count * channels * EEG_RECORD_SAMPLE_BYTES;
+    double encode_ns = encode_s * 1e9 / ((double) passes * ctx->count);
+    double decode_ns = decode_s * 1e9 / ((double) passes * ctx->count);
+
+    printf("SHRAVYA: 🗜️ Codec benchmark: %u samples x %u channels, %u-sample frames, %u passes\n",
+           ctx->count, channels, frame, passes);
+    printf("SHRAVYA:    %.0f -> %llu bytes, ratio %.2fx (%.2f bits/value), %s\n", raw_bytes,
+           (unsigned long long) coded_total, raw_bytes / (double) coded_total,
+           8.0 * (double) coded_total / ((double) ctx->count * channels), exact ? "bit-exact" : "MISMATCH");
+    printf("SHRAVYA:    encode %.1f MB/s (%.0f ns/sample, %.3f%% of this core at %u SPS)\n",
+           raw_bytes * passes / encode_s / 1e6, encode_ns, encode_ns * ctx->rate_hz / 1e7, ctx->rate_hz);
+    printf("SHRAVYA:    decode %.1f MB/s (%.0f ns/sample)\n", raw_bytes * passes / decode_s / 1e6, decode_ns);
+
+    free(coded);
+    free(frame_bytes);
+    free(decoded);
+    return exact ? 0 : -1;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-c out.csv] [-s session] [-b] [-f frame] image.rec\n"
+            "  -c  write sample,timestamp_us,rate_hz,ch0..chN (raw counts) to a CSV file\n"
+            "  -s  session id to decode (hex, default: the session at the start of the image)\n"
+            "  -b  benchmark the lossless codec on the decoded samples (ratio, MB/s, CPU share)\n"
+            "  -f  benchmark frame size in samples (default %d, max %d)\n",
+            argv0, EEG_RECORDER_FRAME_SAMPLES, EEG_CODEC_MAX_SAMPLES);
+}
+
+int main(int argc, char **argv)
+{
+    const char *csv_path = NULL;
+    uint32_t session_id = 0;
+    bool benchmark = false;
+    uint32_t frame = EEG_RECORDER_FRAME_SAMPLES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:s:bf:h")) != -1) {
+        switch (opt) {
+            case 'c': csv_path = optarg; break;
+            case 's': session_id = (uint32_t) strtoul(optarg, NULL, 16); break;
+            case 'b': benchmark = true; break;
+            case 'f': frame = (uint32_t) strtoul(optarg, NULL, 10); break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+    if ((optind >= argc) || (frame < 1U) || (frame > EEG_CODEC_MAX_SAMPLES)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    decode_context_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    if (csv_path) {
+        ctx.csv = fopen(csv_path, "w");
+        if (!ctx.csv) {
+            fprintf(stderr, "SHRAVYA: ❌ Cannot write %s\n", csv_path);
+            return 1;
+        }
+    }
+    if (benchmark) {
+        ctx.capacity = 4096;
+        ctx.samples = malloc((size_t) ctx.capacity * EEG_RECORD_MAX_CHANNELS * sizeof(int32_t));
+        if (!ctx.samples) return 1;
+    }
+
+    eeg_decode_summary_t summary;
+    int result = eeg_decode_file(argv[optind], session_id, (ctx.csv || benchmark) ? on_decoded_sample : NULL,
+                                 &ctx, &summary);
+    if (ctx.csv) fclose(ctx.csv);
+    if (0 != result) {
+        fprintf(stderr, "SHRAVYA: ❌ No recorder blocks%s in %s\n", session_id ? " of that session" : "", argv[optind]);
+        return 1;
+    }
+
+    printf("SHRAVYA: 💾 %s: session %08X (%u in image), %u channels\n", argv[optind],
+           summary.session_id, summary.sessions, summary.channel_count);
+    printf("SHRAVYA:    %u blocks, %u samples, %.2f s, %u -> %u SPS (%u rate changes)\n",
+           summary.blocks, summary.samples, summary.duration_s, summary.first_rate_hz,
+           summary.last_rate_hz, summary.rate_changes);
+    printf("SHRAVYA:    CRC/field errors %u, missing blocks %u, gaps %u (%u samples), sequence gaps %u\n",
+           summary.bad_blocks, summary.missing_blocks, summary.gaps, summary.gap_samples, summary.sequence_gaps);
+    if (summary.payload_bytes > 0U) {
+        printf("SHRAVYA:    payload %llu bytes (%u coded blocks), %.2fx vs packed 24-bit\n",
+               (unsigned long long) summary.payload_bytes, summary.coded_blocks,
+               (double) summary.samples * summary.channel_count * EEG_RECORD_SAMPLE_BYTES / (double) summary.payload_bytes);
+    }
+
+    int status = (summary.bad_blocks || summary.missing_blocks || summary.gaps) ? 3 : 0;
+    if (benchmark && (0 != benchmark_codec(&ctx, summary.channel_count, frame))) status = 3;
+    free(ctx.samples);
+    return status;
+}
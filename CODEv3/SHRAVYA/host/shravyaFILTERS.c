@@ -0,0 +1,489 @@
+/**
+ * @file shravyaFILTERS.c
+ * @brief SHRAVYA conditioning filter designer - writes src/eegFILTERTABLES.c
+ * @note One cascade per per-channel rate eeg_rate_sample_rates() can return
+ *       and per mains frequency (50/60 Hz), designed in double precision:
+ *       Butterworth highpass, Butterworth or elliptic lowpass, Butterworth
+ *       band-stop around the mains frequency (or where it aliases to).
+ *       Run by make -C host tables; the firmware only selects a table.
+ */
+#include "hal_data.h"
+#include "eegRATE.h"
+#include "eegFILTERTABLES.h"
+#include "shravyaCONFIG.h"
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FILTER_HIGHPASS_HZ          0.5     // EEG lower band edge (-3 dB)
+#define FILTER_LOWPASS_HZ           45.0    // EEG upper band edge (passband edge)
+#define FILTER_LOWPASS_MAX_NYQUIST  0.9     // Lowpass edge capped at this fraction of Nyquist
+#define FILTER_RIPPLE_DB            0.1     // Elliptic passband ripple
+#define FILTER_STOP_DB              40.0    // Elliptic stopband attenuation
+#define FILTER_MAINS_WIDTH_HZ       2.0     // Band-stop -3 dB width around the mains frequency
+#define FILTER_EDGE_MIN_HZ          1.0     // Band-stop this close to DC/Nyquist is left out
+#define FILTER_MAX_ORDER            8
+#define FILTER_MAX_RATES            32
+#define LANDEN_MAX                  16
+#define PI                          3.14159265358979323846
+
+typedef struct {
+    double complex poles[2 * FILTER_MAX_ORDER];
+    double complex zeros[2 * FILTER_MAX_ORDER];     // Finite zeros
+    uint32_t pole_count;
+    uint32_t zero_count;
+} zpk_t;
+
+typedef struct {
+    double sos[EEG_BIQUAD_MAX_STAGES][5];
+    uint32_t stages;
+    uint32_t mains_stages;                          // Trailing band-stop sections
+} cascade_t;
+
+typedef struct {
+    uint32_t highpass_order;
+    uint32_t lowpass_order;
+    uint32_t mains_order;
+    bool lowpass_elliptic;
+} design_spec_t;
+
+/* ==================== Analog prototypes (passband edge 1 rad/s) ==================== */
+
+static void butter_prototype(uint32_t order, zpk_t *zpk)
+{
+    memset(zpk, 0, sizeof(*zpk));
+    for (uint32_t k = 0; k < order; k++) {
+        zpk->poles[k] = cexp(I * PI * (double) (2U * k + order + 1U) / (double) (2U * order));
+    }
+    zpk->pole_count = order;
+}
+
+/* Jacobi elliptic functions by descending Landen transformations (Orfanidis) */
+static uint32_t landen(double k, double v[LANDEN_MAX])
+{
+    uint32_t n = 0;
+    while ((k > 1e-15) && (n < LANDEN_MAX)) {
+        k = k / (1.0 + sqrt(1.0 - k * k));
+        k *= k;
+        v[n++] = k;
+    }
+    return n;
+}
+
+static double ellipk(double k)
+{
+    double v[LANDEN_MAX];
+    uint32_t n = landen(k, v);
+    double K = PI / 2.0;
+    for (uint32_t i = 0; i < n; i++) K *= 1.0 + v[i];
+    return K;
+}
+
+static double complex cde(double complex u, double k)
+{
+    double v[LANDEN_MAX];
+    uint32_t n = landen(k, v);
+    double complex w = ccos(u * PI / 2.0);
+    for (uint32_t i = n; i-- > 0;) w = (1.0 + v[i]) * w / (1.0 + v[i] * w * w);
+    return w;
+}
+
+static double complex sne(double complex u, double k)
+{
+    double v[LANDEN_MAX];
+    uint32_t n = landen(k, v);
+    double complex w = csin(u * PI / 2.0);
+    for (uint32_t i = n; i-- > 0;) w = (1.0 + v[i]) * w / (1.0 + v[i] * w * w);
+    return w;
+}
+
+static double srem(double x, double y)
+{
+    return x - y * round(x / y);
+}
+
+static double complex acde(double complex w, double k)
+{
+    double v[LANDEN_MAX];
+    uint32_t n = landen(k, v);
+    for (uint32_t i = 0; i < n; i++) {
+        double v1 = (0U == i) ? k : v[i - 1U];
+        w = w / (1.0 + csqrt(1.0 - w * w * v1 * v1)) * 2.0 / (1.0 + v[i]);
+    }
+    double complex u = 2.0 / PI * cacos(w);
+    double ratio = ellipk(sqrt(1.0 - k * k)) / ellipk(k);
+    return srem(creal(u), 4.0) + I * srem(cimag(u), 2.0 * ratio);
+}
+
+static double complex asne(double complex w, double k)
+{
+    return 1.0 - acde(w, k);
+}
+
+/** Selectivity modulus an elliptic filter of @p order reaches for discrimination @p k1 */
+static double ellipdeg(uint32_t order, double k1)
+{
+    double k1c = sqrt(1.0 - k1 * k1);
+    double product = 1.0;
+    for (uint32_t i = 1; i <= order / 2U; i++) {
+        product *= creal(sne((double) (2U * i - 1U) / (double) order, k1c));
+    }
+    double kc = pow(k1c, (double) order) * pow(product, 4.0);
+    return sqrt(1.0 - kc * kc);
+}
+
+static void ellip_prototype(uint32_t order, double ripple_db, double stop_db, zpk_t *zpk)
+{
+    double ep = sqrt(pow(10.0, ripple_db / 10.0) - 1.0);
+    double es = sqrt(pow(10.0, stop_db / 10.0) - 1.0);
+    double k1 = ep / es;
+    double k = ellipdeg(order, k1);
+    double v0 = creal(-I * asne(I / ep, k1) / (double) order);
+
+    memset(zpk, 0, sizeof(*zpk));
+    for (uint32_t i = 1; i <= order / 2U; i++) {
+        double u = (double) (2U * i - 1U) / (double) order;
+        double complex zeta = cde(u, k);
+        double complex zero = I / (k * zeta);
+        double complex pole = I * cde(u - I * v0, k);
+        zpk->zeros[zpk->zero_count++] = zero;
+        zpk->zeros[zpk->zero_count++] = conj(zero);
+        zpk->poles[zpk->pole_count++] = pole;
+        zpk->poles[zpk->pole_count++] = conj(pole);
+    }
+    if (order & 1U) {
+        zpk->poles[zpk->pole_count++] = creal(I * sne(I * v0, k));
+    }
+}
+
+/* ==================== Band transforms and bilinear mapping ==================== */
+
+/** Prewarped analog frequency of @p hz for the bilinear map s = (z - 1) / (z + 1) */
+static double prewarp(double hz, double fs)
+{
+    return tan(PI * hz / fs);
+}
+
+/** Lowpass at @p wc; zeros at infinity stay there (z = -1) */
+static void to_lowpass(zpk_t *zpk, double wc)
+{
+    for (uint32_t i = 0; i < zpk->pole_count; i++) zpk->poles[i] *= wc;
+    for (uint32_t i = 0; i < zpk->zero_count; i++) zpk->zeros[i] *= wc;
+}
+
+/** Highpass at @p wc; zeros at infinity move to s = 0 */
+static void to_highpass(zpk_t *zpk, double wc)
+{
+    for (uint32_t i = 0; i < zpk->pole_count; i++) zpk->poles[i] = wc / zpk->poles[i];
+    for (uint32_t i = 0; i < zpk->zero_count; i++) zpk->zeros[i] = wc / zpk->zeros[i];
+    while (zpk->zero_count < zpk->pole_count) zpk->zeros[zpk->zero_count++] = 0.0;
+}
+
+/** Band-stop between @p w1 and @p w2; zeros at infinity move to ±j sqrt(w1 w2) */
+static void to_bandstop(zpk_t *zpk, double w1, double w2)
+{
+    const double bw = w2 - w1;
+    const double w0sq = w1 * w2;
+    zpk_t out;
+
+    memset(&out, 0, sizeof(out));
+    for (uint32_t i = 0; i < zpk->pole_count; i++) {
+        double complex half = bw / zpk->poles[i] / 2.0;
+        double complex root = csqrt(half * half - w0sq);
+        out.poles[out.pole_count++] = half + root;
+        out.poles[out.pole_count++] = half - root;
+    }
+    for (uint32_t i = 0; i < zpk->zero_count; i++) {
+        double complex half = bw / zpk->zeros[i] / 2.0;
+        double complex root = csqrt(half * half - w0sq);
+        out.zeros[out.zero_count++] = half + root;
+        out.zeros[out.zero_count++] = half - root;
+    }
+    while (out.zero_count < out.pole_count) {
+        out.zeros[out.zero_count++] = I * sqrt(w0sq);
+        out.zeros[out.zero_count++] = -I * sqrt(w0sq);
+    }
+    *zpk = out;
+}
+
+/** z = (1 + s) / (1 - s); remaining zeros at infinity land on z = -1 */
+static void bilinear(zpk_t *zpk)
+{
+    for (uint32_t i = 0; i < zpk->pole_count; i++) zpk->poles[i] = (1.0 + zpk->poles[i]) / (1.0 - zpk->poles[i]);
+    for (uint32_t i = 0; i < zpk->zero_count; i++) zpk->zeros[i] = (1.0 + zpk->zeros[i]) / (1.0 - zpk->zeros[i]);
+    while (zpk->zero_count < zpk->pole_count) zpk->zeros[zpk->zero_count++] = -1.0;
+}
+
+/* ==================== Second-order sections ==================== */
+
+static double complex section_response(const double *sos, double complex z)
+{
+    double complex zi = 1.0 / z;
+    return (sos[0] + sos[1] * zi + sos[2] * zi * zi) / (1.0 + sos[3] * zi + sos[4] * zi * zi);
+}
+
+static double cascade_gain_db(const cascade_t *cascade, double hz, double fs)
+{
+    double complex z = cexp(I * 2.0 * PI * hz / fs);
+    double complex h = 1.0;
+    for (uint32_t s = 0; s < cascade->stages; s++) h *= section_response(cascade->sos[s], z);
+    return 20.0 * log10(cabs(h) + 1e-300);
+}
+
+/** Take the root of @p roots[0..count) nearest @p target out of the list */
+static double complex take_nearest(double complex *roots, uint32_t *count, double complex target, bool want_real)
+{
+    uint32_t best = *count;
+    for (uint32_t i = 0; i < *count; i++) {
+        bool is_real = fabs(cimag(roots[i])) < 1e-12;
+        if ((want_real != is_real) || (!is_real && (cimag(roots[i]) < 0.0))) continue;
+        if ((best == *count) || (cabs(roots[i] - target) < cabs(roots[best] - target))) best = i;
+    }
+    if (best == *count) return NAN;
+    double complex root = roots[best];
+    roots[best] = roots[--(*count)];
+    return root;
+}
+
+/**
+ * @brief Split a digital zpk into sections, least resonant first, each with
+ *        unit gain at @p reference (z = 1 for lowpass/band-stop, -1 for highpass)
+ */
+static bool append_sections(cascade_t *cascade, zpk_t *zpk, double complex reference)
+{
+    while (zpk->pole_count > 0U) {
+        /* Complex pole pair farthest from the unit circle, else the real poles */
+        uint32_t pick = zpk->pole_count;
+        for (uint32_t i = 0; i < zpk->pole_count; i++) {
+            if (cimag(zpk->poles[i]) <= 1e-12) continue;
+            if ((pick == zpk->pole_count) || (cabs(zpk->poles[i]) < cabs(zpk->poles[pick]))) pick = i;
+        }
+
+        double a1, a2, b1, b2;
+        double complex p1, p2 = 0.0, z1, z2 = 0.0;
+        bool second_order;
+        if (pick < zpk->pole_count) {
+            p1 = zpk->poles[pick];
+            zpk->poles[pick] = zpk->poles[--zpk->pole_count];
+            for (uint32_t i = 0; i < zpk->pole_count; i++) {
+                if ((fabs(cimag(zpk->poles[i]) + cimag(p1)) < 1e-9) && (fabs(creal(zpk->poles[i]) - creal(p1)) < 1e-9)) {
+                    zpk->poles[i] = zpk->poles[--zpk->pole_count];
+                    break;
+                }
+            }
+            p2 = conj(p1);
+            second_order = true;
+        } else {
+            p1 = take_nearest(zpk->poles, &zpk->pole_count, 1.0, true);
+            second_order = (zpk->pole_count > 0U);
+            if (second_order) p2 = take_nearest(zpk->poles, &zpk->pole_count, 1.0, true);
+        }
+
+        /* Zeros: the complex pair nearest the pole, else real zeros */
+        z1 = take_nearest(zpk->zeros, &zpk->zero_count, p1, false);
+        if (!isnan(creal(z1))) {
+            for (uint32_t i = 0; i < zpk->zero_count; i++) {
+                if ((fabs(cimag(zpk->zeros[i]) + cimag(z1)) < 1e-9) && (fabs(creal(zpk->zeros[i]) - creal(z1)) < 1e-9)) {
+                    zpk->zeros[i] = zpk->zeros[--zpk->zero_count];
+                    break;
+                }
+            }
+            z2 = conj(z1);
+        } else {
+            z1 = take_nearest(zpk->zeros, &zpk->zero_count, p1, true);
+            if (second_order) z2 = take_nearest(zpk->zeros, &zpk->zero_count, p2, true);
+        }
+        if (isnan(creal(z1)) || isnan(creal(z2))) return false;
+
+        if (second_order) {
+            a1 = -creal(p1 + p2);
+            a2 = creal(p1 * p2);
+            b1 = -creal(z1 + z2);
+            b2 = creal(z1 * z2);
+        } else {
+            a1 = -creal(p1);
+            a2 = 0.0;
+            b1 = -creal(z1);
+            b2 = 0.0;
+        }
+        if (cabs(p1) >= 1.0 || cabs(p2) >= 1.0) return false;
+        if (cascade->stages >= EEG_BIQUAD_MAX_STAGES) return false;
+
+        double *sos = cascade->sos[cascade->stages++];
+        sos[0] = 1.0;
+        sos[1] = b1;
+        sos[2] = b2;
+        sos[3] = a1;
+        sos[4] = a2;
+        double gain = cabs(section_response(sos, reference));
+        sos[0] /= gain;
+        sos[1] /= gain;
+        sos[2] /= gain;
+    }
+    return true;
+}
+
+/* ==================== Cascade per rate and mains frequency ==================== */
+
+/**
+ * @brief Highpass -> lowpass -> mains band-stop for one rate
+ * @return false if the sections do not fit or a design is unstable
+ */
+static bool design_cascade(const design_spec_t *spec, double fs, double mains_hz, cascade_t *cascade,
+                           double *notch_hz, double *lowpass_hz)
+{
+    zpk_t zpk;
+
+    memset(cascade, 0, sizeof(*cascade));
+
+    butter_prototype(spec->highpass_order, &zpk);
+    to_highpass(&zpk, prewarp(FILTER_HIGHPASS_HZ, fs));
+    bilinear(&zpk);
+    if (!append_sections(cascade, &zpk, -1.0)) return false;
+
+    *lowpass_hz = FILTER_LOWPASS_HZ;
+    if (*lowpass_hz > FILTER_LOWPASS_MAX_NYQUIST * fs / 2.0) *lowpass_hz = FILTER_LOWPASS_MAX_NYQUIST * fs / 2.0;
+    uint32_t first = cascade->stages;
+    if (spec->lowpass_elliptic) {
+        ellip_prototype(spec->lowpass_order, FILTER_RIPPLE_DB, FILTER_STOP_DB, &zpk);
+    } else {
+        butter_prototype(spec->lowpass_order, &zpk);
+    }
+    to_lowpass(&zpk, prewarp(*lowpass_hz, fs));
+    bilinear(&zpk);
+    if (!append_sections(cascade, &zpk, 1.0)) return false;
+
+    /* Even-order elliptic: DC sits at the bottom of the ripple */
+    if (spec->lowpass_elliptic && !(spec->lowpass_order & 1U) && (cascade->stages > first)) {
+        double scale = pow(10.0, -FILTER_RIPPLE_DB / 20.0);
+        for (int i = 0; i < 3; i++) cascade->sos[cascade->stages - 1U][i] *= scale;
+    }
+
+    /* Mains is notched where it aliases to; an alias near DC or Nyquist gets
+     * pass-through sections instead, so every rate has the same section layout
+     * and histories line up across a rate switch. The band-stop goes last so
+     * the firmware can drop it (eeg_filter_table_t.mains_stages) once the
+     * mains canceller takes over. */
+    double alias = fabs(mains_hz - fs * floor(mains_hz / fs + 0.5));
+    double low = alias - FILTER_MAINS_WIDTH_HZ / 2.0;
+    double high = alias + FILTER_MAINS_WIDTH_HZ / 2.0;
+    *notch_hz = 0.0;
+    cascade->mains_stages = spec->mains_order;
+    if ((low >= FILTER_EDGE_MIN_HZ) && (high <= fs / 2.0 - FILTER_EDGE_MIN_HZ)) {
+        butter_prototype(spec->mains_order, &zpk);
+        to_bandstop(&zpk, prewarp(low, fs), prewarp(high, fs));
+        bilinear(&zpk);
+        if (!append_sections(cascade, &zpk, 1.0)) return false;
+        *notch_hz = alias;
+    } else {
+        for (uint32_t s = 0; s < spec->mains_order; s++) {
+            if (cascade->stages >= EEG_BIQUAD_MAX_STAGES) return false;
+            cascade->sos[cascade->stages++][0] = 1.0;
+        }
+    }
+    return true;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-o file.c] [-H order] [-L order] [-M order] [-b]\n"
+            "  -o  output (default stdout)\n"
+            "  -H  highpass Butterworth order (default 4)\n"
+            "  -L  lowpass order (default 4)\n"
+            "  -M  mains band-stop prototype order (default 2: 4th-order band-stop)\n"
+            "  -b  Butterworth lowpass instead of elliptic\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    design_spec_t spec = { .highpass_order = 4, .lowpass_order = 4, .mains_order = 2, .lowpass_elliptic = true };
+    static const uint32_t mains[] = { 50, 60 };
+    const char *path = NULL;
+    uint32_t rates[FILTER_MAX_RATES];
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:H:L:M:bh")) != -1) {
+        switch (opt) {
+            case 'o': path = optarg; break;
+            case 'H': spec.highpass_order = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'L': spec.lowpass_order = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'M': spec.mains_order = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'b': spec.lowpass_elliptic = false; break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+    if ((spec.highpass_order - 1U >= FILTER_MAX_ORDER) || (spec.lowpass_order - 1U >= FILTER_MAX_ORDER) ||
+        (spec.mains_order - 1U >= FILTER_MAX_ORDER / 2U)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    FILE *out = path ? fopen(path, "w") : stdout;
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+
+    uint32_t rate_count = eeg_rate_sample_rates(rates, FILTER_MAX_RATES);
+    fprintf(out,
+            "/**\n"
+            " * @file eegFILTERTABLES.c\n"
+            " * @brief Conditioning cascades per sample rate and mains frequency\n"
+            " * @note GENERATED by host/shravyaFILTERS.c (make -C host tables) - do not edit.\n"
+            " *       Highpass: Butterworth order %u, -3 dB at %.1f Hz.\n"
+            " *       Lowpass: %s order %u, edge %.0f Hz (at most %.0f%% of Nyquist)%s.\n"
+            " *       Mains: Butterworth band-stop order %u, %.1f Hz wide (-3 dB), at the mains alias (last sections).\n"
+            " */\n"
+            "#include \"hal_data.h\"\n"
+            "#include \"eegFILTERTABLES.h\"\n"
+            "\n"
+            "const eeg_filter_table_t eeg_filter_tables[] = {\n",
+            spec.highpass_order, FILTER_HIGHPASS_HZ,
+            spec.lowpass_elliptic ? "elliptic" : "Butterworth", spec.lowpass_order, FILTER_LOWPASS_HZ,
+            FILTER_LOWPASS_MAX_NYQUIST * 100.0, spec.lowpass_elliptic ? ", 0.1 dB ripple, 40 dB stopband" : "",
+            2U * spec.mains_order, FILTER_MAINS_WIDTH_HZ);
+
+    for (uint32_t r = 0; r < rate_count; r++) {
+        for (uint32_t m = 0; m < sizeof(mains) / sizeof(mains[0]); m++) {
+            const double fs = (double) rates[r];
+            cascade_t cascade;
+            double notch_hz, lowpass_hz;
+
+            if (!design_cascade(&spec, fs, (double) mains[m], &cascade, &notch_hz, &lowpass_hz)) {
+                fprintf(stderr, "SHRAVYA: ❌ %u SPS / %u Hz mains: design does not fit %u sections or is unstable\n",
+                        rates[r], mains[m], EEG_BIQUAD_MAX_STAGES);
+                if (path) fclose(out);
+                return 3;
+            }
+
+            fprintf(out, "    { %u, %u, %u, %u, {", rates[r], mains[m], cascade.stages, cascade.mains_stages);
+            if (notch_hz > 0.0) {
+                fprintf(out, "    /* mains at %.1f Hz: %.1f dB; lowpass edge %.1f Hz: %.2f dB */\n",
+                        notch_hz, cascade_gain_db(&cascade, notch_hz, fs), lowpass_hz,
+                        cascade_gain_db(&cascade, lowpass_hz, fs));
+            } else {
+                fprintf(out, "    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge %.1f Hz: %.2f dB */\n",
+                        lowpass_hz, cascade_gain_db(&cascade, lowpass_hz, fs));
+            }
+            for (uint32_t s = 0; s < cascade.stages; s++) {
+                fprintf(out, "        { %.9ef, %.9ef, %.9ef, %.9ef, %.9ef },\n", cascade.sos[s][0], cascade.sos[s][1],
+                        cascade.sos[s][2], cascade.sos[s][3], cascade.sos[s][4]);
+            }
+            fprintf(out, "    } },\n");
+        }
+    }
+
+    fprintf(out,
+            "};\n"
+            "\n"
+            "const uint32_t eeg_filter_table_count = sizeof(eeg_filter_tables) / sizeof(eeg_filter_tables[0]);\n");
+    if (path) fclose(out);
+    fprintf(stderr, "SHRAVYA: ✅ %u rates x %u mains frequencies written to %s\n", rate_count,
+            (unsigned) (sizeof(mains) / sizeof(mains[0])), path ? path : "stdout");
+    return 0;
+}
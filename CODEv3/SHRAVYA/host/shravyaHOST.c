@@ -0,0 +1,556 @@
+/**
+ * @file shravyaHOST.c
+ * @brief SHRAVYA host runner - ADS1263 model → acquisition ring → signal processing → features → forward_propagation
+ * @note Runs the firmware's portable sources on Linux against the ADS1263
+ *       model on a virtual clock, so a session runs as fast as the host CPU
+ *       allows. The loop plays the acquisition task (eeg_buffer_write() and
+ *       the recorder service per conversion) and wakes the processing task's
+ *       drain every EEG_BUFFER_TRIGGER_SAMPLES, as the firmware does. Pipeline printf output goes to stdout (silenced unless -v);
+ *       the run summary goes to stderr.
+ */
+#include "hal_data.h"
+#include "eegTYPES.h"
+#include "shravyaCONFIG.h"
+#include "signalPROCESSING.h"
+#include "cognitiveSTATES.h"
+#include "ads1263HAL.h"
+#include "ads1263PROFILE.h"
+#include "ads1263IMPEDANCE.h"
+#include "ads1263MODEL.h"
+#include "eegRATE.h"
+#include "eegRECORDER.h"
+#include "eegBUFFER.h"
+#include "eegARTIFACT.h"
+#include "eegDECODE.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HOST_DRDY_TIMEOUT_US 100000
+
+extern void forward_propagation(const feature_vector_t *features, float *output);
+extern cognitive_state_type_t determine_dominant_state(const float *probabilities);
+
+static const char *state_names[COGNITIVE_STATE_COUNT] = {
+    "focus", "stress", "anxiety", "fatigue", "calm", "boredom"
+};
+
+/* Profile storage: a file (-p) stands in for data flash, otherwise it lives for one run */
+static const char *profile_path = NULL;
+static ads1263_profile_t profile_ram;
+
+static fsp_err_t host_profile_read(void *data, uint32_t length)
+{
+    if (!profile_path) {
+        memcpy(data, &profile_ram, length);
+        return FSP_SUCCESS;
+    }
+    FILE *f = fopen(profile_path, "rb");
+    if (!f) return FSP_ERR_NOT_FOUND;
+    size_t got = fread(data, 1, length, f);
+    fclose(f);
+    if (got != length) memset((uint8_t *) data + got, 0, length - got);
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t host_profile_write(const void *data, uint32_t length)
+{
+    if (!profile_path) {
+        memcpy(&profile_ram, data, length);
+        return FSP_SUCCESS;
+    }
+    FILE *f = fopen(profile_path, "wb");
+    if (!f) return FSP_ERR_WRITE_FAILED;
+    size_t put = fwrite(data, 1, length, f);
+    fclose(f);
+    return (put == length) ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+}
+
+static const ads1263_profile_storage_t host_profile_storage = {
+    .name = "host file",
+    .read = host_profile_read,
+    .write = host_profile_write,
+};
+
+/* Recorder storage: a file (-o) stands in for the OSPI region, erased to 0xFF on demand */
+static FILE *record_file = NULL;
+static uint32_t record_value_crc = 0;       // CRC of every recorded value as the decoder should return it
+
+static fsp_err_t host_record_erase(uint32_t offset)
+{
+    static uint8_t erased[EEG_RECORDER_BLOCK_BYTES];
+    memset(erased, 0xFF, sizeof(erased));
+    if (0 != fseek(record_file, (long) offset, SEEK_SET)) return FSP_ERR_WRITE_FAILED;
+    return (fwrite(erased, 1, sizeof(erased), record_file) == sizeof(erased)) ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+}
+
+static fsp_err_t host_record_program(uint32_t offset, const void *data, uint32_t length)
+{
+    if (0 != fseek(record_file, (long) offset, SEEK_SET)) return FSP_ERR_WRITE_FAILED;
+    return (fwrite(data, 1, length, record_file) == length) ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+}
+
+static const eeg_recorder_storage_t host_record_storage = {
+    .name = "host file",
+    .capacity_bytes = EEG_RECORDER_OSPI_BYTES,
+    .erase_bytes = EEG_RECORDER_BLOCK_BYTES,
+    .erase = host_record_erase,
+    .program = host_record_program,
+};
+
+/* Window statistics, gathered the way the feature extraction task consumes windows */
+typedef struct {
+    uint32_t windows;
+    uint32_t artifact_windows;          // Windows past EEG_ARTIFACT_MAX_RATIO
+    double artifact_ratio_total;
+    float last_excluded[EEG_CHANNELS];  // Fraction of each channel excluded at acquisition, newest window
+    uint32_t state_histogram[COGNITIVE_STATE_COUNT];
+    double classify_wall;               // Wall seconds spent in features + NN
+} host_window_stats_t;
+
+static void check_decoded_sample(void *context, const eeg_record_header_t *header, uint32_t sample,
+                                 uint32_t timestamp_us, const int32_t *values)
+{
+    (void) header;
+    (void) sample;
+    (void) timestamp_us;
+    *(uint32_t *) context = eeg_record_crc32(*(uint32_t *) context, values, EEG_CHANNELS * sizeof(int32_t));
+}
+
+static double wall_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Features and classifier for every window processing posted to the ready mailbox
+ */
+static void classify_ready_windows(host_window_stats_t *out)
+{
+    eeg_window_t *window;
+
+    while ((window = signal_processing_receive_window(TMO_POL)) != NULL) {
+        const float *window_channels[EEG_CHANNELS];
+        uint32_t window_samples = window->rate.window_samples;
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            window_channels[ch] = window->channel[ch];
+        }
+
+        double t0 = wall_seconds();
+        float probabilities[COGNITIVE_STATE_COUNT];
+        extract_frequency_features(window_channels, EEG_CHANNELS, (int) window_samples);
+        extract_wavelet_band_features(window->wavelet_energy, EEG_CHANNELS, (int) window->wavelet_levels);
+        extract_time_domain_features(window_channels, EEG_CHANNELS, (int) window_samples);
+        extract_coherence_features(window_channels, EEG_CHANNELS, (int) window_samples);
+        extract_quality_features(window_channels, EEG_CHANNELS, (int) window_samples, window->artifact_ratio);
+        out->artifact_ratio_total += current_features.artifact_ratio;
+        out->artifact_windows += (current_features.artifact_ratio > EEG_ARTIFACT_MAX_RATIO);
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            uint32_t excluded = 0;
+            for (uint32_t i = 0; i < window_samples; i++) {
+                excluded += (0U != (window->mask[ch][i] & EEG_ARTIFACT_EXCLUDED));
+            }
+            out->last_excluded[ch] = (float) excluded / (float) window_samples;
+        }
+        signal_processing_release_window(window);
+        forward_propagation(&current_features, probabilities);
+        out->state_histogram[determine_dominant_state(probabilities)]++;
+        out->classify_wall += wall_seconds() - t0;
+        out->windows++;
+    }
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-t seconds] [-r sps] [-s sps@seconds] [-f file.csv -R file_rate_hz] [-e N] [-S seed]\n"
+            "          [-M mains_hz] [-p profile.bin] [-T celsius] [-I] [-Z kohms] [-L channel@seconds] [-A seconds]\n"
+            "          [-o record.rec] [-v]\n"
+            "  -t  virtual session length in seconds (default 60)\n"
+            "  -r  per-channel sample rate at boot, rounded to an ADS1263 data rate (default %d)\n"
+            "  -s  switch the sample rate at runtime, seconds into the session\n"
+            "  -f  replay a CSV recording (µV, one column per electrode pair) instead of synthetic EEG\n"
+            "  -R  sample rate of the CSV recording (default %d)\n"
+            "  -e  corrupt one RDATA checksum every N frames\n"
+            "  -S  synthetic source noise seed\n"
+            "  -M  mains frequency the synthetic source picks up (default 50)\n"
+            "  -p  ADS1263 profile file standing in for data flash (restored on the next run)\n"
+            "  -T  model die temperature, to exercise the recalibration drift check (default 25)\n"
+            "  -I  background impedance slots while streaming (EEG_IMPEDANCE_ENABLED, default %s)\n"
+            "  -Z  electrode contact impedance seen by the impedance slots (default 5)\n"
+            "  -L  lift the MUXP electrode of a montage channel off the skin (seconds after power-on);\n"
+            "      exits 1 unless the railed channel is excluded from the last window\n"
+            "  -A  add an artifact burst to the synthetic source every N seconds (blink / electrode pop)\n"
+            "  -o  record raw samples to a recorder image (decode with shravya_decode), verified at exit\n"
+            "  -v  keep the pipeline's own SHRAVYA: output on stdout\n",
+            argv0, EEG_SAMPLE_RATE_HZ, EEG_SAMPLE_RATE_HZ, EEG_IMPEDANCE_ENABLED ? "on" : "off");
+}
+
+int main(int argc, char **argv)
+{
+    double session_s = 60.0;
+    uint32_t rate_sps = EEG_SAMPLE_RATE_HZ;
+    uint32_t switch_sps = 0;
+    double switch_at_s = 0.0;
+    double csv_rate_hz = EEG_SAMPLE_RATE_HZ;
+    const char *csv_path = NULL;
+    uint32_t corrupt_one_in = 0;
+    uint32_t seed = 0;
+    double mains_hz = 50.0;
+    double temperature_c = 25.0;
+    bool impedance_enabled = EEG_IMPEDANCE_ENABLED;
+    double electrode_kohms = 5.0;
+    int lift_channel = -1;
+    double lift_at_s = 0.0;
+    double artifact_every_s = 0.0;
+    const char *record_path = NULL;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:r:s:f:R:e:S:M:p:T:IZ:L:A:o:vh")) != -1) {
+        switch (opt) {
+            case 't': session_s = atof(optarg); break;
+            case 'r': rate_sps = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 's':
+                if (sscanf(optarg, "%u@%lf", &switch_sps, &switch_at_s) != 2 || switch_sps == 0 || switch_at_s <= 0.0) {
+                    usage(argv[0]);
+                    return 2;
+                }
+                break;
+            case 'f': csv_path = optarg; break;
+            case 'R': csv_rate_hz = atof(optarg); break;
+            case 'e': corrupt_one_in = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'S': seed = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'M': mains_hz = atof(optarg); break;
+            case 'p': profile_path = optarg; break;
+            case 'T': temperature_c = atof(optarg); break;
+            case 'I': impedance_enabled = true; break;
+            case 'Z': electrode_kohms = atof(optarg); break;
+            case 'L':
+                if (sscanf(optarg, "%d@%lf", &lift_channel, &lift_at_s) != 2 ||
+                    lift_channel < 0 || lift_channel >= EEG_CHANNELS || lift_at_s <= 0.0) {
+                    usage(argv[0]);
+                    return 2;
+                }
+                break;
+            case 'A': artifact_every_s = atof(optarg); break;
+            case 'o': record_path = optarg; break;
+            case 'v': verbose = true; break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+
+    const ads1263_signal_source_t *source = csv_path ? ads1263_source_csv(csv_path, csv_rate_hz)
+                                                     : ads1263_source_synthetic(seed, mains_hz);
+    if (!source) return 1;
+    if (!csv_path) ads1263_source_synthetic_artifacts(artifact_every_s);
+
+    if (!verbose && !freopen("/dev/null", "w", stdout)) {
+        fprintf(stderr, "SHRAVYA: ⚠️ Could not silence stdout\n");
+    }
+
+    /* ==================== Device bring-up (same HAL calls as eeg_acquisition_init) ==================== */
+    ads1263_model_config_t config = { source, corrupt_one_in, 0, temperature_c, 0.0, electrode_kohms, 0, 0, 0.0 };
+    if (lift_channel >= 0) {
+        const ads1263_route_t *route = &ads1263_montage_routes()[lift_channel];
+        config.lift_device = route->device;
+        config.lift_pin = (uint8_t) (route->mux >> 4);
+        config.lift_at_s = lift_at_s;
+    }
+    ads1263_model_init(&config);
+    ads1263_hal_register(ads1263_model_hal());
+    ads1263_profile_storage_register(&host_profile_storage);
+    const ads1263_hal_t *hal = ads1263_hal_get();
+
+    uint64_t boot_start_ns = ads1263_model_time_ns();
+    if (FSP_SUCCESS != hal->open()) return 1;
+    hal->delay_ms(ADS1263_POWERUP_MS);
+    ads1263_send_command(ADS1263_OP_RESET);
+    hal->delay_ms(ADS1263_RESET_SETTLE_MS);
+
+    uint8_t device_id = ads1263_read_register(ADS1263_REG_ID);
+    if ((device_id >> 5) != 0x01) {
+        fprintf(stderr, "SHRAVYA: ❌ Unexpected device ID 0x%02X\n", device_id);
+        return 1;
+    }
+
+    /* The boot rate is part of the register image (and so of the profile signature) */
+    if (FSP_SUCCESS != eeg_rate_select(rate_sps, NULL)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    /* Same profile policy as ads1263_init_montage_rdata_mode() */
+    static ads1263_profile_t profile;
+    uint32_t signature = ads1263_montage_signature();
+    bool known_good = (0U != signature) && (FSP_SUCCESS == ads1263_profile_load(&profile)) &&
+                      (profile.montage_signature == signature);
+    bool recalibrate = !known_good;
+    if (known_good) {
+        ads1263_profile_restore(&profile);
+        recalibrate = ads1263_profile_drifted(&profile);
+    } else if (FSP_SUCCESS != ads1263_configure_montage() || FSP_SUCCESS != ads1263_verify_montage()) {
+        return 1;
+    }
+
+
+    if (recalibrate) {
+        if (FSP_SUCCESS != ads1263_self_calibrate() || FSP_SUCCESS != ads1263_profile_capture(&profile, signature, 0)) {
+            fprintf(stderr, "SHRAVYA: ❌ Self-calibration failed\n");
+            return 1;
+        }
+    }
+    if (FSP_SUCCESS != ads1263_start_montage()) {
+        fprintf(stderr, "SHRAVYA: ❌ No first conversion within %d ms of START\n", ADS1263_FIRST_DRDY_TIMEOUT_MS);
+        return 1;
+    }
+    double boot_ms = (double) (ads1263_model_time_ns() - boot_start_ns) * 1e-6;
+    if (recalibrate) ads1263_profile_save(&profile);
+
+    fprintf(stderr, "SHRAVYA: 🧠 Host pipeline - %s, source=%s, ID=0x%02X\n", hal->name, source->name, device_id);
+    const eeg_rate_t *boot_rate = eeg_rate_get();
+    fprintf(stderr, "SHRAVYA:    %d channel(s) on %d ADS1263, ADC1 %.1f SPS, ADC2 %.1f SPS - %lu SPS per channel, "
+            "decimated /%lu to %lu Hz, %lu-sample windows (%.2f Hz bins)\n",
+            EEG_CHANNELS, EEG_ADS1263_DEVICES, ads1263_model_adc1_rate_sps(), ads1263_model_adc2_rate_sps(),
+            (unsigned long) boot_rate->sample_rate_hz, (unsigned long) boot_rate->decimation,
+            (unsigned long) boot_rate->window_rate_hz, (unsigned long) boot_rate->window_samples, boot_rate->bin_hz);
+    fprintf(stderr, "SHRAVYA:    Boot: first conversion %.2f ms after open (virtual clock) - %s%s\n", boot_ms,
+            known_good ? "stored profile restored" : "full bring-up", recalibrate ? " + self-calibration" : "");
+
+    if (FSP_SUCCESS != signal_processing_init() || FSP_SUCCESS != cognitive_classifier_init()) {
+        fprintf(stderr, "SHRAVYA: ❌ Pipeline init failed\n");
+        return 1;
+    }
+
+    /* ==================== Acquisition → ring → processing → features → classifier ==================== */
+    host_window_stats_t results;
+    memset(&results, 0, sizeof(results));
+    uint32_t drdy_timeouts = 0;
+    eeg_rdata_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    double lift_detected_s = -1.0;
+    ads1263_impedance_init(hal->timestamp_us());
+    eeg_buffer_init(ads1263_impedance_status()->kohms);
+
+    /* Raw recorder: fed from its ring cursor after every write, the writer drains between DRDYs */
+    uint32_t recorded_samples = 0;
+    if (record_path) {
+        record_file = fopen(record_path, "w+b");
+        if (record_file) {
+            eeg_recorder_storage_register(&host_record_storage);
+            (void) eeg_buffer_request_record(true);
+            (void) eeg_buffer_record_service(hal->timestamp_us());
+        }
+        if (!record_file || !eeg_recorder_active()) {
+            fprintf(stderr, "SHRAVYA: ❌ Cannot record to %s\n", record_path);
+            return 1;
+        }
+    }
+
+    double wall_start = wall_seconds();
+    uint64_t start_ns = ads1263_model_time_ns();
+    uint64_t end_ns = start_ns + (uint64_t) (session_s * 1e9);
+    double switched_at_s = -1.0;
+    uint32_t conversion_sequence = 0;
+    uint32_t samples_for_processing = 0;
+    float filtered[EEG_CHANNELS];
+
+    while (ads1263_model_time_ns() < end_ns) {
+        if (!hal->wait_drdy(HOST_DRDY_TIMEOUT_US)) {
+            drdy_timeouts++;
+            continue;
+        }
+
+        ads1263_montage_frame_t frame;
+        fsp_err_t err = ads1263_read_montage(&frame, &stats);
+        uint32_t held = ads1263_impedance_hold_mask();
+        for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+            if (frame.adc2_new_mask & (1U << dev)) ads1263_impedance_feed_adc2(dev, frame.adc2_value[dev], hal->timestamp_us());
+        }
+        if (err == FSP_ERR_BUFFER_EMPTY) continue;
+
+        /* Same sequence policy as the acquisition task: a dropped read leaves a gap */
+        conversion_sequence++;
+        if (err != FSP_SUCCESS) {
+            stats.samples_dropped++;
+            continue;
+        }
+
+        /* Same policy as the firmware: a channel that failed its checksum or is in an
+         * impedance slot holds its last value */
+        static eeg_rdata_sample_t sample;
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            if (held & (1U << ch)) continue;
+            if (frame.valid_mask & (1U << ch)) {
+                sample.channel[ch] = frame.value[ch];
+            } else {
+                stats.channel_holds++;
+            }
+        }
+        sample.drl_feedback = 0;
+        sample.timestamp_us = hal->timestamp_us();
+        sample.sequence_number = conversion_sequence;
+        sample.held_mask = held;
+        sample.data_valid = true;
+        stats.samples_acquired++;
+
+        /* Into the ring, then the recorder takes its share from its own cursor */
+        if ((FSP_SUCCESS == eeg_buffer_write(&sample)) && eeg_recorder_active()) {
+            const ads1263_route_t *routes = ads1263_montage_routes();
+            int32_t recorded[EEG_CHANNELS];
+            for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                recorded[ch] = (1U == routes[ch].adc) ? (int32_t) ((uint32_t) (sample.channel[ch] >> 8) << 8)
+                                                      : sample.channel[ch];
+            }
+            record_value_crc = eeg_record_crc32(record_value_crc, recorded, sizeof(recorded));
+            recorded_samples++;
+        }
+        if (eeg_buffer_record_service(sample.timestamp_us)) {
+            while (eeg_recorder_write_pending()) {}
+        }
+
+        /* At most one register write in the gap before the next DRDY, as eeg_rate_service():
+         * a rate switch once the last one was taken and the impedance scheduler is idle,
+         * else the background impedance step */
+        if (held) ads1263_impedance_count_held(1);
+        double session_t = (double) (ads1263_model_time_ns() - start_ns) * 1e-9;
+        eeg_rate_t rate;
+        if (switch_sps && switched_at_s < 0.0 && session_t >= switch_at_s && !eeg_buffer_rate_switch_busy() &&
+            0U == ads1263_impedance_hold_mask() && FSP_SUCCESS == eeg_rate_select(switch_sps, &rate)) {
+            ads1263_montage_apply_rate();
+            eeg_buffer_publish_rate_switch(&rate);
+            switched_at_s = session_t;
+        } else if (impedance_enabled) {
+            ads1263_impedance_action_t action;
+            if (ads1263_impedance_service(hal->timestamp_us(), &action) && lift_channel >= 0 && lift_detected_s < 0.0 &&
+                !ads1263_impedance_status()->contact_good[lift_channel]) {
+                lift_detected_s = (double) ads1263_model_time_ns() * 1e-9;
+            }
+            ads1263_impedance_apply(&action);
+        }
+
+        /* Processing wake, as eeg_trigger_processing_pipeline(): drain the ring, then the
+         * feature extraction task takes the posted windows */
+        if (++samples_for_processing >= EEG_BUFFER_TRIGGER_SAMPLES) {
+            (void) signal_processing_drain(filtered);
+            classify_ready_windows(&results);
+            samples_for_processing = 0;
+        }
+    }
+
+    /* The wake the last samples of the session would have triggered */
+    (void) signal_processing_drain(filtered);
+    classify_ready_windows(&results);
+
+    if (record_path) {
+        (void) eeg_buffer_request_record(false);
+        if (eeg_buffer_record_service(hal->timestamp_us())) {
+            while (eeg_recorder_write_pending()) {}
+        }
+        fclose(record_file);
+    }
+
+    double wall = wall_seconds() - wall_start;
+    double virtual_s = session_s;
+    ads1263_model_stats_t model_stats;
+    ads1263_model_get_stats(&model_stats);
+
+    fprintf(stderr, "SHRAVYA: 📊 %.1f s of EEG in %.3f s wall - %.1fx real time\n",
+            virtual_s, wall, (wall > 0.0) ? virtual_s / wall : 0.0);
+    fprintf(stderr, "SHRAVYA:    Samples: %lu, dropped: %lu, stale reads: %lu, checksum errors: %lu (%lu reads failed), "
+            "retries: %lu, channel holds: %lu\n",
+            (unsigned long) stats.samples_acquired, (unsigned long) stats.samples_dropped,
+            (unsigned long) stats.stale_reads, (unsigned long) stats.checksum_errors,
+            (unsigned long) stats.checksum_failures, (unsigned long) stats.retry_attempts,
+            (unsigned long) stats.channel_holds);
+    fprintf(stderr, "SHRAVYA:    Per sample: %.2f µs, per window (features + NN): %.2f µs, windows: %lu\n",
+            stats.samples_acquired ? (wall - results.classify_wall) * 1e6 / (double) stats.samples_acquired : 0.0,
+            results.windows ? results.classify_wall * 1e6 / (double) results.windows : 0.0,
+            (unsigned long) results.windows);
+    fprintf(stderr, "SHRAVYA:    Model: %llu frames, %llu corrupted, %lu unknown opcodes, %llu ADC1 clips, %lu DRDY timeouts\n",
+            (unsigned long long) model_stats.frames_read, (unsigned long long) model_stats.frames_corrupted,
+            (unsigned long) model_stats.unknown_opcodes, (unsigned long long) model_stats.adc1_clipped,
+            (unsigned long) drdy_timeouts);
+    fprintf(stderr, "SHRAVYA:    Registers: %lu writes, %lu bursts, %lu calibrations\n",
+            (unsigned long) model_stats.register_writes, (unsigned long) model_stats.register_bursts,
+            (unsigned long) model_stats.calibrations);
+    const ads1263_impedance_status_t *impedance = ads1263_impedance_status();
+    if (impedance_enabled) {
+        fprintf(stderr, "SHRAVYA:    Impedance: %lu slots, %lu timeouts, %lu held samples (%.2f%%), "
+                "%.1f µA bias on %.3f%% of the session -",
+                (unsigned long) impedance->measurements, (unsigned long) impedance->timeouts,
+                (unsigned long) impedance->held_samples,
+                stats.samples_acquired ? 100.0 * impedance->held_samples / (double) stats.samples_acquired : 0.0,
+                EEG_IMPEDANCE_BIAS_UA, 100.0 * impedance->bias_on_us * 1e-6 / virtual_s);
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            fprintf(stderr, " ch%d=%.1f kΩ%s", ch, impedance->kohms[ch], impedance->contact_good[ch] ? "" : " (poor)");
+        }
+        fprintf(stderr, "\n");
+    }
+    bool lift_missed = false;
+    if (lift_channel >= 0 && impedance_enabled) {
+        if (lift_detected_s >= 0.0) {
+            fprintf(stderr, "SHRAVYA:    Lifted ch%d at %.2f s, impedance flagged it %.2f s later\n", lift_channel,
+                    lift_at_s, lift_detected_s - lift_at_s);
+        } else {
+            fprintf(stderr, "SHRAVYA:    Lifted ch%d at %.2f s - impedance did not flag it\n", lift_channel, lift_at_s);
+        }
+    }
+    if (lift_channel >= 0 && lift_at_s < session_s) {
+        /* Railed from the lift to the end of the session: the clip flags, not just the flat-run
+         * detector, must have excluded the newest window */
+        float railed = results.last_excluded[lift_channel];
+        lift_missed = (railed <= EEG_ARTIFACT_MAX_RATIO);
+        fprintf(stderr, "SHRAVYA:    %s Lifted ch%d: %.0f%% of its last window excluded as clipped (needs > %.0f%%)\n",
+                lift_missed ? "❌" : "✅", lift_channel, 100.0 * railed, 100.0 * EEG_ARTIFACT_MAX_RATIO);
+    }
+    if (switch_sps) {
+        const eeg_rate_t *rate = signal_processing_get_rate();
+        if (switched_at_s >= 0.0) {
+            fprintf(stderr, "SHRAVYA:    Rate switch at %.2f s: ADC1 %.1f SPS, %lu SPS per channel, decimated /%lu to %lu Hz, "
+                    "%lu-sample windows (%.2f Hz bins)\n",
+                    switched_at_s, ads1263_model_adc1_rate_sps(), (unsigned long) rate->sample_rate_hz,
+                    (unsigned long) rate->decimation, (unsigned long) rate->window_rate_hz,
+                    (unsigned long) rate->window_samples, rate->bin_hz);
+        } else {
+            fprintf(stderr, "SHRAVYA:    Rate switch to %u SPS at %.2f s - not applied\n", switch_sps, switch_at_s);
+        }
+    }
+    fprintf(stderr, "SHRAVYA:    Artifacts: %.2f%% of window samples flagged and repaired, %lu windows over %.0f%%\n",
+            results.windows ? 100.0 * results.artifact_ratio_total / (double) results.windows : 0.0,
+            (unsigned long) results.artifact_windows,
+            100.0 * EEG_ARTIFACT_MAX_RATIO);
+    if (signal_processing_get_mains()) {
+        fprintf(stderr, "SHRAVYA:    Mains: %lu Hz detected, adaptive canceller running\n",
+                (unsigned long) signal_processing_get_mains());
+    } else {
+        fprintf(stderr, "SHRAVYA:    Mains: still detecting, %u Hz band-stop running\n", (unsigned) EEG_MAINS_HZ);
+    }
+    if (record_path) {
+        const eeg_recorder_stats_t *rec = eeg_recorder_get_stats();
+        eeg_decode_summary_t decoded;
+        uint32_t decoded_crc = 0;
+        int result = eeg_decode_file(record_path, 0, check_decoded_sample, &decoded_crc, &decoded);
+        bool lossless = (0 == result) && (decoded.samples == recorded_samples) && (0U == decoded.gaps) &&
+                        (0U == decoded.bad_blocks) && (0U == decoded.missing_blocks) && (decoded_crc == record_value_crc);
+        double ratio = rec->payload_bytes_written ? (double) rec->samples_written * EEG_CHANNELS *
+                       EEG_RECORD_SAMPLE_BYTES / (double) rec->payload_bytes_written : 0.0;
+        fprintf(stderr, "SHRAVYA:    Recorder: %lu blocks, %lu samples to %s (%.2fx vs packed 24-bit), %lu stalls, "
+                "%lu write errors - decoded %lu samples, %lu gaps, %lu rate changes: %s\n",
+                (unsigned long) rec->blocks_written, (unsigned long) rec->samples_written, record_path, ratio,
+                (unsigned long) rec->buffer_stalls, (unsigned long) rec->write_errors,
+                (unsigned long) ((0 == result) ? decoded.samples : 0U), (unsigned long) ((0 == result) ? decoded.gaps : 0U),
+                (unsigned long) ((0 == result) ? decoded.rate_changes : 0U), lossless ? "bit-exact" : "MISMATCH");
+    }
+    fprintf(stderr, "SHRAVYA:    States:");
+    for (int i = 0; i < COGNITIVE_STATE_COUNT; i++) {
+        fprintf(stderr, " %s=%lu", state_names[i], (unsigned long) results.state_histogram[i]);
+    }
+    fprintf(stderr, "\n");
+
+    return lift_missed ? 1 : 0;
+}
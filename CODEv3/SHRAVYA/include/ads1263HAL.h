@@ -0,0 +1,142 @@
+#ifndef ADS1263_HAL_H
+#define ADS1263_HAL_H
+
+#include "hal_data.h"
+#include "eegTYPES.h"
+
+/* ADS1263 opcodes (datasheet Table 9-22) */
+#define ADS1263_OP_NOP      0x00
+#define ADS1263_OP_RESET    0x06
+#define ADS1263_OP_START1   0x08
+#define ADS1263_OP_STOP1    0x0A
+#define ADS1263_OP_START2   0x0C
+#define ADS1263_OP_STOP2    0x0E
+#define ADS1263_OP_RDATA1   0x12
+#define ADS1263_OP_RDATA2   0x14
+#define ADS1263_OP_SFOCAL1  0x19
+#define ADS1263_OP_SFOCAL2  0x1E
+#define ADS1263_OP_RREG     0x20
+#define ADS1263_OP_WREG     0x40
+
+/* Register map */
+#define ADS1263_REG_ID          0x00
+#define ADS1263_REG_POWER       0x01
+#define ADS1263_REG_INTERFACE   0x02
+#define ADS1263_REG_MODE0       0x03
+#define ADS1263_REG_MODE1       0x04
+#define ADS1263_REG_MODE2       0x05
+#define ADS1263_REG_INPMUX      0x06
+#define ADS1263_REG_OFCAL0      0x07
+#define ADS1263_REG_FSCAL0      0x0A
+#define ADS1263_REG_IDACMUX     0x0D
+#define ADS1263_REG_IDACMAG     0x0E
+#define ADS1263_REG_ADC2CFG     0x15
+#define ADS1263_REG_ADC2MUX     0x16
+#define ADS1263_REG_ADC2OFC0    0x17
+#define ADS1263_REG_COUNT       0x1B
+
+/* INTERFACE register / RDATA frame integrity */
+#define ADS1263_INTERFACE_STATUS_CHECKSUM 0x05  // STATUS=1, CRC[1:0]=01 (checksum mode)
+#define ADS1263_STATUS_ADC2_NEW 0x80            // STATUS bit 7: new ADC2 data
+#define ADS1263_STATUS_ADC1_NEW 0x40            // STATUS bit 6: new ADC1 data
+#define ADS1263_CHECKSUM_SEED 0x9B              // Checksum = (sum of data bytes + 0x9B) & 0xFF
+
+/* MODE1: FILTER[7:5], SBADC[4], SBPOL[3], SBMAG[2:0] (sensor bias current, 0 = off) */
+#define ADS1263_MODE1_SINC3      0x40           // FILTER=010 Sinc3, valid at every data rate; no sensor bias
+#define ADS1263_MODE1_SBADC2     0x10           // SBADC=1: sensor bias on ADC2's input pair (SBPOL=0: source on AINP)
+
+/* Internal monitors (ADC2MUX codes) and the ADC2 setting used to read them */
+#define ADS1263_MUX_TEMPERATURE  0xBB           // Temperature sensor: 122.4 mV at 25 °C, 420 µV/°C
+#define ADS1263_MUX_AVDD_MONITOR 0xCC           // (AVDD - AVSS) / 4
+#define ADS1263_ADC2CFG_MONITOR  0xC0           // 800 SPS, internal 2.5 V reference, gain 1
+
+/* IDACMUX: MUX2[7:4] / MUX1[3:0] = AIN0-AIN9, 0xA AINCOM, 0xB no connection */
+#define ADS1263_IDACMUX_OFF      0xBB
+
+/* RDATA frame after the opcode: status, 4 data bytes (ADC2: 3 data + pad), checksum */
+#define ADS1263_RDATA_FRAME_BYTES 6
+
+/**
+ * @brief ADS1263 register/command access, one implementation per platform
+ * @note Firmware binds the GPIO bit-bang driver in eegACQUISITION.c; the Linux
+ *       host build binds the device model in host/ads1263MODEL.c.
+ */
+typedef struct st_ads1263_hal {
+    const char *name;
+    fsp_err_t (*open)(void);                                        // Bus/pin bring-up
+    void (*select_device)(uint8_t device);                          // CS/DRDY used by the calls below
+    void (*write_register)(uint8_t reg_addr, uint8_t data);         // WREG, one register
+    void (*write_registers)(uint8_t start, const uint8_t *data, uint32_t count); // WREG burst (NULL = one WREG each)
+    uint8_t (*read_register)(uint8_t reg_addr);                     // RREG, one register
+    void (*send_command)(uint8_t opcode);                           // Single-byte opcode
+    void (*read_data)(uint8_t opcode, uint8_t *frame, uint32_t length); // RDATA1/RDATA2 frame
+    bool (*wait_drdy)(uint32_t timeout_us);                         // true on DRDY falling edge
+    void (*delay_ms)(uint32_t milliseconds);
+    uint32_t (*timestamp_us)(void);
+} ads1263_hal_t;
+
+/* Analog front end programmed by the montage register image */
+#define ADS1263_VREF_UV          2500000.0f // Internal 2.5 V reference, in µV
+#define ADS1263_ADC1_GAIN_CODE   0          // MODE2 GAIN[6:4]: PGA gain 1
+#define ADS1263_ADC2_GAIN_CODE   4          // ADC2CFG GAIN2[2:0]: gain 16
+#define ADS1263_ADC1_CLIP_COUNTS 2040109465L // 95% of the ADC1 32-bit code range: saturated
+#define ADS1263_ADC2_CLIP_COUNTS 7969177L   // 95% of the ADC2 24-bit code range: saturated
+
+/** One EEG_MONTAGE entry - where a channel is converted */
+typedef struct {
+    uint8_t device;           // ADS1263 index (ADS1263_CS_PINS / select_device)
+    uint8_t adc;              // 1 = ADC1 (INPMUX scan), 2 = ADC2 (ADC2MUX, continuous)
+    uint8_t mux;              // MUXP << 4 | MUXN
+} ads1263_route_t;
+
+/** One register write of a device register image */
+typedef struct {
+    uint8_t reg;
+    uint8_t value;
+} ads1263_reg_value_t;
+
+#define ADS1263_IMAGE_MAX 8       // Register image entries per device
+
+/** One conversion per montage channel as read by ads1263_read_montage() */
+typedef struct {
+    int32_t value[EEG_CHANNELS];  // ADC1 32-bit, ADC2 24-bit sign-extended
+    uint32_t valid_mask;          // Bit n: channel n checksum matched on some attempt
+    uint32_t new_mask;            // Bit n: channel n status byte reported new data
+    int32_t adc2_value[EEG_ADS1263_DEVICES]; // Every RDATA2 read this frame (route or borrowed)
+    uint32_t adc2_new_mask;       // Bit d: device d's RDATA2 status reported new data
+} ads1263_montage_frame_t;
+
+/* HAL binding */
+void ads1263_hal_register(const ads1263_hal_t *hal);
+const ads1263_hal_t *ads1263_hal_get(void);
+
+/* Register/command layer (src/ads1263HAL.c) */
+void ads1263_write_register(uint8_t reg_addr, uint8_t data);
+void ads1263_write_registers(uint8_t start, const uint8_t *data, uint32_t count);
+uint8_t ads1263_read_register(uint8_t reg_addr);
+void ads1263_send_command(uint8_t opcode);
+bool ads1263_checksum_valid(const uint8_t *data, uint32_t length, uint8_t checksum);
+fsp_err_t ads1263_read_adc1(int32_t *value, uint8_t *status, eeg_rdata_stats_t *stats);
+fsp_err_t ads1263_read_adc2(int32_t *value, uint8_t *status, eeg_rdata_stats_t *stats);
+fsp_err_t ads1263_read_monitors(float *temperature_c, float *avdd_v);
+
+/* Montage layer - EEG_MONTAGE routes across EEG_ADS1263_DEVICES */
+const ads1263_route_t *ads1263_montage_routes(void);
+int ads1263_montage_channel(uint8_t device, uint8_t adc);
+bool ads1263_montage_is_direct(void);
+float ads1263_montage_count_uv(uint32_t channel);
+int32_t ads1263_montage_clip_counts(uint32_t channel);
+uint32_t ads1263_montage_scan_depth(void);
+bool ads1263_montage_uses_adc2(void);
+fsp_err_t ads1263_configure_montage(void);
+fsp_err_t ads1263_verify_montage(void);
+uint32_t ads1263_montage_signature(void);
+fsp_err_t ads1263_start_montage(void);
+fsp_err_t ads1263_self_calibrate(void);
+fsp_err_t ads1263_read_montage(ads1263_montage_frame_t *frame, eeg_rdata_stats_t *stats);
+fsp_err_t ads1263_montage_image_value(uint8_t device, uint8_t reg, uint8_t *value);
+void ads1263_montage_borrow_adc2(int device);
+fsp_err_t ads1263_montage_apply_rate(void);
+uint32_t ads1263_montage_rate_bytes(uint8_t device, const eeg_rate_t *rate, uint8_t bytes[6]);
+
+#endif /* ADS1263_HAL_H */
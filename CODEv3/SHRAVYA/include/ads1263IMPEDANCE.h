@@ -0,0 +1,38 @@
+#ifndef ADS1263_IMPEDANCE_H
+#define ADS1263_IMPEDANCE_H
+
+#include "hal_data.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+
+/** One SPI transaction the scheduler needs sent in the gap after a conversion */
+typedef struct {
+    uint8_t device;           // ADS1263 index
+    uint8_t opcode;           // 0 = nothing to send, ADS1263_OP_WREG, or a command (START2/STOP2)
+    uint8_t reg;              // WREG start register
+    uint8_t count;            // WREG register count (1-2): MODE1, or ADC2CFG + ADC2MUX
+    uint8_t data[2];
+} ads1263_impedance_action_t;
+
+/** Latest background impedance per montage channel */
+typedef struct {
+    float kohms[EEG_CHANNELS];          // Electrode pair of the channel (MUXP and MUXN in series)
+    bool contact_good[EEG_CHANNELS];    // kohms < EEG_IMPEDANCE_CONTACT_KOHMS
+    bool measured[EEG_CHANNELS];        // At least one slot completed on the channel
+    uint32_t measurements;              // Completed slots, all channels
+    uint32_t timeouts;                  // Slots abandoned for lack of ADC2 conversions
+    uint32_t held_samples;              // Samples with a channel held for a slot
+    uint32_t bias_on_us;                // Total time the sensor bias has been on
+    uint8_t last_channel;               // Channel of the most recent measurement
+} ads1263_impedance_status_t;
+
+fsp_err_t ads1263_impedance_init(uint32_t now_us);
+uint32_t ads1263_impedance_hold_mask(void);
+void ads1263_impedance_feed_adc2(uint8_t device, int32_t code, uint32_t timestamp_us);
+bool ads1263_impedance_service(uint32_t now_us, ads1263_impedance_action_t *action);
+void ads1263_impedance_apply(const ads1263_impedance_action_t *action);
+uint32_t ads1263_impedance_action_bytes(const ads1263_impedance_action_t *action, uint8_t bytes[4]);
+void ads1263_impedance_count_held(uint32_t samples);
+const ads1263_impedance_status_t *ads1263_impedance_status(void);
+
+#endif /* ADS1263_IMPEDANCE_H */
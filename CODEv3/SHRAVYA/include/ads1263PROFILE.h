@@ -0,0 +1,57 @@
+#ifndef ADS1263_PROFILE_H
+#define ADS1263_PROFILE_H
+
+#include "hal_data.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+
+#define ADS1263_PROFILE_MAGIC   0x50524853u  // "SHRP"
+#define ADS1263_PROFILE_VERSION 1u           // Bump when ads1263_profile_t changes layout
+
+/** Version + CRC header in front of every stored profile */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;          // Payload bytes after the header
+    uint32_t crc32;           // CRC-32 (IEEE 802.3) of the payload
+} ads1263_profile_header_t;
+
+/** One ADS1263 as captured after a verified, calibrated bring-up */
+typedef struct {
+    uint8_t regs[ADS1263_REG_COUNT];  // Registers 0x00-0x1A: ID, image, OFCAL/FSCAL, ADC2OFC/ADC2FSC
+    uint8_t calibrated;               // OFCAL/ADC2OFC hold self-calibration results
+    float cal_temperature_c;          // Internal temperature sensor at calibration
+    float cal_avdd_v;                 // AVDD monitor at calibration
+} ads1263_device_profile_t;
+
+/** Everything a boot needs to resume sampling without probing or recalibrating */
+typedef struct {
+    ads1263_profile_header_t header;
+    uint32_t montage_signature;       // ads1263_montage_signature() the image belongs to
+    uint8_t spi_mode;                 // spi_communication_mode_t chosen for the FSP SPI paths
+    uint8_t device_count;             // EEG_ADS1263_DEVICES
+    ads1263_device_profile_t device[EEG_ADS1263_DEVICES];
+} ads1263_profile_t;
+
+/**
+ * @brief Non-volatile profile storage, one implementation per platform
+ * @note Firmware binds data flash (or .noinit RAM) in eegACQUISITION.c; the
+ *       host build binds a file.
+ */
+typedef struct {
+    const char *name;
+    fsp_err_t (*read)(void *data, uint32_t length);
+    fsp_err_t (*write)(const void *data, uint32_t length);
+} ads1263_profile_storage_t;
+
+void ads1263_profile_storage_register(const ads1263_profile_storage_t *storage);
+uint32_t ads1263_crc32(const void *data, uint32_t length);
+
+fsp_err_t ads1263_profile_load(ads1263_profile_t *profile);
+fsp_err_t ads1263_profile_save(ads1263_profile_t *profile);
+fsp_err_t ads1263_profile_invalidate(void);
+fsp_err_t ads1263_profile_capture(ads1263_profile_t *profile, uint32_t signature, uint8_t spi_mode);
+fsp_err_t ads1263_profile_restore(const ads1263_profile_t *profile);
+bool ads1263_profile_drifted(const ads1263_profile_t *profile);
+
+#endif /* ADS1263_PROFILE_H */
@@ -49,6 +49,9 @@ typedef struct {
     /* Signal Quality Features (2 features) */
     float snr_estimate;
     float signal_stability;
+
+    /* Flagged share of the window, averaged over channels (reported, not a network input) */
+    float artifact_ratio;
 } feature_vector_t;
 
 /* Function prototypes */
@@ -58,10 +61,13 @@ fsp_err_t get_feature_vector(feature_vector_t *features);
 extern fsp_err_t trigger_haptic_pattern(cognitive_state_type_t state);
 // Add these to cognitiveSTATES.h
 extern feature_vector_t current_features;
-extern void extract_frequency_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_time_domain_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_coherence_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_quality_features(const float *left_signal, const float *right_signal, int size);
+extern void extract_frequency_features(const float *const channels[], int channel_count, int size);
+extern void extract_wavelet_band_features(const float energy[][EEG_WAVELET_MAX_LEVELS + 1], int channel_count,
+                                          int levels);
+extern void extract_time_domain_features(const float *const channels[], int channel_count, int size);
+extern void extract_coherence_features(const float *const channels[], int channel_count, int size);
+extern void extract_quality_features(const float *const channels[], int channel_count, int size,
+                                     const float artifact_ratio[]);
 
 
 #endif /* COGNITIVE_STATES_H */
@@ -0,0 +1,35 @@
+#ifndef EEG_ARTIFACT_H
+#define EEG_ARTIFACT_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+#include "eegTYPES.h"
+#include "eegWINDOW.h"
+
+/* Per-sample artifact flags (eeg_window_t.mask) */
+#define EEG_ARTIFACT_AMPLITUDE  0x01U   // Too far from the channel's median
+#define EEG_ARTIFACT_GRADIENT   0x02U   // Step from the previous sample too large
+#define EEG_ARTIFACT_FLAT       0x04U   // Part of a flat run
+#define EEG_ARTIFACT_COMMON     0x08U   // Every channel out the same way at once
+#define EEG_ARTIFACT_EXCLUDED   0x10U   // Not EEG at acquisition (impedance hold, ADC clip), set on push
+
+/**
+ * Running robust statistics per channel, in robust standard deviations
+ * (1.4826 x MAD), so one window full of artifact cannot move the limits it
+ * is judged against: each window is flagged against the statistics of the
+ * windows before it, which then follow the window's own median/MAD with a
+ * EEG_ARTIFACT_ADAPT_S time constant.
+ */
+typedef struct {
+    float centre[EEG_CHANNELS];         // Running median (μV)
+    float spread[EEG_CHANNELS];         // Running robust SD of the samples
+    float step_spread[EEG_CHANNELS];    // Running robust SD of sample-to-sample steps
+    float adapt;                        // Weight of one window in the running statistics
+    uint32_t flat_samples;              // Flat run length that counts as an artifact
+    bool primed;                        // False until the first window
+} eeg_artifact_detector_t;
+
+void eeg_artifact_init(eeg_artifact_detector_t *detector, const eeg_rate_t *rate);
+uint32_t eeg_artifact_process(eeg_artifact_detector_t *detector, eeg_window_t *window, uint32_t fresh);
+
+#endif /* EEG_ARTIFACT_H */
@@ -0,0 +1,83 @@
+#ifndef EEG_BIQUAD_H
+#define EEG_BIQUAD_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+
+#if EEG_BIQUAD_CMSIS_DSP
+#include "arm_math.h"
+#endif
+
+#define EEG_BIQUAD_MAX_STAGES 8
+#define EEG_BIQUAD_MAX_LANES  8
+
+/** Lane width (2, 4 or 8) that holds @p channels, or the widest for more */
+#define EEG_BIQUAD_LANES_FOR(channels) (((channels) <= 2) ? 2 : (((channels) <= 4) ? 4 : 8))
+
+/**
+ * Cascade of biquad sections in Direct Form I, filtered a block at a time.
+ * Coefficients are stored per stage as {b0, b1, b2, -a1, -a2} and state as
+ * {x1, x2, y1, y2} - the CMSIS-DSP arm_biquad_cascade_df1_f32 layout, so
+ * both kernels run on the same struct.
+ */
+typedef struct {
+    uint32_t stages;
+    float coeffs[EEG_BIQUAD_MAX_STAGES * 5];
+    float state[EEG_BIQUAD_MAX_STAGES * 4];
+#if EEG_BIQUAD_CMSIS_DSP
+    arm_biquad_casd_df1_inst_f32 instance;
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    arm_biquad_mod_coef_f32 coeffs_mve[EEG_BIQUAD_MAX_STAGES];  // Helium layout, derived from coeffs
+#endif
+#endif
+} eeg_biquad_cascade_t;
+
+/**
+ * The same cascade run on several channels in lockstep, one channel per lane.
+ * Every lane shares one coefficient set; state is stored lane-parallel
+ * (row = {x1, x2, y1, y2} of a section, column = lane) and samples are
+ * frame-interleaved (input[i * lanes + lane]), so one sample step of all
+ * lanes is a handful of vector multiply-adds.
+ */
+typedef struct {
+    uint32_t stages;
+    uint32_t lanes;                     // 2, 4 or 8
+    float coeffs[EEG_BIQUAD_MAX_STAGES * 5];
+    float state[EEG_BIQUAD_MAX_STAGES * 4][EEG_BIQUAD_MAX_LANES];
+} eeg_biquad_lanes_t;
+
+/**
+ * The cascade in fixed point for builds that keep the filter off the FPU:
+ * Q31 samples in, coefficients in Q(31 - shift) (one shift for the whole
+ * cascade, from the largest coefficient), 64-bit accumulation. Each
+ * section's output history is kept in Q63 (the CMSIS-DSP
+ * arm_biquad_cas_df1_32x64_q31 scheme) - with the highpass poles this close
+ * to the unit circle the feedback would otherwise add Q31 rounding noise
+ * amplified by its gain. The last section scales straight to output units.
+ */
+typedef struct {
+    uint32_t stages;
+    uint32_t shift;                     // Coefficients are Q(31 - shift)
+    int32_t coeffs[EEG_BIQUAD_MAX_STAGES * 5];  // {b0, b1, b2, -a1, -a2} per stage
+    int32_t x_state[EEG_BIQUAD_MAX_STAGES * 2]; // {x1, x2} Q31
+    int64_t y_state[EEG_BIQUAD_MAX_STAGES * 2]; // {y1, y2} Q63
+    float output_scale;                 // Output units per Q31 full scale
+} eeg_biquad_q31_t;
+
+void eeg_biquad_init(eeg_biquad_cascade_t *cascade, uint32_t stages);
+void eeg_biquad_set_stage(eeg_biquad_cascade_t *cascade, uint32_t stage,
+                          float b0, float b1, float b2, float a1, float a2);
+void eeg_biquad_reset(eeg_biquad_cascade_t *cascade);
+void eeg_biquad_process(eeg_biquad_cascade_t *cascade, const float *input, float *output, uint32_t count);
+
+void eeg_biquad_lanes_init(eeg_biquad_lanes_t *bank, uint32_t stages, uint32_t lanes);
+void eeg_biquad_lanes_load(eeg_biquad_lanes_t *bank, const eeg_biquad_cascade_t *design);
+void eeg_biquad_lanes_reset(eeg_biquad_lanes_t *bank);
+void eeg_biquad_lanes_process(eeg_biquad_lanes_t *bank, const float *input, float *output, uint32_t count);
+
+void eeg_biquad_q31_init(eeg_biquad_q31_t *cascade);
+void eeg_biquad_q31_load(eeg_biquad_q31_t *cascade, const eeg_biquad_cascade_t *design, float output_scale);
+void eeg_biquad_q31_reset(eeg_biquad_q31_t *cascade);
+void eeg_biquad_q31_process(eeg_biquad_q31_t *cascade, int32_t *samples, float *output, uint32_t count);
+
+#endif /* EEG_BIQUAD_H */
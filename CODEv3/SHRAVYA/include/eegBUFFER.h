@@ -0,0 +1,32 @@
+#ifndef EEG_BUFFER_H
+#define EEG_BUFFER_H
+
+#include "hal_data.h"
+#include "eegTYPES.h"
+
+/* Samples the producer writes between two wakes of the consumer */
+#define EEG_BUFFER_TRIGGER_SAMPLES 64U
+
+/* Producer (acquisition task) */
+fsp_err_t eeg_buffer_init(const float *impedance_kohms);
+fsp_err_t eeg_buffer_write(const eeg_rdata_sample_t *sample);
+bool eeg_buffer_rate_switch_busy(void);
+void eeg_buffer_publish_rate_switch(const eeg_rate_t *rate);
+fsp_err_t eeg_buffer_request_record(bool enable);
+bool eeg_buffer_record_service(uint32_t now_us);
+
+/* Consumer (signal processing task) */
+uint32_t eeg_buffer_peek_spans(eeg_sample_span_t spans[2], uint32_t max_count);
+void eeg_buffer_commit_read(uint32_t count);
+bool eeg_buffer_take_rate_switch(uint32_t ring_index, eeg_rate_t *rate);
+bool eeg_buffer_peek_rate_switch(uint32_t *ring_index);
+fsp_err_t eeg_get_samples(eeg_raw_sample_t *samples, uint32_t count, uint32_t *samples_read);
+
+/* Either side */
+uint32_t eeg_buffer_timestamp_at(uint32_t ring_index);
+uint32_t eeg_buffer_sequence_at(uint32_t ring_index);
+const eeg_block_quality_t *eeg_buffer_get_block_quality(uint32_t ring_index);
+uint32_t eeg_buffer_get_overflow_count(void);
+uint32_t eeg_buffer_get_record_overruns(void);
+
+#endif /* EEG_BUFFER_H */
@@ -0,0 +1,46 @@
+#ifndef EEG_CODEC_H
+#define EEG_CODEC_H
+
+#include "hal_data.h"
+
+/*
+ * Lossless EEG frame codec - fixed polynomial prediction (orders 0-4) with
+ * partitioned Rice coding of the residual, after FLAC's fixed subframes.
+ *
+ *   frame    = u8 (samples - 1), then one subframe per channel, MSB-first
+ *              bit stream, zero-padded to a byte boundary
+ *   subframe = 3-bit type: 0-4 fixed order, 7 verbatim (24-bit samples)
+ *              fixed: Rice partitions of EEG_CODEC_PARTITION residuals, each
+ *              5-bit parameter k (31 = escape: 5-bit width, then zigzag
+ *              residuals of that width), then per residual: (u >> k) zeros,
+ *              a one, and the k low bits of u (u = zigzag(residual))
+ *
+ * Inputs are 24-bit two's complement values (the eegRECORD.h sample range).
+ * Prediction history carries over from frame to frame until
+ * eeg_codec_reset(); samples without enough history use the highest order
+ * they have, so a stream needs no warm-up samples.
+ */
+#define EEG_CODEC_MAX_CHANNELS   16
+#define EEG_CODEC_MAX_ORDER      4
+#define EEG_CODEC_MAX_SAMPLES    256       // Per frame (u8 sample count)
+#define EEG_CODEC_PARTITION      16        // Residuals per Rice parameter
+#define EEG_CODEC_SAMPLE_BITS    24
+
+/** Worst-case frame bytes: verbatim subframes plus the frame/type fields */
+#define EEG_CODEC_FRAME_BOUND(channels, samples) \
+    (1U + (((uint32_t) (channels) * (3U + (uint32_t) (samples) * EEG_CODEC_SAMPLE_BITS)) + 7U) / 8U)
+
+/** Prediction history of one stream (one recorder block, one uplink session) */
+typedef struct {
+    int32_t history[EEG_CODEC_MAX_CHANNELS][EEG_CODEC_MAX_ORDER]; // [0] = most recent
+    uint32_t history_count;        // Valid history samples, saturates at EEG_CODEC_MAX_ORDER
+    uint8_t channel_count;
+} eeg_codec_state_t;
+
+void eeg_codec_reset(eeg_codec_state_t *state, uint8_t channel_count);
+uint32_t eeg_codec_encode(eeg_codec_state_t *state, const int32_t *const channel[], uint32_t stride,
+                          uint32_t samples, uint8_t *out, uint32_t capacity);
+uint32_t eeg_codec_decode(eeg_codec_state_t *state, const uint8_t *in, uint32_t length,
+                          int32_t *out, uint32_t max_samples, uint32_t *samples);
+
+#endif /* EEG_CODEC_H */
@@ -0,0 +1,30 @@
+#ifndef EEG_DECIMATE_H
+#define EEG_DECIMATE_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+
+/**
+ * Polyphase FIR decimator between conditioning and the feature window:
+ * keeps every M-th sample of a windowed-sinc low-pass (M * taps-per-phase
+ * taps, cutoff at the output Nyquist) without computing the other M - 1.
+ * Phase p holds taps h[j * M + p] and sees every M-th input, so an output
+ * costs the full filter but each input only its EEG_DECIMATE_TAPS_PER_PHASE.
+ */
+typedef struct {
+    uint32_t factor;                    // M: input samples per output sample, 1 = pass-through
+    uint32_t phase;                     // Commutator: phase the next input goes to, output after phase 0
+    uint32_t position;                  // Newest entry of every delay line (0..taps-per-phase)
+    uint32_t flag_phase;                // eeg_decimate_flags() commutator, in step with phase
+    uint32_t flags_pending;             // Channel flags seen so far this output period
+    uint8_t flag_hold[EEG_CHANNELS];    // Outputs a flagged input still reaches through the FIR
+    float coeff[EEG_DECIMATE_MAX_FACTOR][EEG_DECIMATE_TAPS_PER_PHASE];    // coeff[p][j] = h[j * M + p]
+    float lines[EEG_CHANNELS][EEG_DECIMATE_MAX_FACTOR][2 * EEG_DECIMATE_TAPS_PER_PHASE];   // Written twice, read contiguously
+} eeg_decimator_t;
+
+void eeg_decimator_init(eeg_decimator_t *decimator, uint32_t factor);
+uint32_t eeg_decimate(eeg_decimator_t *decimator, const float (*in)[EEG_FILTER_BLOCK_SAMPLES],
+                      float (*out)[EEG_FILTER_BLOCK_SAMPLES], uint32_t channels, uint32_t count);
+uint32_t eeg_decimate_flags(eeg_decimator_t *decimator, const uint32_t *in, uint32_t *out, uint32_t count);
+
+#endif /* EEG_DECIMATE_H */
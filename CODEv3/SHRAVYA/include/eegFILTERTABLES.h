@@ -0,0 +1,25 @@
+#ifndef EEG_FILTER_TABLES_H
+#define EEG_FILTER_TABLES_H
+
+#include "hal_data.h"
+#include "eegBIQUAD.h"
+
+/**
+ * Conditioning cascade for one per-channel sample rate and mains frequency,
+ * designed offline by host/shravyaFILTERS.c (make -C host tables) into
+ * src/eegFILTERTABLES.c. Sections run in table order: highpass, lowpass,
+ * then the mains band-stop, which is left off once the mains canceller
+ * (eegMAINS.c) has taken over.
+ */
+typedef struct {
+    uint16_t sample_rate_hz;
+    uint8_t mains_hz;
+    uint8_t stages;
+    uint8_t mains_stages;               // Trailing band-stop sections of stages
+    float sos[EEG_BIQUAD_MAX_STAGES][5];  // {b0, b1, b2, a1, a2} per section, a0 = 1 (eeg_biquad_set_stage order)
+} eeg_filter_table_t;
+
+extern const eeg_filter_table_t eeg_filter_tables[];
+extern const uint32_t eeg_filter_table_count;
+
+#endif /* EEG_FILTER_TABLES_H */
@@ -0,0 +1,57 @@
+#ifndef EEG_MAINS_H
+#define EEG_MAINS_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+
+#define EEG_MAINS_MAX_HARMONICS 4       // One 4-float vector (eeg_mains_cancel)
+#define EEG_MAINS_CANDIDATES    2       // 50 Hz, 60 Hz
+#define EEG_MAINS_TONES         (EEG_MAINS_CANDIDATES * 3)  // Each candidate and a bin either side
+
+/**
+ * Local mains frequency from the first EEG_MAINS_DETECT_S seconds of input:
+ * Goertzel power at the 50 and 60 Hz aliases and at bins 2 Hz either side,
+ * over whole 1 s blocks (an integer number of cycles of every tone, so DC
+ * and the other tones do not leak in), summed over all channels. Pickup is
+ * a line well above its neighbours; broadband EEG is not.
+ */
+typedef struct {
+    uint32_t block_samples;             // One second at the current rate
+    uint32_t block_fill;
+    uint32_t blocks;
+    bool usable[EEG_MAINS_CANDIDATES];  // Alias and neighbours clear of DC/Nyquist and the other candidate
+    float coeff[EEG_MAINS_TONES];       // 2 cos(w): {candidate, below, above} per candidate
+    float s1[EEG_CHANNELS][EEG_MAINS_TONES];
+    float s2[EEG_CHANNELS][EEG_MAINS_TONES];
+    float origin[EEG_CHANNELS];         // First sample of the block, taken off every sample
+    float power[EEG_MAINS_TONES];
+} eeg_mains_detector_t;
+
+/**
+ * Adaptive sinusoidal-reference (LMS) canceller for the mains fundamental
+ * and harmonics: per channel and harmonic, a cos/sin weight pair is adapted
+ * so the weighted reference matches the interference, which is subtracted.
+ * One set of references (recursive oscillators) serves every channel.
+ */
+typedef struct {
+    uint32_t mains_hz;
+    uint32_t harmonics;                 // Harmonics whose alias is clear of DC/Nyquist
+    float step;                         // LMS step, sets the notch width
+    float coupling;                     // Sum of cos(w) over the harmonics: r[i-1] . r[i]
+    float rotate_cos[EEG_MAINS_MAX_HARMONICS];
+    float rotate_sin[EEG_MAINS_MAX_HARMONICS];
+    float ref_cos[EEG_MAINS_MAX_HARMONICS];
+    float ref_sin[EEG_MAINS_MAX_HARMONICS];
+    float alias_hz[EEG_MAINS_MAX_HARMONICS];
+    float weights_cos[EEG_CHANNELS][EEG_MAINS_MAX_HARMONICS];
+    float weights_sin[EEG_CHANNELS][EEG_MAINS_MAX_HARMONICS];
+} eeg_mains_canceller_t;
+
+void eeg_mains_detector_init(eeg_mains_detector_t *detector, uint32_t sample_rate_hz);
+uint32_t eeg_mains_detect(eeg_mains_detector_t *detector, const float uv[EEG_CHANNELS]);
+
+void eeg_mains_canceller_init(eeg_mains_canceller_t *canceller, uint32_t mains_hz, uint32_t sample_rate_hz);
+void eeg_mains_cancel(eeg_mains_canceller_t *canceller, float (*samples)[EEG_FILTER_BLOCK_SAMPLES],
+                      uint32_t channels, uint32_t count);
+
+#endif /* EEG_MAINS_H */
@@ -0,0 +1,37 @@
+#ifndef EEG_MEDIAN_H
+#define EEG_MEDIAN_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+
+/**
+ * Running percentile of the last `window` inputs (the median at 0.5): a
+ * max-heap of the inputs at or below the percentile and a min-heap of those
+ * above it, over slots of a ring that remembers arrival order. A new input
+ * overwrites the oldest slot wherever it sits in the heaps, so an update is
+ * a sift through one heap and at most one exchange of the two roots -
+ * O(log window), and the percentile is the low heap's root. With a
+ * decimation of D only every D-th input is taken: the window then spans
+ * window x D inputs at 1/D of the cost.
+ */
+typedef struct {
+    float value[EEG_MEDIAN_MAX_WINDOW];     // Ring of the inputs held
+    uint16_t low[EEG_MEDIAN_MAX_WINDOW];    // Max-heap of ring slots at or below the percentile
+    uint16_t high[EEG_MEDIAN_MAX_WINDOW];   // Min-heap of ring slots above it
+    int16_t where[EEG_MEDIAN_MAX_WINDOW];   // Slot -> heap position: k in high, -1 - k in low
+    uint16_t window;                        // Inputs the percentile is taken over
+    uint16_t count;                         // Inputs held, window once full
+    uint16_t next;                          // Slot the next input overwrites (the oldest once full)
+    uint16_t low_count;
+    uint16_t high_count;
+    float percentile;                       // 0..1
+    uint32_t decimation;                    // Inputs per update
+    uint32_t phase;                         // Inputs since the last update
+} eeg_median_tracker_t;
+
+fsp_err_t eeg_median_init(eeg_median_tracker_t *tracker, uint32_t window, float percentile, uint32_t decimation);
+void eeg_median_reset(eeg_median_tracker_t *tracker);
+bool eeg_median_push(eeg_median_tracker_t *tracker, float x);
+float eeg_median_value(const eeg_median_tracker_t *tracker);
+
+#endif /* EEG_MEDIAN_H */
@@ -0,0 +1,12 @@
+#ifndef EEG_RATE_H
+#define EEG_RATE_H
+
+#include "hal_data.h"
+#include "eegTYPES.h"
+
+fsp_err_t eeg_rate_describe(uint32_t requested_hz, uint32_t scan_depth, bool adc2_routed, eeg_rate_t *rate);
+fsp_err_t eeg_rate_select(uint32_t requested_hz, eeg_rate_t *rate);
+const eeg_rate_t *eeg_rate_get(void);
+uint32_t eeg_rate_sample_rates(uint32_t *rates, uint32_t max);
+
+#endif /* EEG_RATE_H */
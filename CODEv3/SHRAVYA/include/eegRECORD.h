@@ -0,0 +1,62 @@
+#ifndef EEG_RECORD_H
+#define EEG_RECORD_H
+
+#include "hal_data.h"
+
+/*
+ * Raw EEG recording format - fixed-size blocks, little-endian, shared by the
+ * firmware recorder (eegRECORDER.c) and the host decoder (host/eegDECODE.c).
+ *
+ *   [0]    header, EEG_RECORD_HEADER_BYTES (layout below, header CRC last)
+ *   [100]  payload, payload_bytes:
+ *          packed - sample_count x channel_count x 3 bytes, sample-interleaved,
+ *                   two's complement 24-bit little-endian
+ *          coded  - (EEG_RECORD_FLAG_CODED) eegCODEC.h frames back to back,
+ *                   prediction history reset at the start of the block
+ *   [...]  0xFF up to block_bytes (erased flash)
+ *
+ * ADC2 channels are stored as converted (24-bit). ADC1 channels keep the 24
+ * most significant bits of the 32-bit result; the decoder shifts them back.
+ */
+#define EEG_RECORD_MAGIC         0x52524853u  // "SHRR"
+#define EEG_RECORD_VERSION       2u           // Bump when the header layout changes
+#define EEG_RECORD_HEADER_BYTES  100u
+#define EEG_RECORD_MAX_CHANNELS  16u
+#define EEG_RECORD_SAMPLE_BYTES  3u
+
+/* Header flags */
+#define EEG_RECORD_FLAG_FIRST    0x01u        // First block of a session
+#define EEG_RECORD_FLAG_LAST     0x02u        // Closed by eeg_recorder_stop()
+#define EEG_RECORD_FLAG_RATE     0x04u        // Closed early by a sample-rate switch
+#define EEG_RECORD_FLAG_CODED    0x08u        // Payload is eegCODEC frames, not packed samples
+
+/** Decoded block header (on-media offsets in the comments) */
+typedef struct {
+    uint32_t magic;                 // 0
+    uint16_t version;               // 4
+    uint16_t header_bytes;          // 6
+    uint32_t block_bytes;           // 8   Block size on the medium
+    uint32_t session_id;            // 12  Same for every block of one recording
+    uint32_t block_sequence;        // 16  Blocks since the session started
+    uint32_t first_sample;          // 20  Samples recorded before this block (gap check)
+    uint32_t first_sequence;        // 24  Acquisition sequence number of the first sample
+    uint32_t timestamp_us;          // 28  DRDY timestamp of the first sample
+    uint32_t sample_rate_hz;        // 32  Per-channel rate of every sample in the block
+    uint16_t sample_count;          // 36
+    uint8_t channel_count;          // 38
+    uint8_t flags;                  // 39  EEG_RECORD_FLAG_*
+    uint8_t channel_map[EEG_RECORD_MAX_CHANNELS][3]; // 40 {device, adc, mux} per channel
+    uint32_t payload_bytes;         // 88  Payload length
+    uint32_t payload_crc32;         // 92  CRC-32 of the payload
+    uint32_t header_crc32;          // 96  CRC-32 of bytes 0-95
+} eeg_record_header_t;
+
+uint32_t eeg_record_crc32(uint32_t crc, const void *data, uint32_t length);
+void eeg_record_header_encode(const eeg_record_header_t *header, uint8_t bytes[EEG_RECORD_HEADER_BYTES]);
+fsp_err_t eeg_record_header_decode(const uint8_t *bytes, eeg_record_header_t *header);
+fsp_err_t eeg_record_block_check(const uint8_t *block, uint32_t length, eeg_record_header_t *header);
+void eeg_record_pack24(uint8_t *out, int32_t value);
+int32_t eeg_record_unpack24(const uint8_t *in);
+fsp_err_t eeg_record_block_samples(const uint8_t *block, const eeg_record_header_t *header, int32_t *values);
+
+#endif /* EEG_RECORD_H */
@@ -0,0 +1,61 @@
+#ifndef EEG_RECORDER_H
+#define EEG_RECORDER_H
+
+#include "hal_data.h"
+#include "eegTYPES.h"
+#include "eegRECORD.h"
+#include "eegCODEC.h"
+#include "shravyaCONFIG.h"
+
+#if (EEG_CHANNELS > EEG_RECORD_MAX_CHANNELS)
+#error "EEG_CHANNELS exceeds the channel map of the recording format"
+#endif
+#if EEG_RECORDER_COMPRESSION && ((EEG_RECORDER_FRAME_SAMPLES < 1) || (EEG_RECORDER_FRAME_SAMPLES > EEG_CODEC_MAX_SAMPLES))
+#error "EEG_RECORDER_FRAME_SAMPLES must be 1..EEG_CODEC_MAX_SAMPLES"
+#endif
+
+/* Samples that fit one packed (uncoded) block after the header */
+#define EEG_RECORDER_BLOCK_SAMPLES ((EEG_RECORDER_BLOCK_BYTES - EEG_RECORD_HEADER_BYTES) / \
+                                    (EEG_CHANNELS * EEG_RECORD_SAMPLE_BYTES))
+
+/** Recording medium - a region addressed from 0, erased in erase_bytes units */
+typedef struct {
+    const char *name;
+    uint32_t capacity_bytes;                                            // Region size (whole blocks)
+    uint32_t erase_bytes;                                               // Erase unit, multiple of the block size
+    fsp_err_t (*erase)(uint32_t offset);                                // Erase one unit at offset
+    fsp_err_t (*program)(uint32_t offset, const void *data, uint32_t length); // Program erased bytes
+} eeg_recorder_storage_t;
+
+/** Where the samples handed to eeg_recorder_append() came from */
+typedef struct {
+    uint32_t (*timestamp_at)(uint32_t ring_index);  // DRDY timestamp of a sample
+    uint32_t (*sequence_at)(uint32_t ring_index);   // Acquisition sequence number of a sample
+} eeg_recorder_source_t;
+
+typedef struct {
+    uint32_t session_id;
+    uint32_t blocks_written;        // Blocks programmed since start
+    uint32_t samples_written;       // Samples in those blocks
+    uint32_t samples_packed;        // Samples accepted by eeg_recorder_append()
+    uint32_t payload_bytes_written; // Payload bytes of the written blocks (coded or packed)
+    uint32_t write_errors;          // Erase/program failures (recording stops at the first)
+    uint32_t buffer_stalls;         // Appends refused because both block buffers were queued
+    uint32_t max_write_us;          // Longest eeg_recorder_write_pending() (caller-measured)
+    uint32_t wraps;                 // Times the circular region restarted at offset 0
+} eeg_recorder_stats_t;
+
+void eeg_recorder_storage_register(const eeg_recorder_storage_t *storage);
+const eeg_recorder_storage_t *eeg_recorder_storage_get(void);
+fsp_err_t eeg_recorder_start(uint32_t session_id, const eeg_rate_t *rate, const eeg_recorder_source_t *source);
+bool eeg_recorder_stop(void);
+bool eeg_recorder_active(void);
+bool eeg_recorder_idle(void);
+uint32_t eeg_recorder_space(void);
+uint32_t eeg_recorder_append(const eeg_sample_span_t *span, bool *block_ready);
+bool eeg_recorder_set_rate(const eeg_rate_t *rate);
+bool eeg_recorder_write_pending(void);
+void eeg_recorder_note_write_time(uint32_t elapsed_us);
+const eeg_recorder_stats_t *eeg_recorder_get_stats(void);
+
+#endif /* EEG_RECORDER_H */
@@ -7,48 +7,104 @@
 
 /* EEG Signal Quality Structure */
 typedef struct {
-    float impedance_left_kohms;
-    float impedance_right_kohms;
+    float impedance_kohms[EEG_CHANNELS];   // Per-channel electrode impedance
     bool contact_quality_good;
     uint8_t signal_noise_level;
     float common_mode_voltage;
-    float signal_amplitude_left_uv;        // Left channel amplitude in microvolts
-        float signal_amplitude_right_uv;       // Right channel amplitude in microvolts
-        bool electrode_contact_good_left;      // Left electrode contact quality
-        bool electrode_contact_good_right;     // Right electrode contact quality
+    float signal_amplitude_uv[EEG_CHANNELS];       // Per-channel amplitude in microvolts
+        bool electrode_contact_good[EEG_CHANNELS];     // Per-channel electrode contact quality
         bool signal_saturated;                 // Signal saturation flag
         uint8_t data_integrity_score;          // Overall data integrity (0-100%)
         uint32_t samples_processed;            // Number of samples processed
         uint32_t artifacts_detected;          // Artifact count
 } eeg_signal_quality_t;
 
-/* EEG Raw Data Structure */
+/* EEG Raw Data Structure (quality is kept per ring block, see eeg_block_quality_t) */
 typedef struct {
-    int32_t left_channel;     // Left electrode raw ADC value
-    int32_t right_channel;    // Right electrode raw ADC value
+    int32_t channel[EEG_CHANNELS];  // Raw ADC value per montage channel (EEG_MONTAGE order)
     int32_t drl_feedback;     // DRL circuit feedback
     uint32_t timestamp_us;    // Microsecond timestamp
-    eeg_signal_quality_t quality;
 } eeg_raw_sample_t;
 
-/* EEG Circular Buffer */
+/* Quality summary for one block of EEG_QUALITY_BLOCK_SAMPLES samples */
 typedef struct {
-    eeg_raw_sample_t samples[EEG_BUFFER_SIZE_SAMPLES];
-    uint32_t write_index;
-    uint32_t read_index;
-    bool buffer_full;
-    void* buffer_mutex;       // μT-Kernel mutex
-} eeg_circular_buffer_t;
+    float impedance_kohms[EEG_CHANNELS];  // Latest impedance when the block was opened
+    int32_t channel_min[EEG_CHANNELS];    // Raw count range across the block
+    int32_t channel_max[EEG_CHANNELS];
+    uint16_t saturated_samples;      // Samples beyond the saturation threshold
+    uint16_t sequence_gaps;          // Samples whose sequence step was not 1
+    uint16_t impedance_held_samples; // Samples with a channel held for a background impedance slot
+    uint8_t min_integrity_score;     // Worst per-sample integrity score (0-100%)
+    bool contact_good[EEG_CHANNELS]; // Amplitude and latest impedance good for every sample in the block
+} eeg_block_quality_t;
+
+/* Per-block metadata - timestamps and sequence numbers delta-encoded from a block base */
+typedef struct {
+    uint32_t base_timestamp_us;                              // Timestamp of the first sample
+    uint32_t base_sequence;                                  // Sequence number of the first sample
+    uint16_t timestamp_delta_us[EEG_QUALITY_BLOCK_SAMPLES];  // Step from previous sample (saturating)
+    uint8_t sequence_delta[EEG_QUALITY_BLOCK_SAMPLES];       // Step from previous sample (1 = contiguous)
+    eeg_block_quality_t quality;
+} eeg_block_meta_t;
+
+/* EEG Sample Ring - lock-free single producer (acquisition) / single consumer (processing)
+ * Channel-major storage so filter loops stream contiguous int32 arrays. The recorder
+ * reads a second cursor from the producer task, so it never holds back processing. */
+#if (EEG_BUFFER_SIZE_SAMPLES & (EEG_BUFFER_SIZE_SAMPLES - 1)) != 0
+#error "EEG_BUFFER_SIZE_SAMPLES must be a power of two"
+#endif
+#if ((EEG_QUALITY_BLOCK_SAMPLES & (EEG_QUALITY_BLOCK_SAMPLES - 1)) != 0) || \
+    (EEG_QUALITY_BLOCK_SAMPLES > EEG_BUFFER_SIZE_SAMPLES)
+#error "EEG_QUALITY_BLOCK_SAMPLES must be a power of two no larger than the ring"
+#endif
+#define EEG_BUFFER_INDEX_MASK (EEG_BUFFER_SIZE_SAMPLES - 1U)
+#define EEG_BUFFER_BLOCKS (EEG_BUFFER_SIZE_SAMPLES / EEG_QUALITY_BLOCK_SAMPLES)
+
+typedef struct {
+    int32_t channel[EEG_CHANNELS][EEG_BUFFER_SIZE_SAMPLES];
+    int32_t drl[EEG_BUFFER_SIZE_SAMPLES];
+    uint32_t excluded[EEG_BUFFER_SIZE_SAMPLES];     // Bit n: channel n is not EEG this sample (impedance hold, ADC clip)
+    eeg_block_meta_t blocks[EEG_BUFFER_BLOCKS];
+    volatile uint32_t write_index;     // Free-running, published by producer (release)
+    volatile uint32_t read_index;      // Free-running, published by consumer (release)
+    volatile uint32_t overflow_count;  // Samples dropped because the ring was full
+    uint32_t record_index;             // Free-running recorder cursor (producer task only)
+    uint32_t record_overruns;          // Samples overwritten before the recorder packed them
+} eeg_sample_ring_t;
+
+/* Contiguous read-only view into the sample ring (zero-copy reads) */
+typedef struct {
+    const int32_t *channel[EEG_CHANNELS];
+    const int32_t *drl;
+    const uint32_t *excluded;          // Per-sample channel bits, as eeg_sample_ring_t.excluded
+    uint32_t count;
+    uint32_t first_index;              // Free-running ring index of element 0
+} eeg_sample_span_t;
+
+/* Sample rate descriptor - one ADS1263 data rate and everything derived from it (eegRATE.c) */
+typedef struct {
+    uint32_t adc1_sps;                 // ADC1 data rate (MODE2 DR)
+    uint32_t adc2_sps;                 // ADC2 data rate (ADC2CFG DR2), at least the per-channel rate with an ADC2 route
+    uint8_t mode2_dr;                  // MODE2 DR[3:0] code
+    uint8_t adc2cfg_dr;                // ADC2CFG DR2[1:0] code (register bits 7:6)
+    uint32_t sample_rate_hz;           // Per-channel rate: ADC1 rate / INPMUX scan depth
+    uint32_t sample_interval_us;       // 1 / sample_rate_hz
+    uint32_t decimation;               // Samples per window sample (eegDECIMATE.c), 1 = none
+    uint32_t window_rate_hz;           // Rate of window samples: sample_rate_hz / decimation
+    uint32_t window_samples;           // Feature window in window samples, power of two near EEG_WINDOW_SECONDS
+    uint32_t hop_samples;              // Window advance in window samples (EEG_WINDOW_HOP_FRACTION)
+    float bin_hz;                      // Spectral bin spacing of one window
+} eeg_rate_t;
 
 /* Enhanced EEG Raw Sample with RDATA metadata */
 typedef struct {
-    int32_t left_channel;           // Left electrode from ADS1263 RDATA
-    int32_t right_channel;          // Right electrode from ADS1263 RDATA
+    int32_t channel[EEG_CHANNELS];  // Montage channels from ADS1263 RDATA
     int32_t drl_feedback;           // DRL reference electrode
     uint32_t timestamp_us;          // Microsecond timestamp
     uint32_t sequence_number;       // Sample sequence number
     bool data_valid;                // Data integrity flag
     uint32_t data_checksum;         // CRC32 for integrity
+    uint32_t held_mask;             // Bit n: channel n holds its last value (impedance slot)
     eeg_signal_quality_t quality;   // Signal quality assessment
 } eeg_rdata_sample_t;
 
@@ -58,8 +114,19 @@ typedef struct {
     uint32_t samples_dropped;       // Dropped due to errors
     uint32_t retry_attempts;        // Communication retry count
     uint32_t sequence_errors;       // Sequence number mismatches
-    uint32_t checksum_errors;       // Data integrity failures
-    float acquisition_rate_sps;     // Actual sampling rate achieved
+    uint32_t checksum_errors;       // RDATA frames whose ADS1263 checksum byte did not match
+    uint32_t checksum_failures;     // Reads given up after every retry failed its checksum
+    uint32_t stale_reads;           // Reads whose status byte reported no new conversion
+    uint32_t channel_holds;         // Channel reads that failed and held the last good value
+    float acquisition_rate_sps;     // Actual sampling rate achieved (1 s window)
+    float interval_jitter_us;       // RMS deviation of sample interval from nominal
+    float max_interval_jitter_us;   // Worst |interval - nominal| since start
+    uint32_t missed_conversions;    // DRDY edges with no read before the next conversion
+    float drdy_interval_mean_us;    // Running mean of DRDY-to-DRDY timestamp interval
+    float drdy_interval_max_dev_us; // Worst |interval - nominal| between captured timestamps
+    uint32_t drdy_gap_missed_samples; // Samples missing according to timestamp gaps
+    uint32_t boot_to_first_sample_us; // eeg_acquisition_init() entry to first conversion
+    bool hardware_timestamps;       // Timestamps come from GPT input capture
     bool hardware_responsive;       // ADS1263 responding to RDATA
 } eeg_rdata_stats_t;
 
@@ -0,0 +1,31 @@
+#ifndef EEG_WAVELET_H
+#define EEG_WAVELET_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+
+/**
+ * Discrete wavelet transform of one window channel, in place: CDF 9/7
+ * lifting, level after level on the approximation left by the one before.
+ * Coefficients stay interleaved where the lifting left them - level j's
+ * details at odd multiples of 2^(j-1), the final approximation at multiples
+ * of 2^levels - so no level needs a second buffer. Detail level j holds
+ * rate / 2^(j+1) .. rate / 2^j; level energies index energy[j - 1] for D_j
+ * and energy[levels] for the approximation.
+ */
+typedef struct {
+    uint32_t samples;                   // Window length (power of two)
+    uint32_t levels;                    // Detail levels, 1..EEG_WAVELET_MAX_LEVELS
+    uint32_t noise_level;               // Level the denoising threshold is measured on, 0 = D_1
+    float rate_hz;                      // Window rate the octave edges follow
+} eeg_wavelet_plan_t;
+
+fsp_err_t eeg_wavelet_plan(eeg_wavelet_plan_t *plan, uint32_t samples, uint32_t rate_hz);
+void eeg_wavelet_forward(const eeg_wavelet_plan_t *plan, float *x);
+void eeg_wavelet_inverse(const eeg_wavelet_plan_t *plan, float *x);
+float eeg_wavelet_process(const eeg_wavelet_plan_t *plan, float *x, float energy[EEG_WAVELET_MAX_LEVELS + 1],
+                          bool denoise);
+void eeg_wavelet_band_power(const eeg_wavelet_plan_t *plan, const float energy[EEG_WAVELET_MAX_LEVELS + 1],
+                            const float band_edges_hz[][2], uint32_t bands, float power[]);
+
+#endif /* EEG_WAVELET_H */
@@ -0,0 +1,57 @@
+#ifndef EEG_WINDOW_H
+#define EEG_WINDOW_H
+
+#include "hal_data.h"
+#include "shravyaCONFIG.h"
+#include "eegTYPES.h"
+#include "semaphoresGLOBAL.h"
+
+/**
+ * One feature window, owned by exactly one side at a time: signal processing
+ * while it fills, then whoever took it from the ready mailbox until it is
+ * released back to the free mailbox. Nothing writes it while it is handed
+ * out, so feature extraction never sees it change underneath it.
+ */
+typedef struct {
+    T_MSG message;                      // Mailbox link - must stay first
+    eeg_rate_t rate;                    // Rate the samples were produced at (window_samples, window_rate_hz)
+    uint32_t sequence;                  // Which window since the last restart: 1, 2, ... (gaps = skipped)
+    uint32_t fill;                      // Samples written, rate.window_samples once handed out
+    float channel[EEG_CHANNELS][EEG_WINDOW_MAX_SAMPLES];    // Oldest first, flagged samples repaired
+    uint8_t mask[EEG_CHANNELS][EEG_WINDOW_MAX_SAMPLES];     // EEG_ARTIFACT_* flags per sample, 0 = clean
+    float artifact_ratio[EEG_CHANNELS]; // Flagged fraction of each channel
+    uint32_t wavelet_levels;            // Detail levels in wavelet_energy, 0 = no wavelet stage
+    float wavelet_energy[EEG_CHANNELS][EEG_WAVELET_MAX_LEVELS + 1];   // D_1..D_levels, approximation (eegWAVELET.c)
+} eeg_window_t;
+
+/**
+ * Overlapping windows over the window-rate samples: a window opens every hop
+ * samples and each sample is written into every open one, so a window is
+ * complete the moment its last sample arrives; the producer posts it once it
+ * has finished with it (artifact repair, eegARTIFACT.c; wavelet denoising,
+ * eegWAVELET.c). A free buffer is taken from the free mailbox when a window
+ * opens; with none free (the consumer is holding them all) that window is
+ * skipped, never overwritten.
+ */
+typedef struct {
+    eeg_window_t windows[EEG_WINDOW_POOL_DEPTH];
+    ID ready_mailbox;                   // Filled windows, oldest first
+    ID free_mailbox;                    // Windows given back by the consumer
+    eeg_rate_t rate;
+    uint32_t until_open;                // Samples to the next window start
+    uint32_t sequence;                  // Windows opened (or skipped) since the last restart
+    uint32_t completed;                 // Windows posted since the last restart
+    uint32_t skipped;                   // Windows dropped for want of a free buffer, since init
+    eeg_window_t *open[EEG_WINDOW_POOL_DEPTH];  // Filling, oldest first
+    uint32_t open_count;
+} eeg_window_pool_t;
+
+fsp_err_t eeg_window_pool_init(eeg_window_pool_t *pool, ID ready_mailbox, ID free_mailbox);
+fsp_err_t eeg_window_pool_restart(eeg_window_pool_t *pool, const eeg_rate_t *rate);
+eeg_window_t *eeg_window_push(eeg_window_pool_t *pool, const float sample[EEG_CHANNELS],
+                              const uint8_t mask[EEG_CHANNELS]);
+void eeg_window_post(eeg_window_pool_t *pool, eeg_window_t *window);
+eeg_window_t *eeg_window_receive(eeg_window_pool_t *pool, INT tmout);
+void eeg_window_release(eeg_window_pool_t *pool, eeg_window_t *window);
+
+#endif /* EEG_WINDOW_H */
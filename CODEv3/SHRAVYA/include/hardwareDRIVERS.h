@@ -4,6 +4,7 @@
 #include "hal_data.h"
 #include "eegTYPES.h"
 #include "semaphoresGLOBAL.h"
+#include "eegBUFFER.h"
 #define ADS1263_CS_PIN BSP_IO_PORT_04_PIN_13   /* P413 - Manual CS control */
 #define ADS1263_SCLK_PIN BSP_IO_PORT_04_PIN_12 /* P412 - SPI0_RSPCK */
 #define ADS1263_MOSI_PIN BSP_IO_PORT_04_PIN_11 /* P411 - SPI0_MOSI */
@@ -18,12 +19,21 @@ typedef int INT;
 
 /* EEG Acquisition Functions */
 fsp_err_t eeg_acquisition_init(void);
-fsp_err_t eeg_get_samples(eeg_raw_sample_t *samples, uint32_t count, uint32_t *samples_read);
 void eeg_get_statistics(uint32_t *total_samples, uint32_t *error_count, bool *is_running);
+void eeg_get_rdata_statistics(eeg_rdata_stats_t *stats);
+void eeg_acquisition_set_continuous(bool continuous);
+void eeg_acquisition_stop(void);
+fsp_err_t eeg_acquisition_set_sample_rate(uint32_t requested_hz);
+fsp_err_t eeg_acquisition_record(bool enable);
+void task_eeg_recorder_entry(INT stacd, void *exinf);
+fsp_err_t eeg_acquisition_run_diagnostics(void);
 
 /* ✅ FIXED: External interrupt callback - uses SDK type */
 void ads1263_drdy_callback(external_irq_callback_args_t *p_args);
 
+/* SPI transfer-complete hook for DRDY-chained RDATA frames (called from spi_callback) */
+void ads1263_spi_transfer_callback(spi_callback_args_t *p_args);
+
 /* Session Control Functions */
 fsp_err_t trigger_session_start(void);
 fsp_err_t trigger_session_end(void);
@@ -16,6 +16,21 @@ typedef int ID;
 #ifndef E_OK
 #define E_OK (0)
 #endif
+#ifndef TMO_POL
+#define TMO_POL (0)                     // Polling (no wait)
+#endif
+#ifndef TMO_FEVR
+#define TMO_FEVR (-1)                   // Wait forever
+#endif
+
+/* Mailbox message header - the first member of every message; the kernel links
+ * queued messages through it, so a message is only touched by its current owner */
+typedef struct t_msg {
+    void *msgque[1];
+} T_MSG;
+
+extern ER tk_snd_mbx(ID mbxid, T_MSG *pk_msg);
+extern ER tk_rcv_mbx(ID mbxid, T_MSG **ppk_msg, INT tmout);
 
 /* ✅ Global SHRAVYA Semaphore Declarations - TRON Contest Architecture */
 extern ID eeg_data_semaphore;
@@ -23,10 +38,14 @@ extern ID preprocessing_semaphore;
 extern ID feature_extraction_semaphore;
 extern ID classification_semaphore;
 extern ID haptic_semaphore;
-extern ID processed_semaphore;
 extern ID features_ready_semaphore;    // Signal processing → Feature extraction
 extern ID classification_ready_semaphore; // Feature extraction → AI classification
 extern ID feedback_ready_semaphore;   // AI classification → Haptic + N8N
+extern ID recorder_semaphore;         // Acquisition → recorder writer (block queued)
+
+/* Global Mailboxes - feature windows passed by pointer (eegWINDOW.h) */
+extern ID window_ready_mailbox;       // Signal processing → feature extraction (filled windows)
+extern ID window_free_mailbox;        // Feature extraction → signal processing (windows given back)
 
 /* ✅ SHRAVYA System Initialization Function */
 ER initialize_global_semaphores(void);
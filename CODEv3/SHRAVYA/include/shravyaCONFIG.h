@@ -6,16 +6,124 @@
 #define SYSTEM_CLOCK_FREQ_HZ 480000000 // 480MHz
 
 /* ✅ PHASE 1: RDATA Configuration */
-#define EEG_SAMPLE_RATE_HZ 2000         // 2kHz for rich EEG data
-#define EEG_CHANNELS 2                  // Dual channel (left/right)
-#define EEG_BUFFER_SIZE_SAMPLES 16384   // 8 seconds circular buffer at 2kHz
-#define EEG_PROCESSING_WINDOW 4096      // 2 second processing window
+#define EEG_SAMPLE_RATE_HZ 400          // Boot per-channel rate, see eegRATE.c (runtime: eeg_acquisition_set_sample_rate)
+#ifndef EEG_CHANNELS                    // Montage may be overridden per build (host: make MONTAGE=...)
+#define EEG_CHANNELS 2                  // Montage channels (see EEG_MONTAGE)
+#endif
+#define EEG_BUFFER_SIZE_SAMPLES 16384   // Ring depth in samples (seconds = this / eeg_rate_get()->sample_rate_hz)
+#define EEG_WINDOW_SECONDS 0.5f         // Feature window target, rounded to a power of two in samples
+#define EEG_WINDOW_HOP_FRACTION 0.5f    // Window advance as a fraction of its length (0.5 = 50% overlap, 1 = none)
+#define EEG_WINDOW_MIN_SAMPLES 64       // Feature window bounds (sizes the processing/DFT buffers)
+#define EEG_WINDOW_MAX_SAMPLES 1024
+#define EEG_WINDOW_POOL_DEPTH 4         // Window buffers: > 1/EEG_WINDOW_HOP_FRACTION, so one is left for feature extraction
+#define EEG_DECIMATED_RATE_HZ 200       // Window rate floor: features run at rate / M, the largest M keeping this (0 = full rate)
+#define EEG_DECIMATE_MAX_FACTOR 8       // Largest M (sizes the polyphase delay lines, eegDECIMATE.c)
+#define EEG_DECIMATE_TAPS_PER_PHASE 12  // FIR taps per phase: flat to ~0.27x, -74 dB from ~0.73x the window rate
+#define EEG_QUALITY_BLOCK_SAMPLES 64    // Ring block: one quality summary + timestamp/sequence base
+
+/* Signal Conditioning (signalPROCESSING.c) */
+#define EEG_FILTER_BLOCK_SAMPLES 32     // Ring samples per pass through the biquad cascade
+#define EEG_BIQUAD_CMSIS_DSP 0          // 1 = arm_biquad_cascade_df1_f32 (needs the CMSIS-DSP pack; Helium on the M85)
+#define EEG_FILTER_Q31 0                // 1 = Q31 cascade on raw ADC counts, no FPU in the filter (low-power build)
+#define EEG_MAINS_HZ 50                 // Mains frequency (50 or 60) until detection decides, and if it cannot
+#define EEG_MAINS_DETECT_S 4            // Seconds of input the 50/60 Hz detector listens to (eegMAINS.c)
+#define EEG_MAINS_HARMONICS 3           // Mains multiples the adaptive canceller tracks (fundamental = 1, max 4)
+#define EEG_MAINS_BANDWIDTH_HZ 1.0f     // Canceller notch width per harmonic; adapts in ~1/(pi * width) s
+#define EEG_BASELINE_WINDOW_S 2.0f      // Running-median baseline span, taken off the filtered signal (eegMEDIAN.c)
+#define EEG_BASELINE_UPDATE_HZ 50       // Baseline takes one sample in rate / this (decimated update)
+#define EEG_MEDIAN_MAX_WINDOW 128       // Running median length bound (sizes eeg_median_tracker_t, <= 32767)
+
+/* Artifact Detection (eegARTIFACT.c) - per window, against running median/MAD */
+#define EEG_ARTIFACT_AMPLITUDE_UV 100.0f    // Conditioning's soft-limit knee: nothing past it is EEG
+#define EEG_ARTIFACT_AMPLITUDE_Z 6.0f       // |x - median| beyond this many robust SDs
+#define EEG_ARTIFACT_GRADIENT_Z 8.0f        // Sample-to-sample step beyond this many robust SDs of the steps
+#define EEG_ARTIFACT_COMMON_Z 3.0f          // Every channel this far out with the same sign = common mode
+#define EEG_ARTIFACT_FLAT_UV 0.05f          // Steps below this ...
+#define EEG_ARTIFACT_FLAT_S 0.1f            // ... for this long = flat line (lifted or railed electrode)
+#define EEG_ARTIFACT_ADAPT_S 10.0f          // Running median/MAD time constant
+#define EEG_ARTIFACT_MAX_RATIO 0.2f         // Windows with more flagged are reported as artifact-laden
+
+/* Wavelet Stage (eegWAVELET.c) - CDF 9/7 lifting DWT over each window, after artifact repair */
+#define EEG_WAVELET_DENOISE 1               // 1 = shrink the details of every window before it is posted
+#define EEG_WAVELET_BAND_POWER 0            // 1 = band powers from the wavelet level energies instead of the DFT bins
+#define EEG_WAVELET_MAX_LEVELS 7            // Deepest decomposition (sizes eeg_window_t.wavelet_energy)
+#define EEG_WAVELET_APPROX_HZ 4.0f          // Decompose until the approximation lies below this (top of delta)
+#define EEG_WAVELET_NOISE_HZ 45.0f          // Noise is measured on the finest details reaching below this (conditioning lowpass)
 
 /* ADS1263 RDATA Configuration */
 #define ADS1263_RDATA_MODE_ENABLED 1    // Enable direct RDATA mode
 #define ADS1263_RDATA_TIMEOUT_MS 10     // Max wait for RDATA
 #define ADS1263_RETRY_COUNT 3           // Hardware retry attempts
-#define ADS1263_SAMPLE_INTERVAL_US 500  // 500μs = 2000 SPS
+
+/* ADS1263 Boot Timing - datasheet minimums; START waits on DRDY, not a fixed delay */
+#define ADS1263_POWERUP_MS 9            // 2^16 tCLK (7.3728MHz) from supply ramp to first SPI command
+#define ADS1263_RESET_SETTLE_MS 1       // RESET opcode to register access (a few tCLK, rounded up)
+#define ADS1263_FIRST_DRDY_TIMEOUT_MS 250 // START to first conversion, covers sinc3 settling at the slowest image rate
+#define EEG_BOOT_DIAGNOSTICS 0          // 1 = pin tests, register read-back and test read on every boot
+#define ADS1263_CAL_TIMEOUT_MS 2000     // SFOCAL1 to DRDY (averages several conversions at the image rate)
+#define ADS1263_MONITOR_TIMEOUT_MS 20   // One ADC2 temperature/AVDD conversion at 800 SPS
+
+/* ADS1263 Profile (calibration + SPI mode + register image, version/CRC header) */
+#define EEG_PROFILE_FLASH_ENABLED 1     // Data flash via r_flash_hp g_flash0 when configured, else .noinit RAM
+#define EEG_PROFILE_FLASH_OFFSET 0      // Byte offset into data flash (64-byte erase blocks)
+#define EEG_CAL_DRIFT_TEMPERATURE_C 5.0f // Recalibrate when the die moved this far from the stored calibration
+#define EEG_CAL_DRIFT_AVDD_V 0.10f      // ... or AVDD moved this far
+
+/* Background Electrode Impedance (opt-in) - MODE1 sensor bias through one electrode pair at a time,
+ * read on ADC2 at 800 SPS between ADC1 conversions; the measured (and lent ADC2) channel holds its
+ * last value and is excluded from processing */
+#define EEG_IMPEDANCE_ENABLED 0         // 1 = background slots while streaming; 0 = impedance only from eeg_acquisition_run_diagnostics()
+#define EEG_IMPEDANCE_SLOT_INTERVAL_MS 1000 // Between slot starts, one channel per slot, round robin (refresh = EEG_CHANNELS x interval)
+#define EEG_IMPEDANCE_BIAS_MAG 0x02     // MODE1 SBMAG code: 2 µA (0x01 = 0.5 µA, 0x03 = 10 µA; larger codes do not build)
+#define EEG_IMPEDANCE_BIAS_UA 2.0f      // Current selected by EEG_IMPEDANCE_BIAS_MAG
+#define EEG_IMPEDANCE_BIAS_MAX_MS 15    // Sensor bias switched off at the first gap after this, measurement or not
+#define EEG_IMPEDANCE_MAX_DUTY_PERCENT 2 // Bias on-time cap: build check against the interval, runtime rest after each slot
+#define EEG_IMPEDANCE_SETTLE_MS 4       // ADC2 conversions discarded after a mux or bias change (Sinc3: 3 at 800 SPS)
+#define EEG_IMPEDANCE_AVERAGE 4         // ADC2 conversions averaged with the bias off, then on
+#define EEG_IMPEDANCE_RECOVER_MS 2      // ADC1 settling after the MODE1 write that switches the bias off
+#define EEG_IMPEDANCE_SLOT_TIMEOUT_MS 50 // Abandon a phase that collects no conversions
+#define EEG_IMPEDANCE_CONTACT_KOHMS 50.0f // Contact good below this (same threshold as the integrity score)
+#define EEG_IMPEDANCE_OPEN_KOHMS 999.9f // Reported when the bias saturates ADC2 (lifted electrode)
+
+/* EEG Montage - one route per channel, in channel order: {device, ADC, MUXP<<4 | MUXN}
+ * ADC1 routes on a device are scanned through INPMUX (per-channel rate = ADC1 rate / routes),
+ * the ADC2 route (at most one per device) converts continuously on ADC2MUX. */
+#define ADS1263_MAX_PAIRS 5             // AIN0-AIN9 as five differential pairs
+#ifndef EEG_MONTAGE
+#define EEG_ADS1263_DEVICES 1           // ADS1263s on the shared SPI bus, one CS/DRDY each
+#define EEG_MONTAGE { {0, 1, 0x01},     /* ch0 left:  ADC1 AIN0-AIN1 */ \
+                      {0, 2, 0x23} }    /* ch1 right: ADC2 AIN2-AIN3 */
+#define EEG_CHANNEL_NAMES { "left", "right" }
+#endif
+
+#if (EEG_CHANNELS < 1) || (EEG_CHANNELS > ADS1263_MAX_PAIRS * EEG_ADS1263_DEVICES)
+#error "EEG_CHANNELS must fit the differential pairs of EEG_ADS1263_DEVICES"
+#endif
+
+/* Acquisition Task Run Mode */
+#define EEG_ACQ_CONTINUOUS_MODE 1       // 1 = run until eeg_acquisition_stop(), 0 = bench-test limit
+#define EEG_ACQ_TEST_SAMPLE_LIMIT 5000  // Samples acquired before stopping when not continuous
+
+/* DRDY Hardware Timestamps (GPT input capture of ICU IRQ0 via ELC) */
+#define EEG_DRDY_GPT_CAPTURE_ENABLED 1  // 0 = timestamp DRDY in the ISR from the DWT cycle counter
+#define EEG_DRDY_CAPTURE_GPT_CHANNEL 0  // Free-running 32-bit GPT used for capture
+#define EEG_DRDY_GAP_THRESHOLD 1.5f     // Interval > 1.5x nominal counts as missed samples
+
+/* ADS1263 DRDY-driven SPI/DTC Acquisition */
+#define ADS1263_SPI_DMA_MODE_ENABLED 1  // DRDY IRQ starts DTC-backed RDATA1+RDATA2 frames
+#define EEG_DMA_BLOCK_SAMPLES 32        // Samples per block (task wakes once per block of conversions)
+#define ADS1263_SPI_DMA_SPBR 7          // SPI_B bit rate divider: PCLK/(2*(7+1)) = 7.5MHz (ADS1263 max ~8MHz)
+
+/* Raw EEG Recorder (eegRECORD.h blocks, lossless coded or 24-bit packed) to OSPI flash via r_ospi_b g_ospi0 */
+#define EEG_RECORDER_ENABLED 1          // Start recording with acquisition when an OSPI instance is configured
+#define EEG_RECORDER_BLOCK_BYTES 4096   // Block size (multiple of the erase unit below)
+#define EEG_RECORDER_COMPRESSION 1      // Lossless-code block payloads (eegCODEC.h); 0 = packed 24-bit
+#define EEG_RECORDER_FRAME_SAMPLES 64   // Samples per codec frame (1..EEG_CODEC_MAX_SAMPLES)
+#define EEG_RECORDER_OSPI_OFFSET 0      // Recording region start, from the OSPI device 0 base
+#define EEG_RECORDER_OSPI_BYTES 0x04000000U // Region size (EK-RA8D1 MX25LM51245G: 64 MB), used circularly
+#define EEG_RECORDER_OSPI_ERASE_BYTES 4096 // Sector erase unit
+#define EEG_RECORDER_OSPI_PAGE_BYTES 64 // Bytes per r_ospi_b write call
+#define TASK_PRIORITY_RECORDER 12       // Writer: below acquisition, above the classifier
 
 /* Task Priorities (μT-Kernel 3.0) */
 #define TASK_PRIORITY_EEG_ACQ 10        // Highest priority
@@ -31,6 +139,8 @@
 #define ADS1263_MOSI_PIN BSP_IO_PORT_04_PIN_11 // P411 - Your MOSI connection
 #define ADS1263_MISO_PIN BSP_IO_PORT_04_PIN_10 // P410 - Your MISO connection
 #define ADS1263_DRDY_PIN BSP_IO_PORT_00_PIN_04 // P004 - Pin A4 IRQ0
+#define ADS1263_CS_PINS { ADS1263_CS_PIN }     // Per-device CS, index = EEG_MONTAGE device
+#define ADS1263_DRDY_PINS { ADS1263_DRDY_PIN } // Per-device DRDY (device 0 paces acquisition)
 
 /* Vibration Motor Pins */
 #define VIBRATION_MOTOR_LEFT_PIN BSP_IO_PORT_03_PIN_01
@@ -2,14 +2,24 @@
 #define SIGNAL_PROCESSING_H
 
 #include "eegTYPES.h"
+#include "eegBIQUAD.h"
+#include "eegWINDOW.h"
+#include "eegBUFFER.h"
 #include "hal_data.h"
 
+#define EEG_FILTER_STAGES 6             // Biquad sections in the conditioning cascade (eegFILTERTABLES.c)
+#define EEG_FILTER_LANES  EEG_BIQUAD_LANES_FOR(EEG_CHANNELS)   // Channels filtered in lockstep per lane bank
+#define EEG_FILTER_GROUPS ((EEG_CHANNELS + EEG_FILTER_LANES - 1) / EEG_FILTER_LANES)
+
 /* Function prototypes */
 fsp_err_t signal_processing_init(void);
 void signal_processing_get_stats(uint32_t *samples_processed, uint32_t *total_artifacts, bool *is_ready);
-fsp_err_t signal_processing_get_buffer(float **left_buffer, float **right_buffer, uint32_t *buffer_size);
-
-/* External function from eeg_acquisition.c */
-extern fsp_err_t eeg_get_samples(eeg_raw_sample_t *samples, uint32_t count, uint32_t *samples_read);
+eeg_window_t *signal_processing_receive_window(INT tmout);
+void signal_processing_release_window(eeg_window_t *window);
+fsp_err_t signal_processing_set_rate(const eeg_rate_t *rate);
+const eeg_rate_t *signal_processing_get_rate(void);
+uint32_t signal_processing_get_mains(void);
+uint32_t signal_processing_drain(float filtered[EEG_CHANNELS]);
+fsp_err_t signal_processing_design_filters(eeg_biquad_cascade_t *cascade, uint32_t sample_rate_hz, uint32_t mains_hz);
 
 #endif /* SIGNAL_PROCESSING_H */
@@ -0,0 +1,715 @@
+#include "hal_data.h"
+#include "ads1263HAL.h"
+#include "eegRATE.h"
+#include "shravyaCONFIG.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @file ads1263HAL.c
+ * @brief ADS1263 register/command layer on top of a platform ads1263_hal_t
+ *
+ * Everything here is plain C over the HAL function table, so the same frame
+ * parsing, checksum handling and register image run on the EK-RA8D1 and in
+ * the Linux host build (host/).
+ */
+
+static const ads1263_hal_t *ads1263_hal = NULL;
+
+/**
+ * @brief Bind the platform implementation used by every call in this file
+ */
+void ads1263_hal_register(const ads1263_hal_t *hal)
+{
+    ads1263_hal = hal;
+}
+
+/**
+ * @brief Currently bound HAL (NULL before ads1263_hal_register)
+ */
+const ads1263_hal_t *ads1263_hal_get(void)
+{
+    return ads1263_hal;
+}
+
+void ads1263_write_register(uint8_t reg_addr, uint8_t data)
+{
+    ads1263_hal->write_register(reg_addr, data);
+}
+
+/**
+ * @brief Write consecutive registers, in one WREG burst if the HAL supports it
+ */
+void ads1263_write_registers(uint8_t start, const uint8_t *data, uint32_t count)
+{
+    if (ads1263_hal->write_registers) {
+        ads1263_hal->write_registers(start, data, count);
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        ads1263_hal->write_register((uint8_t) (start + i), data[i]);
+    }
+}
+
+uint8_t ads1263_read_register(uint8_t reg_addr)
+{
+    return ads1263_hal->read_register(reg_addr);
+}
+
+void ads1263_send_command(uint8_t opcode)
+{
+    ads1263_hal->send_command(opcode);
+}
+
+/**
+ * @brief Verify an ADS1263 checksum byte (checksum mode, INTERFACE CRC=01)
+ * @param data Conversion data bytes (status byte excluded)
+ * @param length Number of data bytes
+ * @param checksum Checksum byte received after the data
+ */
+bool ads1263_checksum_valid(const uint8_t *data, uint32_t length, uint8_t checksum)
+{
+    uint8_t sum = ADS1263_CHECKSUM_SEED;
+    for (uint32_t i = 0; i < length; i++) {
+        sum = (uint8_t) (sum + data[i]);
+    }
+    return sum == checksum;
+}
+
+/**
+ * @brief Read one RDATA frame, re-reading only on a checksum mismatch
+ * @return FSP_SUCCESS, or FSP_ERR_INVALID_DATA if every attempt failed its checksum
+ */
+static fsp_err_t ads1263_read_frame(uint8_t opcode, uint8_t frame[ADS1263_RDATA_FRAME_BYTES],
+                                    eeg_rdata_stats_t *stats)
+{
+    uint8_t new_data_seen = 0;
+
+    for (int attempt = 0; attempt < ADS1263_RETRY_COUNT; attempt++) {
+        ads1263_hal->read_data(opcode, frame, ADS1263_RDATA_FRAME_BYTES);
+
+        /* RDATA clears the new-data flag, so a re-read must keep what the first read saw */
+        new_data_seen |= frame[0] & (ADS1263_STATUS_ADC1_NEW | ADS1263_STATUS_ADC2_NEW);
+
+        if (ads1263_checksum_valid(&frame[1], 4, frame[5])) {
+            frame[0] |= new_data_seen;
+            if (stats && attempt > 0) stats->retry_attempts += (uint32_t) attempt;
+            return FSP_SUCCESS;
+        }
+
+        if (stats) stats->checksum_errors++;
+    }
+
+    /* Counted, not printed: this is the per-conversion path, the stats dump reports it */
+    if (stats) {
+        stats->retry_attempts += ADS1263_RETRY_COUNT - 1;
+        stats->checksum_failures++;
+    }
+    return FSP_ERR_INVALID_DATA;
+}
+
+/**
+ * @brief Read ADC1 using RDATA1; frame = status, 4 data bytes, checksum
+ * @param value Signed 32-bit conversion result
+ * @param status ADS1263 status byte of the frame
+ * @param stats Checksum/retry counters to update (may be NULL)
+ * @note 0x00000000/0xFFFFFFFF are valid codes; only the checksum decides validity
+ */
+fsp_err_t ads1263_read_adc1(int32_t *value, uint8_t *status, eeg_rdata_stats_t *stats)
+{
+    uint8_t frame[ADS1263_RDATA_FRAME_BYTES];
+
+    fsp_err_t err = ads1263_read_frame(ADS1263_OP_RDATA1, frame, stats);
+    if (FSP_SUCCESS != err) return err;
+
+    *status = frame[0];
+    *value = (int32_t) (((uint32_t) frame[1] << 24) | ((uint32_t) frame[2] << 16) |
+                        ((uint32_t) frame[3] << 8) | (uint32_t) frame[4]);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Read ADC2 using RDATA2; frame = status, 3 data bytes, zero pad, checksum
+ * @param value Sign-extended 24-bit conversion result
+ * @param status ADS1263 status byte of the frame
+ * @param stats Checksum/retry counters to update (may be NULL)
+ */
+fsp_err_t ads1263_read_adc2(int32_t *value, uint8_t *status, eeg_rdata_stats_t *stats)
+{
+    uint8_t frame[ADS1263_RDATA_FRAME_BYTES];
+
+    fsp_err_t err = ads1263_read_frame(ADS1263_OP_RDATA2, frame, stats);
+    if (FSP_SUCCESS != err) return err;
+
+    *status = frame[0];
+    // Sign extend 24-bit to 32-bit
+    *value = (int32_t) (((uint32_t) frame[1] << 24) | ((uint32_t) frame[2] << 16) |
+                        ((uint32_t) frame[3] << 8)) >> 8;
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief One ADC2 conversion of @p mux, in volts (internal 2.5 V reference, gain 1)
+ */
+static fsp_err_t ads1263_adc2_convert(uint8_t mux, float *volts)
+{
+    ads1263_write_register(ADS1263_REG_ADC2MUX, mux);
+    ads1263_send_command(ADS1263_OP_START2);
+
+    for (uint32_t waited_ms = 0; waited_ms < ADS1263_MONITOR_TIMEOUT_MS; waited_ms++) {
+        int32_t value;
+        uint8_t status;
+
+        ads1263_hal->delay_ms(1);
+        if (FSP_SUCCESS == ads1263_read_adc2(&value, &status, NULL) && (status & ADS1263_STATUS_ADC2_NEW)) {
+            *volts = (float) value * (2.5f / 8388608.0f);
+            return FSP_SUCCESS;
+        }
+    }
+    return FSP_ERR_HARDWARE_TIMEOUT;
+}
+
+/**
+ * @brief Read the selected device's internal temperature sensor and AVDD monitor on ADC2
+ * @return fsp_err_t Success or FSP_ERR_HARDWARE_TIMEOUT
+ * @note Borrows ADC2 at 800 SPS (~3 ms per reading) and restores ADC2CFG/ADC2MUX
+ *       with ADC2 stopped; ads1263_start_montage() restarts it. Not for use
+ *       while acquisition is streaming.
+ */
+fsp_err_t ads1263_read_monitors(float *temperature_c, float *avdd_v)
+{
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+
+    uint8_t adc2cfg = ads1263_read_register(ADS1263_REG_ADC2CFG);
+    uint8_t adc2mux = ads1263_read_register(ADS1263_REG_ADC2MUX);
+    float temp_v = 0.0f;
+    float avdd_quarter_v = 0.0f;
+
+    ads1263_write_register(ADS1263_REG_ADC2CFG, ADS1263_ADC2CFG_MONITOR);
+    fsp_err_t err = ads1263_adc2_convert(ADS1263_MUX_TEMPERATURE, &temp_v);
+    if (FSP_SUCCESS == err) err = ads1263_adc2_convert(ADS1263_MUX_AVDD_MONITOR, &avdd_quarter_v);
+
+    ads1263_send_command(ADS1263_OP_STOP2);
+    ads1263_write_register(ADS1263_REG_ADC2CFG, adc2cfg);
+    ads1263_write_register(ADS1263_REG_ADC2MUX, adc2mux);
+    if (FSP_SUCCESS != err) return err;
+
+    *temperature_c = 25.0f + (temp_v - 0.1224f) / 0.000420f;
+    *avdd_v = 4.0f * avdd_quarter_v;
+    return FSP_SUCCESS;
+}
+
+/* ==================== Montage ==================== */
+
+static const ads1263_route_t montage_routes[EEG_CHANNELS] = EEG_MONTAGE;
+
+/* Per-device view of montage_routes, built once by ads1263_configure_montage() */
+static uint8_t montage_scan[EEG_ADS1263_DEVICES][ADS1263_MAX_PAIRS];   // ADC1 channels, scan order
+static uint8_t montage_scan_count[EEG_ADS1263_DEVICES];
+static int8_t montage_adc2[EEG_ADS1263_DEVICES];                       // ADC2 channel or -1
+static bool montage_built = false;
+static int montage_adc2_borrower = -1;                                  // Device whose ADC2 is lent out, see ads1263_montage_borrow_adc2()
+
+/**
+ * @brief Routes of EEG_MONTAGE, indexed by channel
+ */
+const ads1263_route_t *ads1263_montage_routes(void)
+{
+    return montage_routes;
+}
+
+/**
+ * @brief First channel converted by @p adc of @p device
+ * @return Channel index, or -1 if the montage does not use that ADC
+ */
+int ads1263_montage_channel(uint8_t device, uint8_t adc)
+{
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        if (montage_routes[ch].device == device && montage_routes[ch].adc == adc) return ch;
+    }
+    return -1;
+}
+
+/**
+ * @brief Microvolts per ring count of montage channel @p channel
+ * @note Ring values are ADC1 32-bit and ADC2 24-bit codes; full scale is
+ *       ±VREF/gain at the gains the register image programs.
+ */
+float ads1263_montage_count_uv(uint32_t channel)
+{
+    if (channel >= EEG_CHANNELS) return 0.0f;
+    if (1U == montage_routes[channel].adc) {
+        return ADS1263_VREF_UV / (float) (1U << ADS1263_ADC1_GAIN_CODE) / 2147483648.0f;
+    }
+    return ADS1263_VREF_UV / (float) (1U << ADS1263_ADC2_GAIN_CODE) / 8388608.0f;
+}
+
+/**
+ * @brief Ring count magnitude beyond which montage channel @p channel counts as saturated
+ * @note 95% of the code range of the channel's ADC, so ADC1 (32-bit) and
+ *       ADC2 (24-bit) channels are judged against their own full scale.
+ */
+int32_t ads1263_montage_clip_counts(uint32_t channel)
+{
+    if (channel >= EEG_CHANNELS) return INT32_MAX;
+    return (1U == montage_routes[channel].adc) ? (int32_t) ADS1263_ADC1_CLIP_COUNTS : (int32_t) ADS1263_ADC2_CLIP_COUNTS;
+}
+
+/**
+ * @brief True if one ADS1263 converts exactly one channel on ADC1 and one on ADC2
+ * @note Only this layout needs no INPMUX writes between samples, so it is the
+ *       only one the DRDY-triggered RDATA1+RDATA2 DTC chain can serve.
+ */
+bool ads1263_montage_is_direct(void)
+{
+    return (EEG_ADS1263_DEVICES == 1) && (EEG_CHANNELS == 2) &&
+           (ads1263_montage_channel(0, 1) >= 0) && (ads1263_montage_channel(0, 2) >= 0);
+}
+
+/**
+ * @brief Validate EEG_MONTAGE and split it into per-device scan lists
+ */
+static fsp_err_t ads1263_montage_build(void)
+{
+    memset(montage_scan_count, 0, sizeof(montage_scan_count));
+    memset(montage_adc2, -1, sizeof(montage_adc2));
+
+    for (uint8_t ch = 0; ch < EEG_CHANNELS; ch++) {
+        const ads1263_route_t *route = &montage_routes[ch];
+
+        if (route->device >= EEG_ADS1263_DEVICES || (route->mux >> 4) > 0x0A || (route->mux & 0x0F) > 0x0A) {
+            printf("SHRAVYA: ❌ Montage channel %u: bad device %u / mux 0x%02X\r\n", ch, route->device, route->mux);
+            return FSP_ERR_INVALID_ARGUMENT;
+        }
+
+        /* ADC1 and ADC2 share AIN0-AIN9, so a device carries at most five pairs in total */
+        uint32_t pairs = montage_scan_count[route->device] + ((montage_adc2[route->device] >= 0) ? 1U : 0U);
+        if (pairs >= ADS1263_MAX_PAIRS) {
+            printf("SHRAVYA: ❌ Montage device %u uses more than %d pairs\r\n", route->device, ADS1263_MAX_PAIRS);
+            return FSP_ERR_INVALID_ARGUMENT;
+        }
+
+        if (route->adc == 1) {
+            montage_scan[route->device][montage_scan_count[route->device]++] = ch;
+        } else if (route->adc == 2 && montage_adc2[route->device] < 0) {
+            montage_adc2[route->device] = (int8_t) ch;
+        } else {
+            printf("SHRAVYA: ❌ Montage channel %u: ADC%u not available on device %u\r\n", ch, route->adc, route->device);
+            return FSP_ERR_INVALID_ARGUMENT;
+        }
+    }
+
+    montage_built = true;
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief ADC1 conversions per montage sample: the longest INPMUX scan of any device
+ * @return Scan depth (1 for ADC2-only or direct montages, also if the montage is invalid)
+ */
+uint32_t ads1263_montage_scan_depth(void)
+{
+    if (!montage_built && FSP_SUCCESS != ads1263_montage_build()) return 1U;
+
+    uint32_t depth = 1U;
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (montage_scan_count[dev] > depth) depth = montage_scan_count[dev];
+    }
+    return depth;
+}
+
+/**
+ * @brief Whether a montage channel converts on ADC2 (which caps the rate, eeg_rate_describe())
+ */
+bool ads1263_montage_uses_adc2(void)
+{
+    if (!montage_built && FSP_SUCCESS != ads1263_montage_build()) return false;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (montage_adc2[dev] >= 0) return true;
+    }
+    return false;
+}
+
+/** MODE2 for @p rate: PGA gain ADS1263_ADC1_GAIN_CODE, DR[3:0] */
+static uint8_t ads1263_montage_mode2(const eeg_rate_t *rate)
+{
+    return (uint8_t) ((ADS1263_ADC1_GAIN_CODE << 4) | rate->mode2_dr);
+}
+
+/** ADC2CFG for @p rate: DR2[7:6], internal reference, gain ADS1263_ADC2_GAIN_CODE */
+static uint8_t ads1263_montage_adc2cfg(const eeg_rate_t *rate)
+{
+    return (uint8_t) ((rate->adc2cfg_dr << 6) | ADS1263_ADC2_GAIN_CODE);
+}
+
+/**
+ * @brief EEG register image for one montage device, in write order
+ * @param image Receives up to ADS1263_IMAGE_MAX register/value pairs
+ * @return Number of entries
+ */
+static uint32_t ads1263_montage_image(uint8_t dev, ads1263_reg_value_t image[ADS1263_IMAGE_MAX])
+{
+    const eeg_rate_t *rate = eeg_rate_get();
+    uint32_t n = 0;
+
+    // Status byte + checksum on every RDATA frame
+    image[n++] = (ads1263_reg_value_t) { ADS1263_REG_INTERFACE, ADS1263_INTERFACE_STATUS_CHECKSUM };
+
+    // ADC1 Configuration (Primary 32-bit) - scanned channels
+    image[n++] = (ads1263_reg_value_t) { ADS1263_REG_MODE0, 0x00 }; // MODE0: Continuous mode
+    image[n++] = (ads1263_reg_value_t) { ADS1263_REG_MODE1, ADS1263_MODE1_SINC3 }; // MODE1: Sinc3 filter, no sensor bias into the electrodes
+    image[n++] = (ads1263_reg_value_t) { ADS1263_REG_MODE2, ads1263_montage_mode2(rate) }; // MODE2: PGA gain 1, DR from eeg_rate_get()
+    if (montage_scan_count[dev] > 0) {
+        image[n++] = (ads1263_reg_value_t) { ADS1263_REG_INPMUX, montage_routes[montage_scan[dev][0]].mux };
+    }
+
+    // ADC2 Configuration (Secondary 24-bit) - continuous channel
+    image[n++] = (ads1263_reg_value_t) { ADS1263_REG_ADC2CFG, ads1263_montage_adc2cfg(rate) }; // ADC2CFG: DR2 from the rate, internal ref, gain 16
+    if (montage_adc2[dev] >= 0) {
+        image[n++] = (ads1263_reg_value_t) { ADS1263_REG_ADC2MUX, montage_routes[montage_adc2[dev]].mux };
+    }
+
+    return n;
+}
+
+/**
+ * @brief Value the EEG register image programs into @p reg of @p device
+ * @return FSP_SUCCESS, FSP_ERR_INVALID_ARGUMENT if the image leaves @p reg alone,
+ *         or the ads1263_montage_build() error
+ */
+fsp_err_t ads1263_montage_image_value(uint8_t device, uint8_t reg, uint8_t *value)
+{
+    if (!value) return FSP_ERR_INVALID_POINTER;
+    if (device >= EEG_ADS1263_DEVICES) return FSP_ERR_INVALID_ARGUMENT;
+    if (!montage_built) {
+        fsp_err_t err = ads1263_montage_build();
+        if (FSP_SUCCESS != err) return err;
+    }
+
+    ads1263_reg_value_t image[ADS1263_IMAGE_MAX];
+    uint32_t count = ads1263_montage_image(device, image);
+    for (uint32_t i = 0; i < count; i++) {
+        if (image[i].reg == reg) {
+            *value = image[i].value;
+            return FSP_SUCCESS;
+        }
+    }
+    return FSP_ERR_INVALID_ARGUMENT;
+}
+
+/**
+ * @brief Put the eeg_rate_get() data rates on every montage device
+ * @return FSP_SUCCESS, or the montage/image error
+ * @note The MODE2 write restarts ADC1 and the ADC2CFG write restarts ADC2, so
+ *       the next DRDY is the first conversion at the new rate.
+ */
+fsp_err_t ads1263_montage_apply_rate(void)
+{
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        uint8_t mode2, adc2cfg;
+        fsp_err_t err = ads1263_montage_image_value(dev, ADS1263_REG_MODE2, &mode2);
+        if (FSP_SUCCESS == err) err = ads1263_montage_image_value(dev, ADS1263_REG_ADC2CFG, &adc2cfg);
+        if (FSP_SUCCESS != err) return err;
+
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+        ads1263_write_register(ADS1263_REG_MODE2, mode2);
+        ads1263_write_register(ADS1263_REG_ADC2CFG, adc2cfg);
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief WREG bytes that put @p rate on one device: MODE2 DR for ADC1, ADC2CFG DR2 for ADC2
+ * @param rate Descriptor from eeg_rate_select(); requested rates were already
+ *        rounded to a native ADS1263 rate there, so only its codes are used
+ * @param bytes Receives WREG MODE2 followed by WREG ADC2CFG (one CS-low frame),
+ *        gains as ads1263_configure_montage() programs them
+ * @return 6, or 0 (nothing to send) for an unknown device or a descriptor whose
+ *         codes do not fit DR[3:0] / DR2[1:0]
+ */
+uint32_t ads1263_montage_rate_bytes(uint8_t device, const eeg_rate_t *rate, uint8_t bytes[6])
+{
+    if (!rate || device >= EEG_ADS1263_DEVICES || rate->mode2_dr > 0x0FU || rate->adc2cfg_dr > 0x03U) {
+        return 0;
+    }
+
+    bytes[0] = (uint8_t) (ADS1263_OP_WREG | ADS1263_REG_MODE2);
+    bytes[1] = 0x00;
+    bytes[2] = ads1263_montage_mode2(rate);
+    bytes[3] = (uint8_t) (ADS1263_OP_WREG | ADS1263_REG_ADC2CFG);
+    bytes[4] = 0x00;
+    bytes[5] = ads1263_montage_adc2cfg(rate);
+    return 6;
+}
+
+/**
+ * @brief Have ads1263_read_montage() also read RDATA2 on a device without an ADC2 route
+ * @param device Device whose ADC2 was borrowed (e.g. for an impedance slot), -1 = none
+ * @note Devices with an ADC2 route read RDATA2 every frame anyway; the result
+ *       lands in frame->adc2_value[] either way.
+ */
+void ads1263_montage_borrow_adc2(int device)
+{
+    montage_adc2_borrower = device;
+}
+
+/**
+ * @brief Program the EEG register image on every montage device
+ * @return fsp_err_t Success or error code
+ */
+fsp_err_t ads1263_configure_montage(void)
+{
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+
+    fsp_err_t err = ads1263_montage_build();
+    if (FSP_SUCCESS != err) return err;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        ads1263_reg_value_t image[ADS1263_IMAGE_MAX];
+        uint32_t count = ads1263_montage_image(dev, image);
+        for (uint32_t i = 0; i < count; i++) {
+            ads1263_write_register(image[i].reg, image[i].value);
+        }
+
+        printf("SHRAVYA: ✅ ADS1263 #%u: %u ADC1 scan channel(s), %s ADC2 channel\r\n",
+               dev, montage_scan_count[dev], (montage_adc2[dev] >= 0) ? "one" : "no");
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Read back every device's register image after ads1263_configure_montage()
+ * @return FSP_SUCCESS, or FSP_ERR_INVALID_HW_CONDITION on the first mismatch
+ */
+fsp_err_t ads1263_verify_montage(void)
+{
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+    if (!montage_built) return FSP_ERR_NOT_INITIALIZED;
+
+    fsp_err_t err = FSP_SUCCESS;
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES && FSP_SUCCESS == err; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        ads1263_reg_value_t image[ADS1263_IMAGE_MAX];
+        uint32_t count = ads1263_montage_image(dev, image);
+        for (uint32_t i = 0; i < count; i++) {
+            uint8_t value = ads1263_read_register(image[i].reg);
+            if (value != image[i].value) {
+                printf("SHRAVYA: ❌ ADS1263 #%u reg 0x%02X = 0x%02X (expected 0x%02X)\r\n",
+                       dev, image[i].reg, value, image[i].value);
+                err = FSP_ERR_INVALID_HW_CONDITION;
+                break;
+            }
+        }
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return err;
+}
+
+/**
+ * @brief Configuration signature: FNV-1a over each device's ID register and register image
+ * @return Signature, 0 if the montage is invalid
+ * @note Reads one ID register per device. Equal signatures mean the same parts
+ *       on the same CS lines with the same register image as a bring-up that
+ *       already passed ads1263_verify_montage() and a test read.
+ */
+uint32_t ads1263_montage_signature(void)
+{
+    if (!ads1263_hal) return 0;
+    if (!montage_built && FSP_SUCCESS != ads1263_montage_build()) return 0;
+
+    uint32_t hash = 2166136261u;
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        ads1263_reg_value_t image[ADS1263_IMAGE_MAX];
+        uint32_t count = ads1263_montage_image(dev, image);
+        uint8_t id = ads1263_read_register(ADS1263_REG_ID);
+
+        hash = (hash ^ id) * 16777619u;
+        for (uint32_t i = 0; i < count; i++) {
+            hash = (hash ^ image[i].reg) * 16777619u;
+            hash = (hash ^ image[i].value) * 16777619u;
+        }
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return hash;
+}
+
+/**
+ * @brief Start continuous conversions on the ADCs each montage device uses
+ * @return FSP_SUCCESS once every device has a first conversion,
+ *         FSP_ERR_HARDWARE_TIMEOUT if a DRDY never came
+ * @note The ADS1263 has no WAKEUP/SYNC opcodes (0x02/0x04 are undefined);
+ *       START1 restarts the ADC1 conversion and so acts as the sync point.
+ *       Every device is started first, then each device's DRDY is polled for
+ *       its first ADC1 conversion (ADS1263_FIRST_DRDY_TIMEOUT_MS). DRDY only
+ *       reports ADC1, so a device with ADC2 routes only waits one ADC2 period.
+ */
+fsp_err_t ads1263_start_montage(void)
+{
+    static const uint8_t adc2_period_ms[4] = { 100, 10, 3, 2 };   // ADC2CFG DR2: 10/100/400/800 SPS
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+    if (!montage_built) return FSP_ERR_NOT_INITIALIZED;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        if (montage_scan_count[dev] > 0) {
+            ads1263_send_command(ADS1263_OP_START1);
+        }
+        if (montage_adc2[dev] >= 0) {
+            ads1263_send_command(ADS1263_OP_START2);
+        }
+    }
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        if (montage_scan_count[dev] > 0) {
+            if (!ads1263_hal->wait_drdy(ADS1263_FIRST_DRDY_TIMEOUT_MS * 1000u)) {
+                printf("SHRAVYA: ❌ ADS1263 #%u: no DRDY within %u ms of START1\r\n",
+                       dev, ADS1263_FIRST_DRDY_TIMEOUT_MS);
+                err = FSP_ERR_HARDWARE_TIMEOUT;
+                break;
+            }
+        } else if (montage_adc2[dev] >= 0) {
+            ads1263_hal->delay_ms(adc2_period_ms[(ads1263_read_register(ADS1263_REG_ADC2CFG) >> 6) & 0x03]);
+        }
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return err;
+}
+
+/**
+ * @brief Self offset calibration (SFOCAL1/SFOCAL2) of the ADCs each montage device uses
+ * @return FSP_SUCCESS, or FSP_ERR_HARDWARE_TIMEOUT if an ADC1 calibration never completed
+ * @note Inputs are shorted internally, so electrodes may stay attached. The
+ *       results land in OFCAL0-2 / ADC2OFC0-1; ads1263_profile_capture() keeps
+ *       them. ADC1 completion is signalled on DRDY; ADC2 has no DRDY, so its
+ *       calibration is given 16 conversion periods. Leaves the ADCs converting.
+ */
+fsp_err_t ads1263_self_calibrate(void)
+{
+    static const uint8_t adc2_period_ms[4] = { 100, 10, 3, 2 };   // ADC2CFG DR2: 10/100/400/800 SPS
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+    if (!montage_built) return FSP_ERR_NOT_INITIALIZED;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES && FSP_SUCCESS == err; dev++) {
+        if (ads1263_hal->select_device) ads1263_hal->select_device(dev);
+
+        if (montage_scan_count[dev] > 0) {
+            ads1263_send_command(ADS1263_OP_START1);
+            ads1263_send_command(ADS1263_OP_SFOCAL1);
+            if (!ads1263_hal->wait_drdy(ADS1263_CAL_TIMEOUT_MS * 1000u)) {
+                printf("SHRAVYA: ❌ ADS1263 #%u: ADC1 self-calibration timed out\r\n", dev);
+                err = FSP_ERR_HARDWARE_TIMEOUT;
+            }
+        }
+        if (FSP_SUCCESS == err && montage_adc2[dev] >= 0) {
+            ads1263_send_command(ADS1263_OP_START2);
+            ads1263_send_command(ADS1263_OP_SFOCAL2);
+            ads1263_hal->delay_ms(16u * adc2_period_ms[(ads1263_read_register(ADS1263_REG_ADC2CFG) >> 6) & 0x03]);
+        }
+    }
+
+    if (ads1263_hal->select_device) ads1263_hal->select_device(0);
+    return err;
+}
+
+/**
+ * @brief Read one conversion for every montage channel
+ * @param frame Values and per-channel valid/new bits
+ * @param stats Checksum/retry/stale counters to update (may be NULL)
+ * @return FSP_SUCCESS if at least one channel returned a new conversion,
+ *         FSP_ERR_BUFFER_EMPTY if no status byte reported new data,
+ *         FSP_ERR_HARDWARE_TIMEOUT if every frame failed its checksum
+ * @note Call after device 0 DRDY. The first ADC1 channel of each device is the
+ *       conversion that DRDY announced; each further ADC1 channel rewrites
+ *       INPMUX (restarting ADC1) and waits for that device's next DRDY. INPMUX
+ *       is left on the first channel for the next sample period. Cost is one
+ *       frame per channel plus one INPMUX write per extra scanned channel.
+ */
+fsp_err_t ads1263_read_montage(ads1263_montage_frame_t *frame, eeg_rdata_stats_t *stats)
+{
+    if (!frame) return FSP_ERR_INVALID_POINTER;
+    if (!ads1263_hal) return FSP_ERR_NOT_OPEN;
+    if (!montage_built) return FSP_ERR_NOT_INITIALIZED;
+
+    frame->valid_mask = 0;
+    frame->new_mask = 0;
+    frame->adc2_new_mask = 0;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (EEG_ADS1263_DEVICES > 1) ads1263_hal->select_device(dev);
+
+        for (uint8_t i = 0; i < montage_scan_count[dev]; i++) {
+            uint8_t ch = montage_scan[dev][i];
+            uint8_t status = 0;
+
+            if (i > 0) {
+                ads1263_write_register(ADS1263_REG_INPMUX, montage_routes[ch].mux);
+                if (!ads1263_hal->wait_drdy(ADS1263_RDATA_TIMEOUT_MS * 1000U)) continue;
+            }
+
+            if (FSP_SUCCESS == ads1263_read_adc1(&frame->value[ch], &status, stats)) {
+                frame->valid_mask |= 1U << ch;
+                if (status & ADS1263_STATUS_ADC1_NEW) frame->new_mask |= 1U << ch;
+            }
+        }
+
+        if (montage_scan_count[dev] > 1) {
+            ads1263_write_register(ADS1263_REG_INPMUX, montage_routes[montage_scan[dev][0]].mux);
+        }
+
+        if (montage_adc2[dev] >= 0) {
+            uint8_t ch = (uint8_t) montage_adc2[dev];
+            uint8_t status = 0;
+
+            if (FSP_SUCCESS == ads1263_read_adc2(&frame->value[ch], &status, stats)) {
+                frame->valid_mask |= 1U << ch;
+                frame->adc2_value[dev] = frame->value[ch];
+                if (status & ADS1263_STATUS_ADC2_NEW) {
+                    frame->new_mask |= 1U << ch;
+                    frame->adc2_new_mask |= 1U << dev;
+                }
+            }
+        } else if (montage_adc2_borrower == (int) dev) {
+            uint8_t status = 0;
+
+            if (FSP_SUCCESS == ads1263_read_adc2(&frame->adc2_value[dev], &status, stats) &&
+                (status & ADS1263_STATUS_ADC2_NEW)) {
+                frame->adc2_new_mask |= 1U << dev;
+            }
+        }
+    }
+
+    if (EEG_ADS1263_DEVICES > 1) ads1263_hal->select_device(0);
+
+    if (frame->valid_mask == 0) {
+        return FSP_ERR_HARDWARE_TIMEOUT;
+    }
+
+    if (frame->new_mask == 0) {
+        if (stats) stats->stale_reads++;
+        return FSP_ERR_BUFFER_EMPTY;
+    }
+
+    return FSP_SUCCESS;
+}
@@ -0,0 +1,344 @@
+#include "hal_data.h"
+#include "ads1263IMPEDANCE.h"
+#include "shravyaCONFIG.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file ads1263IMPEDANCE.c
+ * @brief Background electrode impedance, time-sliced onto ADC2 while ADC1 streams
+ *
+ * Opt-in (EEG_IMPEDANCE_ENABLED). Every EEG_IMPEDANCE_SLOT_INTERVAL_MS one
+ * montage channel gets a slot: ADC2 is lent out at 800 SPS on the channel's
+ * pair and averaged with the MODE1 sensor bias off, then sourcing
+ * EEG_IMPEDANCE_BIAS_UA through the pair (into MUXP, out of MUXN); the
+ * difference over the current is the impedance of the two electrodes in
+ * series. The bias is at most 10 µA, the IEC 60601-1 DC patient current
+ * limit, and is on for at most EEG_IMPEDANCE_BIAS_MAX_MS per slot; the next
+ * slot waits until the on-time is at most EEG_IMPEDANCE_MAX_DUTY_PERCENT of
+ * the time since it was switched on, however late a slow sample rate let
+ * the scheduler switch it off.
+ *
+ * ADC2CFG/ADC2MUX writes restart ADC2 only; the two MODE1 writes restart
+ * ADC1, which delays its next DRDY by the Sinc3 settling time (the sample
+ * timestamps carry it). The measured channel and the channel that normally
+ * owns ADC2 hold their last value for the ~20 ms slot, and
+ * ads1263_impedance_hold_mask() marks them so processing excludes them.
+ *
+ * The scheduler never touches the bus itself. Each service() call, made once
+ * per sample period (or DTC block) right after the conversion was read,
+ * returns at most one WREG/command that fits in the gap before the next DRDY:
+ * the task path sends it through the HAL (ads1263_impedance_apply()), the DTC
+ * path chains it behind RDATA2 (ads1263_impedance_action_bytes()). ADC2
+ * conversions come back through ads1263_impedance_feed_adc2().
+ */
+
+#if (EEG_IMPEDANCE_BIAS_MAG < 1) || (EEG_IMPEDANCE_BIAS_MAG > 3)
+#error "EEG_IMPEDANCE_BIAS_MAG must select 0.5, 2 or 10 uA: nothing above the IEC 60601-1 DC patient current"
+#endif
+#if (EEG_IMPEDANCE_BIAS_MAX_MS * 100) > (EEG_IMPEDANCE_MAX_DUTY_PERCENT * EEG_IMPEDANCE_SLOT_INTERVAL_MS)
+#error "EEG_IMPEDANCE_BIAS_MAX_MS per slot interval exceeds EEG_IMPEDANCE_MAX_DUTY_PERCENT"
+#endif
+
+typedef enum {
+    IMPEDANCE_IDLE = 0,       // Waiting for the next slot
+    IMPEDANCE_START,          // START2 on a device with no ADC2 route
+    IMPEDANCE_BASELINE,       // Averaging with the sensor bias off
+    IMPEDANCE_EXCITED,        // Averaging with the sensor bias on
+    IMPEDANCE_STOP,           // STOP2 on a device with no ADC2 route
+    IMPEDANCE_RESTORE,        // ADC2CFG/ADC2MUX back to the montage image
+    IMPEDANCE_RECOVER         // ADC1 settling / first montage ADC2 conversion
+} impedance_state_t;
+
+static const ads1263_route_t *routes = NULL;
+static uint8_t image_adc2[EEG_ADS1263_DEVICES][2];   // Montage ADC2CFG, ADC2MUX per device
+static int8_t adc2_channel[EEG_ADS1263_DEVICES];     // Montage channel on the device's ADC2, or -1
+static ads1263_impedance_status_t status;
+
+static impedance_state_t state = IMPEDANCE_IDLE;
+static uint8_t slot_channel = 0;
+static uint32_t slot_start_us = 0;
+static uint32_t state_start_us = 0;
+static int64_t sum_codes = 0;
+static uint32_t sum_count = 0;
+static bool saturated = false;
+static bool adc2_recovered = false;
+static float baseline_code = 0.0f;
+static uint32_t bias_on_us = 0;                      // When the sensor bias was switched on
+static uint32_t bias_rest_us = 0;                    // Bias-off time owed before the next slot
+static uint32_t bias_off_us = 0;                     // When it was last switched off
+static bool initialized = false;
+
+/**
+ * @brief Reset the scheduler for a streaming run
+ * @param now_us Acquisition clock; the first slot opens one interval later
+ * @return FSP_SUCCESS, or the montage error if the image cannot be built
+ */
+fsp_err_t ads1263_impedance_init(uint32_t now_us)
+{
+    routes = ads1263_montage_routes();
+    memset(&status, 0, sizeof(status));
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        fsp_err_t err = ads1263_montage_image_value(dev, ADS1263_REG_ADC2CFG, &image_adc2[dev][0]);
+        if (FSP_SUCCESS != err) return err;
+        if (FSP_SUCCESS != ads1263_montage_image_value(dev, ADS1263_REG_ADC2MUX, &image_adc2[dev][1])) {
+            image_adc2[dev][1] = 0x01;   // Reset default, no ADC2 route
+        }
+        adc2_channel[dev] = (int8_t) ads1263_montage_channel(dev, 2);
+    }
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        status.contact_good[ch] = true;   // Until a slot says otherwise
+    }
+
+    state = IMPEDANCE_IDLE;
+    slot_channel = EEG_CHANNELS - 1;      // First slot goes to channel 0
+    slot_start_us = now_us;
+    bias_rest_us = 0;
+    bias_off_us = now_us;
+    ads1263_montage_borrow_adc2(-1);
+    initialized = true;
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Channels whose samples must hold their last value right now
+ */
+uint32_t ads1263_impedance_hold_mask(void)
+{
+    if (!initialized || IMPEDANCE_IDLE == state) return 0;
+
+    uint32_t mask = 1U << slot_channel;
+    int8_t owner = adc2_channel[routes[slot_channel].device];
+    if (owner >= 0) mask |= 1U << owner;
+    return mask;
+}
+
+/**
+ * @brief Account samples delivered while ads1263_impedance_hold_mask() was non-zero
+ */
+void ads1263_impedance_count_held(uint32_t samples)
+{
+    status.held_samples += samples;
+}
+
+/**
+ * @brief Hand over one new ADC2 conversion
+ * @param timestamp_us DRDY/read time of the conversion; anything within
+ *        EEG_IMPEDANCE_SETTLE_MS of the last mux/bias change is discarded
+ */
+void ads1263_impedance_feed_adc2(uint8_t device, int32_t code, uint32_t timestamp_us)
+{
+    if (!initialized || IMPEDANCE_IDLE == state || device != routes[slot_channel].device) return;
+    if ((int32_t) (timestamp_us - state_start_us) < (int32_t) (EEG_IMPEDANCE_SETTLE_MS * 1000U)) return;
+
+    if (IMPEDANCE_RECOVER == state) {
+        adc2_recovered = true;   // Montage rate conversion after the restore
+        return;
+    }
+    if (IMPEDANCE_BASELINE != state && IMPEDANCE_EXCITED != state) return;
+    if (sum_count >= EEG_IMPEDANCE_AVERAGE) return;
+
+    if (code >= 0x7FFFF0 || code <= -0x7FFFF0) saturated = true;
+    sum_codes += code;
+    sum_count++;
+}
+
+static void impedance_enter(impedance_state_t next, uint32_t now_us)
+{
+    state = next;
+    state_start_us = now_us;
+    sum_codes = 0;
+    sum_count = 0;
+    adc2_recovered = false;
+}
+
+static void impedance_wreg(ads1263_impedance_action_t *action, uint8_t reg, uint8_t count, uint8_t first,
+                           uint8_t second)
+{
+    action->device = routes[slot_channel].device;
+    action->opcode = ADS1263_OP_WREG;
+    action->reg = reg;
+    action->count = count;
+    action->data[0] = first;
+    action->data[1] = second;
+}
+
+/**
+ * @brief Switch the sensor bias off and book the rest it owes before the next slot
+ */
+static void impedance_bias_off(ads1263_impedance_action_t *action, uint32_t now_us)
+{
+    uint32_t on_us = now_us - bias_on_us;
+
+    impedance_wreg(action, ADS1263_REG_MODE1, 1, ADS1263_MODE1_SINC3, 0);
+    status.bias_on_us += on_us;
+    bias_off_us = now_us;
+    bias_rest_us = on_us / EEG_IMPEDANCE_MAX_DUTY_PERCENT * (100U - EEG_IMPEDANCE_MAX_DUTY_PERCENT);
+}
+
+static void impedance_command(ads1263_impedance_action_t *action, uint8_t opcode)
+{
+    action->device = routes[slot_channel].device;
+    action->opcode = opcode;
+    action->count = 0;
+}
+
+/**
+ * @brief Turn the two averages into the electrode pair's impedance
+ */
+static void impedance_publish(float excited_code)
+{
+    float kohms;
+
+    if (saturated) {
+        kohms = EEG_IMPEDANCE_OPEN_KOHMS;
+    } else {
+        /* ADC2 at gain 1 on the internal 2.5 V reference */
+        float delta_v = fabsf(excited_code - baseline_code) * (2.5f / 8388608.0f);
+        kohms = delta_v / (EEG_IMPEDANCE_BIAS_UA * 1e-6f) * 1e-3f;
+        if (kohms > EEG_IMPEDANCE_OPEN_KOHMS) kohms = EEG_IMPEDANCE_OPEN_KOHMS;
+    }
+
+    status.kohms[slot_channel] = kohms;
+    status.contact_good[slot_channel] = (kohms < EEG_IMPEDANCE_CONTACT_KOHMS);
+    status.measured[slot_channel] = true;
+    status.last_channel = slot_channel;
+    status.measurements++;
+}
+
+/**
+ * @brief Advance the slot by at most one bus action
+ * @param now_us Acquisition clock
+ * @param action Receives the transaction to send before the next DRDY (opcode 0 = none)
+ * @return true if this call completed a measurement (see ads1263_impedance_status())
+ */
+bool ads1263_impedance_service(uint32_t now_us, ads1263_impedance_action_t *action)
+{
+    bool measured = false;
+
+    if (!action) return false;
+    action->opcode = 0;
+    if (!initialized) return false;
+
+    bool has_route = adc2_channel[routes[slot_channel].device] >= 0;
+    bool timed_out = (now_us - state_start_us) >= EEG_IMPEDANCE_SLOT_TIMEOUT_MS * 1000U;
+
+    switch (state) {
+        case IMPEDANCE_IDLE:
+            /* Slot interval, and the duty cap measured from the bias' actual on-time */
+            if ((now_us - slot_start_us) < EEG_IMPEDANCE_SLOT_INTERVAL_MS * 1000U) break;
+            if ((now_us - bias_off_us) < bias_rest_us) break;
+            slot_start_us = now_us;
+            slot_channel = (uint8_t) ((slot_channel + 1U) % EEG_CHANNELS);
+            saturated = false;
+            /* ADC2 onto the electrode pair at 800 SPS, gain 1 (restarts ADC2 only) */
+            impedance_wreg(action, ADS1263_REG_ADC2CFG, 2, ADS1263_ADC2CFG_MONITOR, routes[slot_channel].mux);
+            has_route = adc2_channel[routes[slot_channel].device] >= 0;
+            if (!has_route) ads1263_montage_borrow_adc2(routes[slot_channel].device);
+            impedance_enter(has_route ? IMPEDANCE_BASELINE : IMPEDANCE_START, now_us);
+            break;
+
+        case IMPEDANCE_START:
+            impedance_command(action, ADS1263_OP_START2);
+            impedance_enter(IMPEDANCE_BASELINE, now_us);
+            break;
+
+        case IMPEDANCE_BASELINE:
+            if (sum_count >= EEG_IMPEDANCE_AVERAGE) {
+                baseline_code = (float) sum_codes / (float) sum_count;
+                /* Sensor bias through ADC2's pair: source on MUXP, sink on MUXN */
+                impedance_wreg(action, ADS1263_REG_MODE1, 1,
+                               (uint8_t) (ADS1263_MODE1_SINC3 | ADS1263_MODE1_SBADC2 | EEG_IMPEDANCE_BIAS_MAG), 0);
+                bias_on_us = now_us;
+                impedance_enter(IMPEDANCE_EXCITED, now_us);
+            } else if (timed_out) {
+                status.timeouts++;
+                impedance_enter(has_route ? IMPEDANCE_RESTORE : IMPEDANCE_STOP, now_us);
+            }
+            break;
+
+        case IMPEDANCE_EXCITED: {
+            /* Off as soon as the average is in, and never later than EEG_IMPEDANCE_BIAS_MAX_MS */
+            bool bias_expired = (now_us - bias_on_us) >= EEG_IMPEDANCE_BIAS_MAX_MS * 1000U;
+            if (sum_count >= EEG_IMPEDANCE_AVERAGE || bias_expired) {
+                if (sum_count >= EEG_IMPEDANCE_AVERAGE) {
+                    impedance_publish((float) sum_codes / (float) sum_count);
+                    measured = true;
+                } else {
+                    status.timeouts++;
+                }
+                impedance_bias_off(action, now_us);
+                impedance_enter(has_route ? IMPEDANCE_RESTORE : IMPEDANCE_STOP, now_us);
+            }
+            break;
+        }
+
+        case IMPEDANCE_STOP:
+            impedance_command(action, ADS1263_OP_STOP2);
+            impedance_enter(IMPEDANCE_RESTORE, now_us);
+            break;
+
+        case IMPEDANCE_RESTORE: {
+            uint8_t dev = routes[slot_channel].device;
+            (void) ads1263_montage_image_value(dev, ADS1263_REG_ADC2CFG, &image_adc2[dev][0]);  // DR2 follows rate switches
+            impedance_wreg(action, ADS1263_REG_ADC2CFG, 2, image_adc2[dev][0], image_adc2[dev][1]);
+            impedance_enter(IMPEDANCE_RECOVER, now_us);
+            break;
+        }
+
+        case IMPEDANCE_RECOVER:
+            /* Release once ADC1 has settled from the MODE1 restart and a montage ADC2 channel has a fresh conversion */
+            if ((now_us - state_start_us) < EEG_IMPEDANCE_RECOVER_MS * 1000U) break;
+            if (has_route && !adc2_recovered && !timed_out) break;
+            ads1263_montage_borrow_adc2(-1);
+            impedance_enter(IMPEDANCE_IDLE, now_us);
+            break;
+    }
+
+    return measured;
+}
+
+/**
+ * @brief Send an action through the HAL (task-driven acquisition)
+ */
+void ads1263_impedance_apply(const ads1263_impedance_action_t *action)
+{
+    const ads1263_hal_t *hal = ads1263_hal_get();
+
+    if (!action || 0 == action->opcode || !hal) return;
+
+    if (EEG_ADS1263_DEVICES > 1 && hal->select_device) hal->select_device(action->device);
+    if (ADS1263_OP_WREG == action->opcode) {
+        ads1263_write_registers(action->reg, action->data, action->count);
+    } else {
+        ads1263_send_command(action->opcode);
+    }
+    if (EEG_ADS1263_DEVICES > 1 && hal->select_device) hal->select_device(0);
+}
+
+/**
+ * @brief Encode an action as SPI bytes for a DTC/ISR-chained transfer
+ * @return Byte count (0 = nothing to send, at most 4)
+ */
+uint32_t ads1263_impedance_action_bytes(const ads1263_impedance_action_t *action, uint8_t bytes[4])
+{
+    if (!action || 0 == action->opcode) return 0;
+
+    if (ADS1263_OP_WREG != action->opcode) {
+        bytes[0] = action->opcode;
+        return 1;
+    }
+    bytes[0] = (uint8_t) (ADS1263_OP_WREG | action->reg);
+    bytes[1] = (uint8_t) (action->count - 1U);
+    memcpy(&bytes[2], action->data, action->count);
+    return 2U + action->count;
+}
+
+/**
+ * @brief Latest impedance per channel and scheduler counters
+ */
+const ads1263_impedance_status_t *ads1263_impedance_status(void)
+{
+    return &status;
+}
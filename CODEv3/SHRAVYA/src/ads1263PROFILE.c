@@ -0,0 +1,197 @@
+#include "hal_data.h"
+#include "ads1263PROFILE.h"
+#include "shravyaCONFIG.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @file ads1263PROFILE.c
+ * @brief Persisted ADS1263 profile - calibration, SPI mode and full register image
+ *
+ * A profile is captured once after a verified, self-calibrated bring-up and
+ * stored behind a version + CRC-32 header. Later boots restore each device's
+ * registers in one WREG burst and resume sampling; calibration only reruns
+ * when the internal temperature sensor or AVDD monitor has drifted from the
+ * values recorded with it. Plain C over the ADS1263 HAL and a storage table,
+ * so the host build exercises the same code against a file.
+ */
+
+static const ads1263_profile_storage_t *profile_storage = NULL;
+
+/**
+ * @brief Bind the platform storage used by load/save/invalidate
+ */
+void ads1263_profile_storage_register(const ads1263_profile_storage_t *storage)
+{
+    profile_storage = storage;
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected, init/xorout 0xFFFFFFFF), bitwise - profile-sized inputs only
+ */
+uint32_t ads1263_crc32(const void *data, uint32_t length)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/**
+ * @brief Read and validate the stored profile
+ * @return FSP_SUCCESS, FSP_ERR_NOT_FOUND (no/other-version profile) or
+ *         FSP_ERR_INVALID_DATA (CRC mismatch)
+ */
+fsp_err_t ads1263_profile_load(ads1263_profile_t *profile)
+{
+    if (!profile) return FSP_ERR_INVALID_POINTER;
+    if (!profile_storage) return FSP_ERR_NOT_OPEN;
+
+    fsp_err_t err = profile_storage->read(profile, sizeof(*profile));
+    if (FSP_SUCCESS != err) return err;
+
+    const uint32_t payload = sizeof(*profile) - sizeof(profile->header);
+    if (profile->header.magic != ADS1263_PROFILE_MAGIC ||
+        profile->header.version != ADS1263_PROFILE_VERSION ||
+        profile->header.length != payload ||
+        profile->device_count != EEG_ADS1263_DEVICES) {
+        return FSP_ERR_NOT_FOUND;
+    }
+    if (profile->header.crc32 != ads1263_crc32((const uint8_t *) profile + sizeof(profile->header), payload)) {
+        printf("SHRAVYA: ⚠️  ADS1263 profile CRC mismatch - ignoring stored profile\r\n");
+        return FSP_ERR_INVALID_DATA;
+    }
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Fill in the header and write the profile to storage
+ */
+fsp_err_t ads1263_profile_save(ads1263_profile_t *profile)
+{
+    if (!profile) return FSP_ERR_INVALID_POINTER;
+    if (!profile_storage) return FSP_ERR_NOT_OPEN;
+
+    const uint32_t payload = sizeof(*profile) - sizeof(profile->header);
+    profile->header.magic = ADS1263_PROFILE_MAGIC;
+    profile->header.version = ADS1263_PROFILE_VERSION;
+    profile->header.length = (uint16_t) payload;
+    profile->header.crc32 = ads1263_crc32((const uint8_t *) profile + sizeof(profile->header), payload);
+
+    fsp_err_t err = profile_storage->write(profile, sizeof(*profile));
+    if (FSP_SUCCESS == err) {
+        printf("SHRAVYA: 💾 ADS1263 profile saved to %s (%u bytes, CRC 0x%08lX)\r\n",
+               profile_storage->name, (unsigned) sizeof(*profile), (unsigned long) profile->header.crc32);
+    }
+    return err;
+}
+
+/**
+ * @brief Make the next boot run the full checks (clears the stored header)
+ */
+fsp_err_t ads1263_profile_invalidate(void)
+{
+    if (!profile_storage) return FSP_ERR_NOT_OPEN;
+
+    ads1263_profile_header_t blank;
+    memset(&blank, 0, sizeof(blank));
+    return profile_storage->write(&blank, sizeof(blank));
+}
+
+/**
+ * @brief Snapshot every device's registers and calibration conditions
+ * @param signature ads1263_montage_signature() of this bring-up
+ * @param spi_mode spi_communication_mode_t in use
+ * @note Call after ads1263_self_calibrate(); reads 27 registers and the
+ *       temperature/AVDD monitors per device.
+ */
+fsp_err_t ads1263_profile_capture(ads1263_profile_t *profile, uint32_t signature, uint8_t spi_mode)
+{
+    const ads1263_hal_t *hal = ads1263_hal_get();
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!profile) return FSP_ERR_INVALID_POINTER;
+    if (!hal) return FSP_ERR_NOT_OPEN;
+
+    memset(profile, 0, sizeof(*profile));
+    profile->montage_signature = signature;
+    profile->spi_mode = spi_mode;
+    profile->device_count = EEG_ADS1263_DEVICES;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES && FSP_SUCCESS == err; dev++) {
+        ads1263_device_profile_t *device = &profile->device[dev];
+        if (hal->select_device) hal->select_device(dev);
+
+        err = ads1263_read_monitors(&device->cal_temperature_c, &device->cal_avdd_v);
+        for (uint8_t reg = 0; reg < ADS1263_REG_COUNT; reg++) {
+            device->regs[reg] = ads1263_read_register(reg);
+        }
+        device->calibrated = 1;
+    }
+
+    if (hal->select_device) hal->select_device(0);
+    return err;
+}
+
+/**
+ * @brief Restore every device's register image in one WREG burst (0x01-0x1A)
+ * @note Replaces ads1263_configure_montage() on a known-good boot; the ADCs
+ *       are still stopped, so the burst does not restart a conversion.
+ */
+fsp_err_t ads1263_profile_restore(const ads1263_profile_t *profile)
+{
+    const ads1263_hal_t *hal = ads1263_hal_get();
+
+    if (!profile) return FSP_ERR_INVALID_POINTER;
+    if (!hal) return FSP_ERR_NOT_OPEN;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES; dev++) {
+        if (hal->select_device) hal->select_device(dev);
+        ads1263_write_registers(ADS1263_REG_POWER, &profile->device[dev].regs[ADS1263_REG_POWER],
+                                ADS1263_REG_COUNT - ADS1263_REG_POWER);
+    }
+
+    if (hal->select_device) hal->select_device(0);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Compare temperature/AVDD against the values the calibration was taken at
+ * @return true if any device needs recalibration (uncalibrated, drifted or monitor read failed)
+ */
+bool ads1263_profile_drifted(const ads1263_profile_t *profile)
+{
+    const ads1263_hal_t *hal = ads1263_hal_get();
+    bool drifted = false;
+
+    if (!profile || !hal) return true;
+
+    for (uint8_t dev = 0; dev < EEG_ADS1263_DEVICES && !drifted; dev++) {
+        const ads1263_device_profile_t *device = &profile->device[dev];
+        float temperature_c = 0.0f;
+        float avdd_v = 0.0f;
+
+        if (hal->select_device) hal->select_device(dev);
+        if (!device->calibrated || FSP_SUCCESS != ads1263_read_monitors(&temperature_c, &avdd_v)) {
+            drifted = true;
+            break;
+        }
+
+        float dt = fabsf(temperature_c - device->cal_temperature_c);
+        float dv = fabsf(avdd_v - device->cal_avdd_v);
+        if (dt > EEG_CAL_DRIFT_TEMPERATURE_C || dv > EEG_CAL_DRIFT_AVDD_V) {
+            printf("SHRAVYA: 🌡️  ADS1263 #%u drifted %.1f °C / %.3f V since calibration\r\n", dev, dt, dv);
+            drifted = true;
+        }
+    }
+
+    if (hal->select_device) hal->select_device(0);
+    return drifted;
+}
@@ -3,6 +3,7 @@
 #include "cognitiveSTATES.h"
 #include "signalPROCESSING.h"
 #include "semaphoresGLOBAL.h"
+#include "eegWAVELET.h"
 
 #include <math.h>
 #include <string.h>
@@ -34,30 +35,19 @@ extern ER tk_wai_sem(ID semid, INT timeout);
 extern ER tk_sig_sem(ID semid, INT cnt);  // ✅ FIXED: Added declaration
 extern ER tk_dly_tsk(INT dlytim);         // ✅ FIXED: Added declaration
 // ✅ ADD: Missing external function declarations
-extern fsp_err_t signal_processing_get_buffer(float **left_buffer,
-                                             float **right_buffer,
-                                             uint32_t *buffer_size);
 extern fsp_err_t trigger_drowsiness_alert(void);
 extern fsp_err_t trigger_haptic_pattern(cognitive_state_type_t state);
 
-/* DSP and ML Constants */
-#define FFT_SIZE 256
-#define FFT_SIZE_HALF 128
-#define SAMPLE_RATE 500.0f
-#define FREQ_RESOLUTION (SAMPLE_RATE / FFT_SIZE)
+/* DSP and ML Constants - window length and bin spacing follow the rate descriptor */
+#define FFT_SIZE EEG_WINDOW_MAX_SAMPLES
+#define FFT_SIZE_HALF (EEG_WINDOW_MAX_SAMPLES / 2)
 #define PI 3.14159265358979323846f
 
-/* EEG Frequency Band Definitions */
-#define DELTA_START_BIN (int)(0.5f / FREQ_RESOLUTION)
-#define DELTA_END_BIN (int)(4.0f / FREQ_RESOLUTION)
-#define THETA_START_BIN (int)(4.0f / FREQ_RESOLUTION)
-#define THETA_END_BIN (int)(8.0f / FREQ_RESOLUTION)
-#define ALPHA_START_BIN (int)(8.0f / FREQ_RESOLUTION)
-#define ALPHA_END_BIN (int)(13.0f / FREQ_RESOLUTION)
-#define BETA_START_BIN (int)(13.0f / FREQ_RESOLUTION)
-#define BETA_END_BIN (int)(30.0f / FREQ_RESOLUTION)
-#define GAMMA_START_BIN (int)(30.0f / FREQ_RESOLUTION)
-#define GAMMA_END_BIN (int)(45.0f / FREQ_RESOLUTION)
+/* EEG Frequency Band Definitions (Hz), turned into bins by update_spectral_tables() */
+typedef enum { BAND_DELTA = 0, BAND_THETA, BAND_ALPHA, BAND_BETA, BAND_GAMMA, BAND_COUNT } eeg_band_t;
+static const float band_edges_hz[BAND_COUNT][2] = {
+    { 0.5f, 4.0f }, { 4.0f, 8.0f }, { 8.0f, 13.0f }, { 13.0f, 30.0f }, { 30.0f, 45.0f }
+};
 #define STRESS_THRESHOLD 0.7f
 #define FATIGUE_THRESHOLD 0.8f
 #define ANXIETY_THRESHOLD 0.75f
@@ -96,26 +86,46 @@ static neural_network_t cognitive_nn;
 static volatile bool classifier_initialized = false;
 static volatile uint32_t classifications_performed = 0;
 
+/* Spectral tables for the current window: band bins and DFT twiddles */
+static int band_start_bin[BAND_COUNT];
+static int band_end_bin[BAND_COUNT];
+static float dft_cos[FFT_SIZE];
+static float dft_sin[FFT_SIZE];
+static int spectral_size = 0;
+static uint32_t spectral_rate_hz = 0;
+static float freq_resolution = 0.0f;
+static eeg_wavelet_plan_t band_wavelet;    // Same decomposition signal processing runs on the window
+
+/* Feature scratch (the window can exceed what task stacks hold) */
+static complex_t channel_fft[FFT_SIZE_HALF];
+static float combined_power[FFT_SIZE_HALF];
+static float combined_signal[FFT_SIZE];
+static float derivative[FFT_SIZE];
+
 /* External semaphore references */
-extern ID feature_extraction_semaphore;
 extern ID classification_semaphore;
 extern ID haptic_semaphore;
 extern ID communication_semaphore;
 
 /* Private Function Prototypes */
 static void init_neural_network(void);
+static void update_spectral_tables(int size);
 static void compute_fft(const float *input, complex_t *output, int size);
-void extract_frequency_features(const float *left_signal, const float *right_signal, int size);
-void extract_time_domain_features(const float *left_signal, const float *right_signal, int size);
-void extract_coherence_features(const float *left_signal, const float *right_signal, int size);
-void extract_quality_features(const float *left_signal, const float *right_signal, int size);
+static void set_band_powers(const float band_power[BAND_COUNT]);
+void extract_frequency_features(const float *const channels[], int channel_count, int size);
+void extract_time_domain_features(const float *const channels[], int channel_count, int size);
+void extract_coherence_features(const float *const channels[], int channel_count, int size);
+void extract_wavelet_band_features(const float energy[][EEG_WAVELET_MAX_LEVELS + 1], int channel_count, int levels);
+void extract_quality_features(const float *const channels[], int channel_count, int size,
+                              const float artifact_ratio[]);
 static float calculate_spectral_entropy(const float *power_spectrum, int size);
 static float calculate_hjorth_parameters(const float *signal, int size, float *mobility);
-static float sigmoid_activation(float x);
 static float relu_activation(float x);
 void forward_propagation(const feature_vector_t *features, float *output);
 cognitive_state_type_t determine_dominant_state(const float *probabilities);
 bool intervention_required(const cognitive_classification_t *result);
+void handle_intervention_trigger(cognitive_classification_t *result);
+fsp_err_t get_classification_statistics(uint32_t *total_classifications, float *avg_wellness, bool *is_active);
 
 // ✅ Public function declarations (add to header later)
 void task_feature_extraction_entry(INT stacd, void *exinf);
@@ -177,20 +187,51 @@ static void init_neural_network(void)
 }
 
 /**
- * @brief Compute FFT using simple DFT
+ * @brief Rebuild band bins and DFT twiddles when the window or rate changed
+ * @note Runs on the first window after a signal_processing_set_rate(), which
+ *       the processing task completes before it signals feature extraction.
  */
-static void compute_fft(const float *input, complex_t *output, int size)
+static void update_spectral_tables(int size)
 {
+    uint32_t rate_hz = signal_processing_get_rate()->window_rate_hz;   // Windows hold decimated samples
+    if ((size == spectral_size) && (rate_hz == spectral_rate_hz)) return;
+
+    freq_resolution = (float)rate_hz / (float)size;
+    for (int band = 0; band < BAND_COUNT; band++) {
+        band_start_bin[band] = (int)(band_edges_hz[band][0] / freq_resolution);
+        band_end_bin[band] = (int)(band_edges_hz[band][1] / freq_resolution);
+    }
+
     const float pi2 = 2.0f * PI;
+    for (int n = 0; n < size; n++) {
+        float angle = -pi2 * (float)n / (float)size;
+        dft_cos[n] = cosf(angle);
+        dft_sin[n] = sinf(angle);
+    }
+    if (FSP_SUCCESS != eeg_wavelet_plan(&band_wavelet, (uint32_t)size, rate_hz)) {
+        band_wavelet.levels = 0;
+    }
+
+    spectral_size = size;
+    spectral_rate_hz = rate_hz;
+}
 
+/**
+ * @brief Compute FFT using simple DFT
+ * @note Twiddles come from update_spectral_tables(): e^(-2πikn/N) = table[(k·n) mod N]
+ */
+static void compute_fft(const float *input, complex_t *output, int size)
+{
     for (int k = 0; k < size/2; k++) {
         output[k].real = 0.0f;
         output[k].imag = 0.0f;
 
+        int twiddle = 0;
         for (int n = 0; n < size; n++) {
-            float angle = -pi2 * (float)k * (float)n / (float)size; // ✅ FIXED casts
-            output[k].real += input[n] * cosf(angle);
-            output[k].imag += input[n] * sinf(angle);
+            output[k].real += input[n] * dft_cos[twiddle];
+            output[k].imag += input[n] * dft_sin[twiddle];
+            twiddle += k;
+            if (twiddle >= size) twiddle -= size;
         }
 
         output[k].real /= (float)size; // ✅ FIXED cast
@@ -199,87 +240,124 @@ static void compute_fft(const float *input, complex_t *output, int size)
 }
 
 /**
- * @brief Extract frequency domain features
+ * @brief Band powers and the ratios between them into current_features
  */
-void extract_frequency_features(const float *left_signal, const float *right_signal, int size)
+static void set_band_powers(const float band_power[BAND_COUNT])
 {
-    complex_t left_fft[FFT_SIZE_HALF];
-    complex_t right_fft[FFT_SIZE_HALF];
-    float combined_power[FFT_SIZE_HALF];
+    current_features.delta_power = band_power[BAND_DELTA];
+    current_features.theta_power = band_power[BAND_THETA];
+    current_features.alpha_power = band_power[BAND_ALPHA];
+    current_features.beta_power = band_power[BAND_BETA];
+    current_features.gamma_power = band_power[BAND_GAMMA];
 
-    compute_fft(left_signal, left_fft, size);
-    compute_fft(right_signal, right_fft, size);
-
-    for (int i = 0; i < FFT_SIZE_HALF; i++) {
-        float left_power = left_fft[i].real * left_fft[i].real + left_fft[i].imag * left_fft[i].imag;
-        float right_power = right_fft[i].real * right_fft[i].real + right_fft[i].imag * right_fft[i].imag;
-        combined_power[i] = (left_power + right_power) / 2.0f;
-    }
+    /* Calculate band ratios */
+    current_features.alpha_beta_ratio = (current_features.beta_power > 0) ?
+        current_features.alpha_power / current_features.beta_power : 0.0f;
+    current_features.theta_alpha_ratio = (current_features.alpha_power > 0) ?
+        current_features.theta_power / current_features.alpha_power : 0.0f;
+}
 
-    /* Extract frequency band powers */
-    current_features.delta_power = 0.0f;
-    for (int i = DELTA_START_BIN; i <= DELTA_END_BIN && i < FFT_SIZE_HALF; i++) {
-        current_features.delta_power += combined_power[i];
-    }
+/**
+ * @brief Extract frequency domain features
+ * @note Band powers come from the channel-averaged power spectrum; one FFT per channel
+ */
+void extract_frequency_features(const float *const channels[], int channel_count, int size)
+{
+    if (size > FFT_SIZE) size = FFT_SIZE;
+    int half = size / 2;
+    update_spectral_tables(size);
+    memset(combined_power, 0, sizeof(combined_power));
 
-    current_features.theta_power = 0.0f;
-    for (int i = THETA_START_BIN; i <= THETA_END_BIN && i < FFT_SIZE_HALF; i++) {
-        current_features.theta_power += combined_power[i];
-    }
+    for (int ch = 0; ch < channel_count; ch++) {
+        compute_fft(channels[ch], channel_fft, size);
 
-    current_features.alpha_power = 0.0f;
-    for (int i = ALPHA_START_BIN; i <= ALPHA_END_BIN && i < FFT_SIZE_HALF; i++) {
-        current_features.alpha_power += combined_power[i];
+        for (int i = 0; i < half; i++) {
+            combined_power[i] += channel_fft[i].real * channel_fft[i].real + channel_fft[i].imag * channel_fft[i].imag;
+        }
     }
 
-    current_features.beta_power = 0.0f;
-    for (int i = BETA_START_BIN; i <= BETA_END_BIN && i < FFT_SIZE_HALF; i++) {
-        current_features.beta_power += combined_power[i];
+    for (int i = 0; i < half; i++) {
+        combined_power[i] /= (float)channel_count;
     }
 
-    current_features.gamma_power = 0.0f;
-    for (int i = GAMMA_START_BIN; i <= GAMMA_END_BIN && i < FFT_SIZE_HALF; i++) {
-        current_features.gamma_power += combined_power[i];
+    /* Extract frequency band powers */
+    float band_power[BAND_COUNT];
+    for (int band = 0; band < BAND_COUNT; band++) {
+        band_power[band] = 0.0f;
+        for (int i = band_start_bin[band]; i <= band_end_bin[band] && i < half; i++) {
+            band_power[band] += combined_power[i];
+        }
     }
-
-    /* Calculate band ratios */
-    current_features.alpha_beta_ratio = (current_features.beta_power > 0) ?
-        current_features.alpha_power / current_features.beta_power : 0.0f;
-    current_features.theta_alpha_ratio = (current_features.alpha_power > 0) ?
-        current_features.theta_power / current_features.alpha_power : 0.0f;
+    set_band_powers(band_power);
 
     /* Calculate spectral entropy */
-    current_features.spectral_entropy = calculate_spectral_entropy(combined_power, FFT_SIZE_HALF);
+    current_features.spectral_entropy = calculate_spectral_entropy(combined_power, half);
 
     /* Find peak frequency */
     int peak_bin = 0;
     float max_power = combined_power[0];
-    for (int i = 1; i < FFT_SIZE_HALF; i++) {
+    for (int i = 1; i < half; i++) {
         if (combined_power[i] > max_power) {
             max_power = combined_power[i];
             peak_bin = i;
         }
     }
-    current_features.peak_frequency = (float)peak_bin * FREQ_RESOLUTION; // ✅ FIXED cast
+    current_features.peak_frequency = (float)peak_bin * freq_resolution;
 
     /* Calculate spectral centroid */
     float numerator = 0.0f, denominator = 0.0f;
-    for (int i = 0; i < FFT_SIZE_HALF; i++) {
-        float frequency = (float)i * FREQ_RESOLUTION; // ✅ FIXED cast
+    for (int i = 0; i < half; i++) {
+        float frequency = (float)i * freq_resolution;
         numerator += frequency * combined_power[i];
         denominator += combined_power[i];
     }
     current_features.spectral_centroid = (denominator > 0) ? numerator / denominator : 0.0f;
 }
 
+/**
+ * @brief Band powers from the window's wavelet level energies (EEG_WAVELET_BAND_POWER)
+ * @param energy eeg_window_t.wavelet_energy, @p levels its wavelet_levels
+ * @note Runs after extract_frequency_features() and replaces its band powers
+ *       and ratios; the spectral shape features stay the DFT's. Octaves
+ *       cannot split alpha from beta the way DFT bins do, so this trades
+ *       band resolution for the O(N) cost. Without EEG_WAVELET_BAND_POWER, or
+ *       when the window was not decomposed at this rate, nothing changes.
+ */
+void extract_wavelet_band_features(const float energy[][EEG_WAVELET_MAX_LEVELS + 1], int channel_count, int levels)
+{
+#if EEG_WAVELET_BAND_POWER
+    float band_power[BAND_COUNT] = { 0.0f };
+    float channel_power[BAND_COUNT];
+
+    if ((levels <= 0) || ((uint32_t)levels != band_wavelet.levels) || (channel_count <= 0)) return;
+
+    for (int ch = 0; ch < channel_count; ch++) {
+        eeg_wavelet_band_power(&band_wavelet, energy[ch], band_edges_hz, BAND_COUNT, channel_power);
+        for (int band = 0; band < BAND_COUNT; band++) {
+            band_power[band] += channel_power[band] / (float)channel_count;
+        }
+    }
+    set_band_powers(band_power);
+#else
+    (void)energy;
+    (void)channel_count;
+    (void)levels;
+#endif
+}
+
 /**
  * @brief Extract time domain features
  */
-void extract_time_domain_features(const float *left_signal, const float *right_signal, int size)
+void extract_time_domain_features(const float *const channels[], int channel_count, int size)
 {
-    float combined_signal[FFT_SIZE];
+    /* Statistics of the channel-average signal */
+    if (size > FFT_SIZE) size = FFT_SIZE;
     for (int i = 0; i < size; i++) {
-        combined_signal[i] = (left_signal[i] + right_signal[i]) / 2.0f;
+        float sum = 0.0f;
+        for (int ch = 0; ch < channel_count; ch++) {
+            sum += channels[ch][i];
+        }
+        combined_signal[i] = sum / (float)channel_count;
     }
 
     /* Calculate mean */
@@ -343,7 +421,6 @@ void extract_time_domain_features(const float *left_signal, const float *right_s
  */
 static float calculate_hjorth_parameters(const float *signal, int size, float *mobility)
 {
-    float derivative[FFT_SIZE-1];
     for (int i = 0; i < size-1; i++) {
         derivative[i] = signal[i+1] - signal[i];
     }
@@ -370,19 +447,30 @@ static float calculate_hjorth_parameters(const float *signal, int size, float *m
 
 /**
  * @brief Extract coherence features between channels
+ * @note Cross-correlation is averaged over adjacent montage pairs (ch, ch+1),
+ *       which keeps the cost linear in the channel count
  */
-void extract_coherence_features(const float *left_signal, const float *right_signal, int size)
+void extract_coherence_features(const float *const channels[], int channel_count, int size)
 {
     /* Calculate cross-correlation */
-    float correlation_sum = 0.0f, left_sum = 0.0f, right_sum = 0.0f;
-    for (int i = 0; i < size; i++) {
-        correlation_sum += left_signal[i] * right_signal[i];
-        left_sum += left_signal[i] * left_signal[i];
-        right_sum += right_signal[i] * right_signal[i];
-    }
+    float correlation_total = 0.0f;
+    int pairs = 0;
 
-    float denominator = sqrtf(left_sum * right_sum);
-    current_features.cross_correlation = (denominator > 0) ? correlation_sum / denominator : 0.0f;
+    for (int ch = 0; ch + 1 < channel_count; ch++) {
+        const float *a = channels[ch];
+        const float *b = channels[ch + 1];
+        float correlation_sum = 0.0f, a_sum = 0.0f, b_sum = 0.0f;
+        for (int i = 0; i < size; i++) {
+            correlation_sum += a[i] * b[i];
+            a_sum += a[i] * a[i];
+            b_sum += b[i] * b[i];
+        }
+
+        float denominator = sqrtf(a_sum * b_sum);
+        correlation_total += (denominator > 0) ? correlation_sum / denominator : 0.0f;
+        pairs++;
+    }
+    current_features.cross_correlation = (pairs > 0) ? correlation_total / (float)pairs : 0.0f;
 
     /* Simplified coherence calculation */
     current_features.coherence_alpha = fabsf(current_features.cross_correlation) *
@@ -395,19 +483,28 @@ void extract_coherence_features(const float *left_signal, const float *right_sig
 
 /**
  * @brief Extract signal quality features
+ * @param artifact_ratio Flagged fraction of each channel's window (eeg_window_t, eegARTIFACT.c)
+ * @note The samples themselves arrive already repaired; stability is
+ *       discounted by the share of the window that had to be.
  */
-void extract_quality_features(const float *left_signal, const float *right_signal, int size)
+void extract_quality_features(const float *const channels[], int channel_count, int size,
+                              const float artifact_ratio[])
 {
-    (void)left_signal;   // ✅ Suppress unused parameter warnings
-    (void)right_signal;
+    (void)channels;      // ✅ Suppress unused parameter warnings
     (void)size;
 
+    float flagged = 0.0f;
+    for (int ch = 0; ch < channel_count; ch++) {
+        flagged += artifact_ratio[ch];
+    }
+    current_features.artifact_ratio = (channel_count > 0) ? flagged / (float)channel_count : 0.0f;
+
     float signal_power = current_features.rms_amplitude * current_features.rms_amplitude;
     float noise_estimate = current_features.variance * 0.1f;
     current_features.snr_estimate = (noise_estimate > 0) ?
         10.0f * log10f(signal_power / noise_estimate) : 0.0f;
 
-    current_features.signal_stability = 1.0f / (1.0f + current_features.variance);
+    current_features.signal_stability = (1.0f - current_features.artifact_ratio) / (1.0f + current_features.variance);
 }
 
 /**
@@ -438,11 +535,6 @@ static float calculate_spectral_entropy(const float *power_spectrum, int size)
 /**
  * @brief Activation functions
  */
-static float sigmoid_activation(float x)
-{
-    return 1.0f / (1.0f + expf(-x));
-}
-
 static float relu_activation(float x)
 {
     return (x > 0) ? x : 0.0f;
@@ -549,89 +641,88 @@ void task_feature_extraction_entry(INT stacd, void *exinf)
     (void)stacd;
     (void)exinf;
 
-    float *left_buffer, *right_buffer;
+    const float *channel_buffers[EEG_CHANNELS];
     uint32_t buffer_size;
-    ER ercd;
+    eeg_window_t *window;
 
     printf("SHRAVYA: ✅ Feature extraction task ready\r\n");
 
     while(1)
     {
         // ✅ NEW: Add debug before waiting
-        printf("SHRAVYA: 🧠 Waiting for feature extraction semaphore...\r\n");
+        printf("SHRAVYA: 🧠 Waiting for a feature window...\r\n");
 
-        ercd = tk_wai_sem(feature_extraction_semaphore, TMO_FEVR);
-        if (ercd != E_OK) {
-            // ✅ NEW: Add debug for semaphore failure
-            printf("SHRAVYA: ❌ Feature extraction semaphore failed: %d\r\n", ercd);
-            continue; // ✅ EXISTING: E_OK now defined
+        /* The window is ours until released: signal processing fills other buffers meanwhile */
+        window = signal_processing_receive_window(TMO_FEVR);
+        if (window == NULL) {
+            printf("SHRAVYA: ❌ Feature window receive failed\r\n");
+            continue;
         }
 
-        printf("SHRAVYA: 🧠 Feature Extraction - Starting...\r\n");
+        printf("SHRAVYA: 🧠 Feature Extraction - Starting window %u...\r\n", (unsigned) window->sequence);
 
-        if (signal_processing_get_buffer(&left_buffer, &right_buffer, &buffer_size) == FSP_SUCCESS)
-        {
-            // ✅ NEW: Add debug for buffer size
-            printf("SHRAVYA: 📊 Processing %u samples from signal buffer\r\n", buffer_size);
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            channel_buffers[ch] = window->channel[ch];
+        }
+        buffer_size = window->rate.window_samples;
 
-            /* ✅ EXISTING: Cast uint32_t to int to avoid warnings */
-            extract_frequency_features(left_buffer, right_buffer, (int)buffer_size);
+        // ✅ NEW: Add debug for buffer size
+        printf("SHRAVYA: 📊 Processing %u samples from signal buffer\r\n", buffer_size);
 
-            // ✅ NEW: Add debug after frequency features
-            printf("SHRAVYA: ⚡ Frequency features extracted\r\n");
+        /* ✅ EXISTING: Cast uint32_t to int to avoid warnings */
+        extract_frequency_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
+        extract_wavelet_band_features(window->wavelet_energy, EEG_CHANNELS, (int)window->wavelet_levels);
 
-            extract_time_domain_features(left_buffer, right_buffer, (int)buffer_size);
+        // ✅ NEW: Add debug after frequency features
+        printf("SHRAVYA: ⚡ Frequency features extracted\r\n");
 
-            // ✅ NEW: Add debug after time domain features
-            printf("SHRAVYA: ⏱️ Time domain features extracted\r\n");
+        extract_time_domain_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
 
-            extract_coherence_features(left_buffer, right_buffer, (int)buffer_size);
+        // ✅ NEW: Add debug after time domain features
+        printf("SHRAVYA: ⏱️ Time domain features extracted\r\n");
 
-            // ✅ NEW: Add debug after coherence features
-            printf("SHRAVYA: 🔗 Coherence features extracted\r\n");
+        extract_coherence_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
 
-            extract_quality_features(left_buffer, right_buffer, (int)buffer_size);
+        // ✅ NEW: Add debug after coherence features
+        printf("SHRAVYA: 🔗 Coherence features extracted\r\n");
 
-            // ✅ NEW: Add debug after quality features
-            printf("SHRAVYA: 🎛️ Quality features extracted\r\n");
+        extract_quality_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size,
+                                 window->artifact_ratio);
 
-            // ✅ EXISTING: Add safety check for division by zero
-            float focus_score = (current_features.beta_power > 0.000001f) ?
-                               (current_features.alpha_power / current_features.beta_power) : 0.0f;
+        // ✅ NEW: Add debug after quality features
+        printf("SHRAVYA: 🎛️ Quality features extracted\r\n");
 
-            printf("SHRAVYA: ✅ Features extracted - Alpha: %.3f, Beta: %.3f, Focus Score: %.2f\r\n",
-                   current_features.alpha_power, current_features.beta_power, focus_score);
+        /* Features hold everything needed from the samples; give the buffer back */
+        signal_processing_release_window(window);
 
-            // ✅ NEW: Add additional feature details
-            printf("SHRAVYA: 📈 Time features - RMS: %.3f, Variance: %.3f, ZCR: %.3f\r\n",
-                   current_features.rms_amplitude, current_features.variance, current_features.zero_crossing_rate);
+        // ✅ EXISTING: Add safety check for division by zero
+        float focus_score = (current_features.beta_power > 0.000001f) ?
+                           (current_features.alpha_power / current_features.beta_power) : 0.0f;
 
-            // ✅ NEW: Add coherence details
-            printf("SHRAVYA: 🧠 Coherence - Cross-corr: %.3f, Alpha-coh: %.3f, Beta-coh: %.3f\r\n",
-                   current_features.cross_correlation, current_features.coherence_alpha, current_features.coherence_beta);
+        printf("SHRAVYA: ✅ Features extracted - Alpha: %.3f, Beta: %.3f, Focus Score: %.2f\r\n",
+               current_features.alpha_power, current_features.beta_power, focus_score);
 
-            tk_sig_sem(classification_semaphore, 1);
-            printf("SHRAVYA: 📊 Signaling cognitive classification...\r\n");
+        // ✅ NEW: Add additional feature details
+        printf("SHRAVYA: 📈 Time features - RMS: %.3f, Variance: %.3f, ZCR: %.3f\r\n",
+               current_features.rms_amplitude, current_features.variance, current_features.zero_crossing_rate);
 
-            /* WAIT for classification to complete */
-            printf("SHRAVYA: ⏳ Waiting for classification to complete...\r\n");
-            ER class_wait = tk_wai_sem(classification_ready_semaphore, TMO_FEVR);
-            if (class_wait == E_OK) {
-                printf("SHRAVYA: ✅ Classification completed\r\n");
-            } else {
-                printf("SHRAVYA: ⚠️ Classification wait failed: %d\r\n", class_wait);
-            }
+        // ✅ NEW: Add coherence details
+        printf("SHRAVYA: 🧠 Coherence - Cross-corr: %.3f, Alpha-coh: %.3f, Beta-coh: %.3f\r\n",
+               current_features.cross_correlation, current_features.coherence_alpha, current_features.coherence_beta);
 
-            /* Signal back that features are done */
-            tk_sig_sem(features_ready_semaphore, 1);
-            printf("SHRAVYA: ✅ Feature extraction cycle complete\r\n");
+        tk_sig_sem(classification_semaphore, 1);
+        printf("SHRAVYA: 📊 Signaling cognitive classification...\r\n");
 
+        /* WAIT for classification to complete */
+        printf("SHRAVYA: ⏳ Waiting for classification to complete...\r\n");
+        ER class_wait = tk_wai_sem(classification_ready_semaphore, TMO_FEVR);
+        if (class_wait == E_OK) {
+            printf("SHRAVYA: ✅ Classification completed\r\n");
+        } else {
+            printf("SHRAVYA: ⚠️ Classification wait failed: %d\r\n", class_wait);
         }
-        else
-        {
-            // ✅ EXISTING: Debug log when buffer not available
-            printf("SHRAVYA: ⚠️ Signal processing buffer not ready\r\n");
-        }
+
+        printf("SHRAVYA: ✅ Feature extraction cycle complete\r\n");
     }
 }
 
@@ -505,8 +505,8 @@ void task_communication_entry(INT stacd, void *exinf)
 
             /* Fill signal quality */
             payload.signal_quality.snr_db = current_features.snr_estimate;
-            payload.signal_quality.artifact_detected = (current_features.signal_stability < 0.7f);
-            payload.sampling_rate = 500; /* 500 Hz from ADS1263 */
+            payload.signal_quality.artifact_detected = (current_features.artifact_ratio > EEG_ARTIFACT_MAX_RATIO);
+            payload.sampling_rate = signal_processing_get_rate()->sample_rate_hz;
 
             /* Build JSON and send with retry logic */
             build_n8n_json_payload(&payload, json_buffer, JSON_BUFFER_SIZE);
@@ -0,0 +1,250 @@
+#include "hal_data.h"
+#include "eegARTIFACT.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file eegARTIFACT.c
+ * @brief Window-level artifact detection and repair
+ *
+ * Runs once per completed window, on the conditioned window-rate samples,
+ * before the window is posted to feature extraction. Each kind of artifact
+ * is one pass over a channel with no branches in the loop body (compares
+ * turned into flag bits), so the passes vectorize; only the repair walks
+ * the flagged runs. Limits are robust z-scores against running median/MAD
+ * statistics, plus the absolute EEG_ARTIFACT_AMPLITUDE_UV.
+ *
+ * A flagged run is replaced by a monotone cubic (Fritsch-Carlson Hermite)
+ * between the clean samples either side, with their one-sided slopes: it
+ * joins the surrounding signal without a step or a kink, so repair does not
+ * add the broadband energy a held or scaled sample would, and it cannot
+ * overshoot the anchors however long the gap. Runs touching a window edge
+ * hold the nearest clean sample; the next window sees them from inside.
+ */
+
+#define MAD_TO_SD            1.4826f    // Robust SD of Gaussian data from its median absolute deviation
+#define ARTIFACT_MIN_SD_UV   0.5f       // Floor under the robust SDs: a quiet channel's own noise is not an artifact
+#define ARTIFACT_MAX_UPDATE  0.5f       // Channels flagged beyond this fraction do not move the running statistics
+
+static float scratch[EEG_WINDOW_MAX_SAMPLES];
+static uint16_t flat_run[EEG_WINDOW_MAX_SAMPLES];
+static uint8_t common_positive[EEG_WINDOW_MAX_SAMPLES];
+static uint8_t common_negative[EEG_WINDOW_MAX_SAMPLES];
+
+/**
+ * @brief Restart the running statistics for windows at @p rate
+ * @note The first window after this primes the statistics with its own.
+ */
+void eeg_artifact_init(eeg_artifact_detector_t *detector, const eeg_rate_t *rate)
+{
+    float window_rate_hz = (float) rate->window_rate_hz;
+    float hop_s = (float) rate->hop_samples / window_rate_hz;
+    uint32_t flat_samples = (uint32_t) (EEG_ARTIFACT_FLAT_S * window_rate_hz + 0.5f);
+
+    memset(detector, 0, sizeof(*detector));
+    detector->adapt = fminf(hop_s / EEG_ARTIFACT_ADAPT_S, 1.0f);
+    detector->flat_samples = (flat_samples < 2U) ? 2U : flat_samples;
+}
+
+/** k-th smallest of v[0..n), reordering v (Wirth's selection, O(n) on average) */
+static float select_kth(float *v, int n, int k)
+{
+    int lo = 0;
+    int hi = n - 1;
+
+    while (lo < hi) {
+        float pivot = v[k];
+        int i = lo;
+        int j = hi;
+        do {
+            while (v[i] < pivot) i++;
+            while (pivot < v[j]) j--;
+            if (i <= j) {
+                float t = v[i];
+                v[i++] = v[j];
+                v[j--] = t;
+            }
+        } while (i <= j);
+        if (j < k) lo = i;
+        if (k < i) hi = j;
+    }
+    return v[k];
+}
+
+/** Median, robust SD and robust SD of the steps of x[0..n) */
+static void window_statistics(const float *x, uint32_t n, float *centre, float *spread, float *step_spread)
+{
+    memcpy(scratch, x, n * sizeof(float));
+    float median = select_kth(scratch, (int) n, (int) n / 2);
+
+    for (uint32_t i = 0; i < n; i++) {
+        scratch[i] = fabsf(x[i] - median);
+    }
+    float mad = select_kth(scratch, (int) n, (int) n / 2);
+
+    for (uint32_t i = 1; i < n; i++) {
+        scratch[i - 1U] = fabsf(x[i] - x[i - 1U]);
+    }
+    float step = select_kth(scratch, (int) n - 1, (int) (n - 1U) / 2);
+
+    *centre = median;
+    *spread = MAD_TO_SD * mad;
+    *step_spread = MAD_TO_SD * step;    // Zero-mean steps: median |step| is their MAD
+}
+
+/** Replace flagged x[a..b) - x[a - 1] and x[b] are clean where they exist */
+static void repair_run(float *x, const uint8_t *mask, uint32_t n, uint32_t a, uint32_t b, float fill)
+{
+    if ((0U == a) || (n == b)) {
+        float hold = (0U != a) ? x[a - 1U] : (n != b) ? x[b] : fill;
+        for (uint32_t i = a; i < b; i++) {
+            x[i] = hold;
+        }
+        return;
+    }
+
+    const uint32_t left = a - 1U;
+    const uint32_t right = b;
+    const float span = (float) (right - left);
+    const float y0 = x[left];
+    const float y1 = x[right];
+    const float delta = (y1 - y0) / span;
+    float m0 = ((left > 0U) && !mask[left - 1U]) ? x[left] - x[left - 1U] : 0.0f;
+    float m1 = ((right + 1U < n) && !mask[right + 1U]) ? x[right + 1U] - x[right] : 0.0f;
+
+    /* Fritsch-Carlson: slopes against the secant's sign are dropped (both on a flat
+     * secant), the rest scaled into the monotone region (m0^2 + m1^2 <= 9 delta^2) */
+    if (m0 * delta <= 0.0f) m0 = 0.0f;
+    if (m1 * delta <= 0.0f) m1 = 0.0f;
+    float r = m0 * m0 + m1 * m1;
+    if (r > 9.0f * delta * delta) {
+        float tau = 3.0f * fabsf(delta) / sqrtf(r);
+        m0 *= tau;
+        m1 *= tau;
+    }
+
+    for (uint32_t i = a; i < b; i++) {
+        float t = (float) (i - left) / span;
+        float t2 = t * t;
+        float t3 = t2 * t;
+        x[i] = (2.0f * t3 - 3.0f * t2 + 1.0f) * y0 + (t3 - 2.0f * t2 + t) * span * m0 +
+               (3.0f * t2 - 2.0f * t3) * y1 + (t3 - t2) * span * m1;
+    }
+}
+
+/**
+ * @brief Flag, repair and rate the artifacts of a completed window, in place
+ * @param fresh Newest samples not in any earlier window (the hop; all of the first window)
+ * @return Samples among the @p fresh newest with a flag on any channel
+ * @note Adds to window->mask (flags it was pushed with, EEG_ARTIFACT_EXCLUDED,
+ *       are kept and repaired like the rest) and fills window->artifact_ratio;
+ *       window->channel holds the repaired samples afterwards.
+ */
+uint32_t eeg_artifact_process(eeg_artifact_detector_t *detector, eeg_window_t *window, uint32_t fresh)
+{
+    const uint32_t n = window->rate.window_samples;
+    float centre[EEG_CHANNELS];
+    float spread[EEG_CHANNELS];
+    float step_spread[EEG_CHANNELS];
+
+    if (n < 2U) {
+        return 0U;
+    }
+
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        window_statistics(window->channel[ch], n, &centre[ch], &spread[ch], &step_spread[ch]);
+    }
+    if (!detector->primed) {
+        memcpy(detector->centre, centre, sizeof(centre));
+        memcpy(detector->spread, spread, sizeof(spread));
+        memcpy(detector->step_spread, step_spread, sizeof(step_spread));
+        detector->primed = true;
+    }
+
+    memset(common_positive, 0, n);
+    memset(common_negative, 0, n);
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        const float *x = window->channel[ch];
+        uint8_t *mask = window->mask[ch];
+        const float c = detector->centre[ch];
+        const float sd = fmaxf(detector->spread[ch], ARTIFACT_MIN_SD_UV);
+        const float amplitude_limit = EEG_ARTIFACT_AMPLITUDE_Z * sd;
+        const float common_limit = EEG_ARTIFACT_COMMON_Z * sd;
+        const float step_limit = EEG_ARTIFACT_GRADIENT_Z * fmaxf(detector->step_spread[ch], ARTIFACT_MIN_SD_UV);
+
+        /* Amplitude and gradient (the first sample has no step inside the window) */
+        mask[0] |= (uint8_t) (((fabsf(x[0] - c) > amplitude_limit) | (fabsf(x[0]) > EEG_ARTIFACT_AMPLITUDE_UV)) *
+                             EEG_ARTIFACT_AMPLITUDE);
+        for (uint32_t i = 1; i < n; i++) {
+            uint32_t amplitude = (fabsf(x[i] - c) > amplitude_limit) | (fabsf(x[i]) > EEG_ARTIFACT_AMPLITUDE_UV);
+            uint32_t gradient = fabsf(x[i] - x[i - 1U]) > step_limit;
+            mask[i] |= (uint8_t) (amplitude * EEG_ARTIFACT_AMPLITUDE | gradient * EEG_ARTIFACT_GRADIENT);
+        }
+
+        /* Common-mode votes */
+        for (uint32_t i = 0; i < n; i++) {
+            common_positive[i] = (uint8_t) (common_positive[i] + (x[i] - c > common_limit));
+            common_negative[i] = (uint8_t) (common_negative[i] + (x[i] - c < -common_limit));
+        }
+
+        /* Flat runs: steps since the run started, then each long enough run marked back from its end */
+        flat_run[0] = 0;
+        for (uint32_t i = 1; i < n; i++) {
+            flat_run[i] = (uint16_t) ((fabsf(x[i] - x[i - 1U]) < EEG_ARTIFACT_FLAT_UV) * (flat_run[i - 1U] + 1U));
+        }
+        uint32_t remaining = 0;
+        for (uint32_t i = n; i-- > 0U;) {
+            uint32_t run = (flat_run[i] >= detector->flat_samples) ? flat_run[i] + 1U : 0U;
+            remaining = (run > remaining) ? run : remaining;
+            mask[i] |= (uint8_t) ((remaining > 0U) * EEG_ARTIFACT_FLAT);
+            remaining -= (remaining > 0U);
+        }
+    }
+
+    if (EEG_CHANNELS > 1) {
+        for (uint32_t i = 0; i < n; i++) {
+            common_positive[i] = (uint8_t) ((common_positive[i] == EEG_CHANNELS) | (common_negative[i] == EEG_CHANNELS));
+        }
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            for (uint32_t i = 0; i < n; i++) {
+                window->mask[ch][i] |= (uint8_t) (common_positive[i] * EEG_ARTIFACT_COMMON);
+            }
+        }
+    }
+
+    /* Repair each flagged run; ratios, and the running statistics from mostly clean channels */
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        float *x = window->channel[ch];
+        const uint8_t *mask = window->mask[ch];
+        uint32_t flagged = 0;
+
+        for (uint32_t i = 0; i < n;) {
+            if (!mask[i]) {
+                i++;
+                continue;
+            }
+            uint32_t start = i;
+            while ((i < n) && mask[i]) i++;
+            repair_run(x, mask, n, start, i, detector->centre[ch]);
+            flagged += i - start;
+        }
+        window->artifact_ratio[ch] = (float) flagged / (float) n;
+
+        if (window->artifact_ratio[ch] <= ARTIFACT_MAX_UPDATE) {
+            detector->centre[ch] += detector->adapt * (centre[ch] - detector->centre[ch]);
+            detector->spread[ch] += detector->adapt * (spread[ch] - detector->spread[ch]);
+            detector->step_spread[ch] += detector->adapt * (step_spread[ch] - detector->step_spread[ch]);
+        }
+    }
+
+    if (fresh > n) fresh = n;
+    uint32_t fresh_flagged = 0;
+    for (uint32_t i = n - fresh; i < n; i++) {
+        uint8_t any = 0;
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            any |= window->mask[ch][i];
+        }
+        fresh_flagged += (0U != any);
+    }
+    return fresh_flagged;
+}
@@ -0,0 +1,439 @@
+#include "hal_data.h"
+#include "eegBIQUAD.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file eegBIQUAD.c
+ * @brief Block biquad cascade (Direct Form I)
+ *
+ * The block runs two sections per pass: both sections' coefficients and
+ * state stay in registers for the whole block instead of being reloaded
+ * from the filter struct for every sample, and the two recursions are
+ * independent from one sample to the next, so they overlap in the
+ * pipeline instead of waiting on each other. Per section the expression is
+ * the one the per-sample path evaluated, so the output matches it exactly.
+ *
+ * Direct Form I rather than II Transposed: with the 0.5Hz highpass poles
+ * this close to the unit circle, DF2T's state words carry the large
+ * cancelling terms and lose several times more precision in float.
+ *
+ * With EEG_BIQUAD_CMSIS_DSP the same struct is handed to
+ * arm_biquad_cascade_df1_f32, which CMSIS-DSP builds with Helium (MVE) on
+ * the Cortex-M85.
+ *
+ * The lane bank (eeg_biquad_lanes_*) vectorises across channels instead of
+ * along time: a biquad's recursion cannot be split over samples, but
+ * channels running the same coefficients are independent, so each sample
+ * step is one multiply-add per coefficient over all lanes. Lanes are GCC/
+ * Clang generic vectors, which the compiler maps onto Helium (4 floats per
+ * Q register) or SSE/NEON on the host; 8 lanes are two independent 4-lane
+ * recursions that overlap in the pipeline, so a frame of 8 channels costs
+ * little more than one of 2. Each lane
+ * evaluates the same expression as eeg_biquad_process(), so its output is
+ * identical to filtering that channel alone.
+ *
+ * The Q31 cascade (eeg_biquad_q31_*) is the integer-only alternative for
+ * the low-power build; see eeg_biquad_q31_t for the number formats.
+ */
+
+#if EEG_BIQUAD_CMSIS_DSP
+/**
+ * @brief (Re)bind the CMSIS-DSP instance; its init clears the state, so keep ours
+ */
+static void cascade_bind(eeg_biquad_cascade_t *cascade)
+{
+    float state[EEG_BIQUAD_MAX_STAGES * 4];
+
+    memcpy(state, cascade->state, sizeof(state));
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    arm_biquad_cascade_df1_mve_init_f32(&cascade->instance, (uint8_t) cascade->stages, cascade->coeffs,
+                                        cascade->coeffs_mve, cascade->state);
+#else
+    arm_biquad_cascade_df1_init_f32(&cascade->instance, (uint8_t) cascade->stages, cascade->coeffs, cascade->state);
+#endif
+    memcpy(cascade->state, state, sizeof(state));
+}
+#endif
+
+/**
+ * @brief Pass-through cascade of @p stages sections with zero state
+ */
+void eeg_biquad_init(eeg_biquad_cascade_t *cascade, uint32_t stages)
+{
+    memset(cascade, 0, sizeof(*cascade));
+    cascade->stages = (stages > EEG_BIQUAD_MAX_STAGES) ? EEG_BIQUAD_MAX_STAGES : stages;
+    for (uint32_t s = 0; s < cascade->stages; s++) {
+        cascade->coeffs[s * 5U] = 1.0f;
+    }
+#if EEG_BIQUAD_CMSIS_DSP
+    cascade_bind(cascade);
+#endif
+}
+
+/**
+ * @brief Load one section, leaving the state untouched
+ * @note a1/a2 as in y = b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2 (a0 = 1)
+ */
+void eeg_biquad_set_stage(eeg_biquad_cascade_t *cascade, uint32_t stage,
+                          float b0, float b1, float b2, float a1, float a2)
+{
+    if (stage >= cascade->stages) return;
+
+    float *k = &cascade->coeffs[stage * 5U];
+    k[0] = b0;
+    k[1] = b1;
+    k[2] = b2;
+    k[3] = -a1;
+    k[4] = -a2;
+#if EEG_BIQUAD_CMSIS_DSP
+    cascade_bind(cascade);
+#endif
+}
+
+/**
+ * @brief Clear the filter state
+ */
+void eeg_biquad_reset(eeg_biquad_cascade_t *cascade)
+{
+    memset(cascade->state, 0, sizeof(cascade->state));
+}
+
+/**
+ * @brief Filter @p count samples through every section
+ * @param output May equal @p input
+ */
+void eeg_biquad_process(eeg_biquad_cascade_t *cascade, const float *input, float *output, uint32_t count)
+{
+    if (0U == count) return;
+
+#if EEG_BIQUAD_CMSIS_DSP
+    arm_biquad_cascade_df1_f32(&cascade->instance, input, output, count);
+#else
+    const float *in = input;
+    uint32_t s = 0;
+
+    for (; s + 1U < cascade->stages; s += 2U) {
+        const float *k = &cascade->coeffs[s * 5U];
+        const float b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+        const float c0 = k[5], c1 = k[6], c2 = k[7], e1 = k[8], e2 = k[9];
+        float *state = &cascade->state[s * 4U];
+        float x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+        float u1 = state[4], u2 = state[5], v1 = state[6], v2 = state[7];
+
+        for (uint32_t i = 0; i < count; i++) {
+            float x = in[i];
+            float y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+
+            float z = c0 * y + c1 * u1 + c2 * u2 + e1 * v1 + e2 * v2;
+            u2 = u1;
+            u1 = y;
+            v2 = v1;
+            v1 = z;
+            output[i] = z;
+        }
+
+        state[0] = x1; state[1] = x2; state[2] = y1; state[3] = y2;
+        state[4] = u1; state[5] = u2; state[6] = v1; state[7] = v2;
+        in = output;
+    }
+
+    if (s < cascade->stages) {
+        const float *k = &cascade->coeffs[s * 5U];
+        const float b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+        float *state = &cascade->state[s * 4U];
+        float x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+        for (uint32_t i = 0; i < count; i++) {
+            float x = in[i];
+            float y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            output[i] = y;
+        }
+
+        state[0] = x1; state[1] = x2; state[2] = y1; state[3] = y2;
+    } else if ((0U == cascade->stages) && (output != input)) {
+        memcpy(output, input, count * sizeof(float));
+    }
+#endif
+}
+
+/**
+ * @brief Lane bank of @p stages pass-through sections and zero state
+ * @param lanes Rounded up to 2, 4 or 8
+ */
+void eeg_biquad_lanes_init(eeg_biquad_lanes_t *bank, uint32_t stages, uint32_t lanes)
+{
+    memset(bank, 0, sizeof(*bank));
+    bank->stages = (stages > EEG_BIQUAD_MAX_STAGES) ? EEG_BIQUAD_MAX_STAGES : stages;
+    bank->lanes = EEG_BIQUAD_LANES_FOR(lanes);
+    for (uint32_t s = 0; s < bank->stages; s++) {
+        bank->coeffs[s * 5U] = 1.0f;
+    }
+}
+
+/**
+ * @brief Take every lane's coefficients from a designed cascade, leaving the state untouched
+ */
+void eeg_biquad_lanes_load(eeg_biquad_lanes_t *bank, const eeg_biquad_cascade_t *design)
+{
+    bank->stages = design->stages;
+    memcpy(bank->coeffs, design->coeffs, sizeof(bank->coeffs));
+}
+
+/**
+ * @brief Clear the state of every lane
+ */
+void eeg_biquad_lanes_reset(eeg_biquad_lanes_t *bank)
+{
+    memset(bank->state, 0, sizeof(bank->state));
+}
+
+/* Generic vectors (GCC/Clang): 4 lanes = one Helium Q register (SSE/NEON on the host), 2 lanes = a pair */
+typedef float lane4_t __attribute__((vector_size(16)));
+typedef float lane2_t __attribute__((vector_size(8)));
+
+/**
+ * @brief One section over @p count frames of 2 lanes
+ */
+static void lanes_section_2(const float *k, float state[4][EEG_BIQUAD_MAX_LANES], const float *input, float *output,
+                            uint32_t count)
+{
+    const float b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+    lane2_t x1, x2, y1, y2;
+
+    memcpy(&x1, state[0], sizeof(x1));
+    memcpy(&x2, state[1], sizeof(x2));
+    memcpy(&y1, state[2], sizeof(y1));
+    memcpy(&y2, state[3], sizeof(y2));
+
+    for (uint32_t i = 0; i < count; i++) {
+        lane2_t x;
+        memcpy(&x, &input[i * 2U], sizeof(x));
+        lane2_t y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        memcpy(&output[i * 2U], &y, sizeof(y));
+    }
+
+    memcpy(state[0], &x1, sizeof(x1));
+    memcpy(state[1], &x2, sizeof(x2));
+    memcpy(state[2], &y1, sizeof(y1));
+    memcpy(state[3], &y2, sizeof(y2));
+}
+
+/**
+ * @brief One section over @p count frames of 4 lanes
+ */
+static void lanes_section_4(const float *k, float state[4][EEG_BIQUAD_MAX_LANES], const float *input, float *output,
+                            uint32_t count)
+{
+    const float b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+    lane4_t x1, x2, y1, y2;
+
+    memcpy(&x1, state[0], sizeof(x1));
+    memcpy(&x2, state[1], sizeof(x2));
+    memcpy(&y1, state[2], sizeof(y1));
+    memcpy(&y2, state[3], sizeof(y2));
+
+    for (uint32_t i = 0; i < count; i++) {
+        lane4_t x;
+        memcpy(&x, &input[i * 4U], sizeof(x));
+        lane4_t y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        memcpy(&output[i * 4U], &y, sizeof(y));
+    }
+
+    memcpy(state[0], &x1, sizeof(x1));
+    memcpy(state[1], &x2, sizeof(x2));
+    memcpy(state[2], &y1, sizeof(y1));
+    memcpy(state[3], &y2, sizeof(y2));
+}
+
+/**
+ * @brief One section over @p count frames of 8 lanes - two independent 4-lane recursions
+ */
+static void lanes_section_8(const float *k, float state[4][EEG_BIQUAD_MAX_LANES], const float *input, float *output,
+                            uint32_t count)
+{
+    const float b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+    lane4_t x1, x2, y1, y2;     // Lanes 0-3
+    lane4_t u1, u2, v1, v2;     // Lanes 4-7
+
+    memcpy(&x1, &state[0][0], sizeof(x1));
+    memcpy(&x2, &state[1][0], sizeof(x2));
+    memcpy(&y1, &state[2][0], sizeof(y1));
+    memcpy(&y2, &state[3][0], sizeof(y2));
+    memcpy(&u1, &state[0][4], sizeof(u1));
+    memcpy(&u2, &state[1][4], sizeof(u2));
+    memcpy(&v1, &state[2][4], sizeof(v1));
+    memcpy(&v2, &state[3][4], sizeof(v2));
+
+    for (uint32_t i = 0; i < count; i++) {
+        lane4_t x, u;
+        memcpy(&x, &input[i * 8U], sizeof(x));
+        memcpy(&u, &input[i * 8U + 4U], sizeof(u));
+        lane4_t y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+        lane4_t v = b0 * u + b1 * u1 + b2 * u2 + a1 * v1 + a2 * v2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        u2 = u1;
+        u1 = u;
+        v2 = v1;
+        v1 = v;
+        memcpy(&output[i * 8U], &y, sizeof(y));
+        memcpy(&output[i * 8U + 4U], &v, sizeof(v));
+    }
+
+    memcpy(&state[0][0], &x1, sizeof(x1));
+    memcpy(&state[1][0], &x2, sizeof(x2));
+    memcpy(&state[2][0], &y1, sizeof(y1));
+    memcpy(&state[3][0], &y2, sizeof(y2));
+    memcpy(&state[0][4], &u1, sizeof(u1));
+    memcpy(&state[1][4], &u2, sizeof(u2));
+    memcpy(&state[2][4], &v1, sizeof(v1));
+    memcpy(&state[3][4], &v2, sizeof(v2));
+}
+
+/**
+ * @brief Filter @p count frames (input[i * lanes + lane]) through every section
+ * @param output May equal @p input
+ */
+void eeg_biquad_lanes_process(eeg_biquad_lanes_t *bank, const float *input, float *output, uint32_t count)
+{
+    const float *in = input;
+
+    for (uint32_t s = 0; s < bank->stages; s++) {
+        const float *k = &bank->coeffs[s * 5U];
+        float (*state)[EEG_BIQUAD_MAX_LANES] = &bank->state[s * 4U];
+        switch (bank->lanes) {
+            case 2: lanes_section_2(k, state, in, output, count); break;
+            case 4: lanes_section_4(k, state, in, output, count); break;
+            default: lanes_section_8(k, state, in, output, count); break;
+        }
+        in = output;
+    }
+    if ((0U == bank->stages) && (output != input)) {
+        memcpy(output, input, count * bank->lanes * sizeof(float));
+    }
+}
+
+/**
+ * @brief Empty Q31 cascade (no sections: process only scales)
+ */
+void eeg_biquad_q31_init(eeg_biquad_q31_t *cascade)
+{
+    memset(cascade, 0, sizeof(*cascade));
+    cascade->output_scale = 1.0f;
+}
+
+/**
+ * @brief Quantise a designed cascade, leaving the state untouched
+ * @param output_scale Output units per Q31 full scale, applied by the last section
+ */
+void eeg_biquad_q31_load(eeg_biquad_q31_t *cascade, const eeg_biquad_cascade_t *design, float output_scale)
+{
+    float largest = 0.0f;
+    uint32_t shift = 0;
+
+    for (uint32_t i = 0; i < design->stages * 5U; i++) {
+        float magnitude = fabsf(design->coeffs[i]);
+        if (magnitude > largest) largest = magnitude;
+    }
+    while ((shift < 8U) && (largest >= (float) (1U << shift))) shift++;
+
+    const double scale = (double) (1UL << (31U - shift));
+    for (uint32_t i = 0; i < design->stages * 5U; i++) {
+        double q = floor((double) design->coeffs[i] * scale + 0.5);
+        cascade->coeffs[i] = (q > 2147483647.0) ? INT32_MAX : (int32_t) q;
+    }
+    cascade->stages = design->stages;
+    cascade->shift = shift;
+    cascade->output_scale = output_scale;
+}
+
+/**
+ * @brief Clear the filter state
+ */
+void eeg_biquad_q31_reset(eeg_biquad_q31_t *cascade)
+{
+    memset(cascade->x_state, 0, sizeof(cascade->x_state));
+    memset(cascade->y_state, 0, sizeof(cascade->y_state));
+}
+
+/**
+ * @brief floor(a * y / 2^32) for a Q(31 - shift) coefficient and a Q63 history value
+ */
+static inline int64_t mul_q31_q63(int32_t a, int64_t y)
+{
+    int64_t high = (int64_t) a * (int32_t) (y >> 32);
+    int64_t low = ((int64_t) a * (int64_t) (uint32_t) y) >> 32;
+    return high + low;
+}
+
+/**
+ * @brief Filter @p count Q31 samples through every section
+ * @param samples Q31 input (full scale = ±1); overwritten with intermediate sections
+ * @param output Receives the filtered samples times output_scale
+ */
+void eeg_biquad_q31_process(eeg_biquad_q31_t *cascade, int32_t *samples, float *output, uint32_t count)
+{
+    const uint32_t shift = cascade->shift;
+    const int64_t limit = INT64_MAX >> (shift + 1U);     // Accumulator range that fits Q63
+    const float scale = cascade->output_scale / 2147483648.0f;
+
+    if (0U == cascade->stages) {
+        for (uint32_t i = 0; i < count; i++) output[i] = (float) samples[i] * scale;
+        return;
+    }
+
+    for (uint32_t s = 0; s < cascade->stages; s++) {
+        const int32_t *k = &cascade->coeffs[s * 5U];
+        const int32_t b0 = k[0], b1 = k[1], b2 = k[2], a1 = k[3], a2 = k[4];
+        const bool last = (s + 1U == cascade->stages);
+        int32_t x1 = cascade->x_state[s * 2U], x2 = cascade->x_state[s * 2U + 1U];
+        int64_t y1 = cascade->y_state[s * 2U], y2 = cascade->y_state[s * 2U + 1U];
+
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t x = samples[i];
+
+            /* Q(62 - shift); summed modulo 2^64 - partial sums may leave the range, a stable section's result does not */
+            uint64_t sum = (uint64_t) ((int64_t) b0 * x) + (uint64_t) ((int64_t) b1 * x1) +
+                           (uint64_t) ((int64_t) b2 * x2) + (uint64_t) mul_q31_q63(a1, y1) +
+                           (uint64_t) mul_q31_q63(a2, y2);
+            int64_t acc = (int64_t) sum;
+            if (acc > limit) acc = limit;
+            else if (acc < -limit) acc = -limit;
+
+            int64_t y = (int64_t) ((uint64_t) acc << (shift + 1U));    // Q63
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            int64_t rounded = ((y >> 31) + 1) >> 1;                 // Q31 into the next section, rounded
+            samples[i] = (rounded > INT32_MAX) ? INT32_MAX : (int32_t) rounded;
+
+            /* Output scaling folded into the last section */
+            if (last) output[i] = (float) samples[i] * scale;
+        }
+
+        cascade->x_state[s * 2U] = x1;
+        cascade->x_state[s * 2U + 1U] = x2;
+        cascade->y_state[s * 2U] = y1;
+        cascade->y_state[s * 2U + 1U] = y2;
+    }
+}
@@ -0,0 +1,476 @@
+#include "hal_data.h"
+#include "eegBUFFER.h"
+#include "eegRATE.h"
+#include "eegRECORDER.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file eegBUFFER.c
+ * @brief Acquisition sample ring - lock-free SPSC hand-off from acquisition to signal processing
+ *
+ * The acquisition task writes one sample per conversion (eeg_buffer_write());
+ * the processing task reads them in place as at most two spans and commits
+ * what it filtered. Timestamps and sequence numbers are delta-encoded per
+ * block of EEG_QUALITY_BLOCK_SAMPLES, next to the block's quality summary.
+ *
+ * A sample-rate switch is published at the ring index it takes effect, so the
+ * consumer reconfigures exactly between the last old-rate and the first
+ * new-rate sample. The raw recorder reads a second cursor, advanced from the
+ * producer task, so a slow flash erase never holds back processing.
+ *
+ * Plain C with GCC atomics and no FSP calls: the host build runs the same
+ * ring between the ADS1263 model and the processing chain.
+ */
+
+typedef enum {
+    RECORD_REQUEST_NONE = 0,
+    RECORD_REQUEST_START,
+    RECORD_REQUEST_STOP
+} eeg_record_request_t;
+
+static eeg_sample_ring_t eeg_buffer;
+static const float *block_impedance_kohms = NULL;  // Latest impedance per channel, owned by the acquisition side
+static float block_count_uv[EEG_CHANNELS];         // μV per ring count of each channel's ADC
+static int32_t block_clip_counts[EEG_CHANNELS];    // Saturation threshold of each channel's ADC
+
+/* Producer-side history for delta encoding (only touched by the writer) */
+static uint32_t ring_last_timestamp_us = 0;
+static uint32_t ring_last_sequence = 0;
+
+/* Sample-rate switch: published by the producer, taken by the consumer at rate_switch_index */
+static volatile bool rate_switch_pending = false;  // rate_switch published, not yet taken
+static uint32_t rate_switch_index = 0;             // First ring index at the new rate
+static eeg_rate_t rate_switch;
+
+/* Raw recorder: requested from any task, fed from the ring by the producer */
+static volatile uint32_t record_request = RECORD_REQUEST_NONE;
+static bool record_rate_pending = false;           // rate_switch not yet passed to the recorder
+static uint32_t record_session_id = 0;
+
+static const eeg_recorder_source_t eeg_ring_source = {
+    .timestamp_at = eeg_buffer_timestamp_at,
+    .sequence_at = eeg_buffer_sequence_at,
+};
+
+/**
+ * @brief Initialize SPSC Sample Ring for Real Data
+ * @param impedance_kohms EEG_CHANNELS latest electrode impedances, read when a
+ *        block's quality is summarised (NULL: contact judged on amplitude only)
+ */
+fsp_err_t eeg_buffer_init(const float *impedance_kohms)
+{
+    printf("SHRAVYA: Initializing lock-free sample ring for real EEG data...\r\n");
+
+    __atomic_store_n(&eeg_buffer.write_index, 0U, __ATOMIC_RELAXED);
+    __atomic_store_n(&eeg_buffer.read_index, 0U, __ATOMIC_RELAXED);
+    eeg_buffer.overflow_count = 0;
+    eeg_buffer.record_index = 0;
+    eeg_buffer.record_overruns = 0;
+    ring_last_timestamp_us = 0;
+    ring_last_sequence = 0;
+    block_impedance_kohms = impedance_kohms;
+    for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) {
+        block_count_uv[ch] = ads1263_montage_count_uv(ch);
+        block_clip_counts[ch] = ads1263_montage_clip_counts(ch);
+    }
+    __atomic_store_n(&rate_switch_pending, false, __ATOMIC_RELAXED);
+    record_rate_pending = false;
+
+    /* Clear buffer memory */
+    memset(eeg_buffer.channel, 0, sizeof(eeg_buffer.channel));
+    memset(eeg_buffer.drl, 0, sizeof(eeg_buffer.drl));
+    memset(eeg_buffer.blocks, 0, sizeof(eeg_buffer.blocks));
+
+    printf("SHRAVYA: Buffer initialized for %u samples x %u channels (%u-sample blocks, %lu bytes)\r\n",
+           (unsigned) EEG_BUFFER_SIZE_SAMPLES, (unsigned) EEG_CHANNELS, (unsigned) EEG_QUALITY_BLOCK_SAMPLES,
+           (unsigned long) sizeof(eeg_buffer));
+
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Fold one sample into its block's quality summary
+ * @note Same thresholds as ads1263_assess_channel_quality(), computed from raw
+ *       counts scaled per channel (ADC1 32-bit, ADC2 24-bit at gain 16)
+ */
+static void eeg_block_quality_accumulate(eeg_block_quality_t *q, const int32_t counts[EEG_CHANNELS],
+                                         uint32_t held_mask, uint32_t clipped_mask, bool first)
+{
+    bool contact[EEG_CHANNELS];
+    bool saturated = (0U != clipped_mask);
+    uint32_t poor_contact = 0;
+
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        float uv = fabsf((float) counts[ch]) * block_count_uv[ch];
+        float kohms = block_impedance_kohms ? block_impedance_kohms[ch] : 0.0f;
+        contact[ch] = (uv > 1.0f) && (uv < 500.0f) && (kohms < EEG_IMPEDANCE_CONTACT_KOHMS);
+        if (!contact[ch]) poor_contact++;
+    }
+
+    /* Contact penalty is 50 points split across channels */
+    uint32_t penalty = (saturated ? 50U : 0U) + (50U * poor_contact) / EEG_CHANNELS;
+    uint8_t score = (uint8_t) (100U - penalty);
+
+    if (first) {
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            q->impedance_kohms[ch] = block_impedance_kohms ? block_impedance_kohms[ch] : 0.0f;
+            q->channel_min[ch] = q->channel_max[ch] = counts[ch];
+            q->contact_good[ch] = contact[ch];
+        }
+        q->saturated_samples = 0;
+        q->sequence_gaps = 0;
+        q->impedance_held_samples = 0;
+        q->min_integrity_score = score;
+    } else {
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            if (counts[ch] < q->channel_min[ch]) q->channel_min[ch] = counts[ch];
+            if (counts[ch] > q->channel_max[ch]) q->channel_max[ch] = counts[ch];
+            q->contact_good[ch] = q->contact_good[ch] && contact[ch];
+        }
+        if (score < q->min_integrity_score) q->min_integrity_score = score;
+    }
+
+    if (saturated) q->saturated_samples++;
+    if (held_mask) q->impedance_held_samples++;
+}
+
+/**
+ * @brief Write Real EEG Sample to Ring (producer side only)
+ * @return FSP_ERR_INSUFFICIENT_SPACE when the ring is full and the sample was dropped
+ * @note Indices are free-running; a full ring drops the new sample and counts it,
+ *       because the producer must never move the consumer's read index. A new block
+ *       is only opened when all of it is free, so its metadata is never rewritten
+ *       while the consumer still reads the previous lap. The recorder cursor is
+ *       pushed ahead instead (recorder gap, processing unaffected).
+ */
+fsp_err_t eeg_buffer_write(const eeg_rdata_sample_t *sample)
+{
+    if (!sample) return FSP_ERR_INVALID_POINTER;
+
+    uint32_t write_index = __atomic_load_n(&eeg_buffer.write_index, __ATOMIC_RELAXED);
+    uint32_t read_index = __atomic_load_n(&eeg_buffer.read_index, __ATOMIC_ACQUIRE);
+    uint32_t slot = write_index & EEG_BUFFER_INDEX_MASK;
+    uint32_t offset = slot & (EEG_QUALITY_BLOCK_SAMPLES - 1U);
+    eeg_block_meta_t *block = &eeg_buffer.blocks[slot / EEG_QUALITY_BLOCK_SAMPLES];
+
+    if ((offset == 0) && ((write_index - read_index) > (EEG_BUFFER_SIZE_SAMPLES - EEG_QUALITY_BLOCK_SAMPLES))) {
+        eeg_buffer.overflow_count++;
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+    if ((offset == 0) && eeg_recorder_active() &&
+        ((write_index - eeg_buffer.record_index) > (EEG_BUFFER_SIZE_SAMPLES - EEG_QUALITY_BLOCK_SAMPLES))) {
+        uint32_t oldest = write_index - (EEG_BUFFER_SIZE_SAMPLES - EEG_QUALITY_BLOCK_SAMPLES);
+        eeg_buffer.record_overruns += oldest - eeg_buffer.record_index;
+        eeg_buffer.record_index = oldest;
+    }
+
+    /* A clipped channel is railed, not EEG: excluded downstream like a held one */
+    uint32_t clipped = 0;
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        int32_t counts = sample->channel[ch];
+        eeg_buffer.channel[ch][slot] = counts;
+        if ((counts > block_clip_counts[ch]) || (counts < -block_clip_counts[ch])) clipped |= 1U << ch;
+    }
+    eeg_buffer.drl[slot] = sample->drl_feedback;
+    eeg_buffer.excluded[slot] = sample->held_mask | clipped;
+
+    if (offset == 0) {
+        block->base_timestamp_us = sample->timestamp_us;
+        block->base_sequence = sample->sequence_number;
+        block->timestamp_delta_us[0] = 0;
+        block->sequence_delta[0] = 0;
+        eeg_block_quality_accumulate(&block->quality, sample->channel, sample->held_mask, clipped, true);
+    } else {
+        uint32_t ts_step = sample->timestamp_us - ring_last_timestamp_us;
+        uint32_t seq_step = sample->sequence_number - ring_last_sequence;
+        block->timestamp_delta_us[offset] = (ts_step > 0xFFFFU) ? 0xFFFFU : (uint16_t) ts_step;
+        block->sequence_delta[offset] = (seq_step > 0xFFU) ? 0xFFU : (uint8_t) seq_step;
+        if (seq_step != 1U) block->quality.sequence_gaps++;
+        eeg_block_quality_accumulate(&block->quality, sample->channel, sample->held_mask, clipped, false);
+    }
+    ring_last_timestamp_us = sample->timestamp_us;
+    ring_last_sequence = sample->sequence_number;
+
+    /* Publish the sample only after its contents are visible */
+    __atomic_store_n(&eeg_buffer.write_index, write_index + 1U, __ATOMIC_RELEASE);
+
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Describe @p count samples from ring index @p from as at most two spans
+ */
+static uint32_t eeg_buffer_spans_at(uint32_t from, uint32_t count, eeg_sample_span_t spans[2])
+{
+    uint32_t start = from & EEG_BUFFER_INDEX_MASK;
+    uint32_t first = EEG_BUFFER_SIZE_SAMPLES - start;
+    if (first > count) first = count;
+
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        spans[0].channel[ch] = &eeg_buffer.channel[ch][start];
+        spans[1].channel[ch] = &eeg_buffer.channel[ch][0];
+    }
+    spans[0].drl = &eeg_buffer.drl[start];
+    spans[0].excluded = &eeg_buffer.excluded[start];
+    spans[0].count = first;
+    spans[0].first_index = from;
+    spans[1].drl = &eeg_buffer.drl[0];
+    spans[1].excluded = &eeg_buffer.excluded[0];
+    spans[1].count = count - first;
+    spans[1].first_index = from + first;
+
+    return count;
+}
+
+/**
+ * @brief Expose up to max_count unread samples as at most two contiguous spans
+ * @param spans Filled with [0] = run up to the ring end, [1] = wrapped run (may be empty)
+ * @param max_count Upper bound on samples returned
+ * @return Total samples across both spans; release them with eeg_buffer_commit_read()
+ */
+uint32_t eeg_buffer_peek_spans(eeg_sample_span_t spans[2], uint32_t max_count)
+{
+    if (!spans) return 0;
+
+    uint32_t read_index = __atomic_load_n(&eeg_buffer.read_index, __ATOMIC_RELAXED);
+    uint32_t write_index = __atomic_load_n(&eeg_buffer.write_index, __ATOMIC_ACQUIRE);
+
+    uint32_t available = write_index - read_index;
+    if (available > max_count) available = max_count;
+
+    return eeg_buffer_spans_at(read_index, available, spans);
+}
+
+/**
+ * @brief Release samples previously obtained from eeg_buffer_peek_spans()
+ * @param count Number of samples consumed (clamped to what is available)
+ */
+void eeg_buffer_commit_read(uint32_t count)
+{
+    uint32_t read_index = __atomic_load_n(&eeg_buffer.read_index, __ATOMIC_RELAXED);
+    uint32_t write_index = __atomic_load_n(&eeg_buffer.write_index, __ATOMIC_ACQUIRE);
+
+    if (count > (write_index - read_index)) count = write_index - read_index;
+
+    /* Hand the slots back to the producer only after we are done reading them */
+    __atomic_store_n(&eeg_buffer.read_index, read_index + count, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Whether a rate switch is still on its way to the consumer or the recorder
+ * @note The producer publishes the next switch only once both took the last one.
+ */
+bool eeg_buffer_rate_switch_busy(void)
+{
+    return __atomic_load_n(&rate_switch_pending, __ATOMIC_ACQUIRE) || record_rate_pending;
+}
+
+/**
+ * @brief Publish a rate switch at the next sample the producer writes (producer side)
+ * @param rate The rate the ADS1263s convert at from that sample on
+ */
+void eeg_buffer_publish_rate_switch(const eeg_rate_t *rate)
+{
+    rate_switch = *rate;
+    rate_switch_index = __atomic_load_n(&eeg_buffer.write_index, __ATOMIC_RELAXED);
+    __atomic_store_n(&rate_switch_pending, true, __ATOMIC_RELEASE);
+    record_rate_pending = eeg_recorder_active();
+}
+
+/**
+ * @brief Take a pending sample-rate switch once the consumer reaches it
+ * @param ring_index Free-running index of the sample about to be processed
+ * @param rate Receives the rate of that sample and everything after it
+ * @return true exactly once per switch, at the first sample at the new rate
+ */
+bool eeg_buffer_take_rate_switch(uint32_t ring_index, eeg_rate_t *rate)
+{
+    if (!__atomic_load_n(&rate_switch_pending, __ATOMIC_ACQUIRE)) return false;
+    if ((int32_t) (ring_index - rate_switch_index) < 0) return false;
+
+    if (rate) *rate = rate_switch;
+    __atomic_store_n(&rate_switch_pending, false, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Ring index of the published, not yet taken rate switch
+ * @return false when none is pending (consumer: ends a filter block before it)
+ */
+bool eeg_buffer_peek_rate_switch(uint32_t *ring_index)
+{
+    if (!__atomic_load_n(&rate_switch_pending, __ATOMIC_ACQUIRE)) return false;
+    if (ring_index) *ring_index = rate_switch_index;
+    return true;
+}
+
+/**
+ * @brief Samples dropped because the consumer fell a full ring behind
+ */
+uint32_t eeg_buffer_get_overflow_count(void)
+{
+    return eeg_buffer.overflow_count;
+}
+
+/**
+ * @brief Samples the ring overwrote before the recorder packed them
+ */
+uint32_t eeg_buffer_get_record_overruns(void)
+{
+    return eeg_buffer.record_overruns;
+}
+
+/**
+ * @brief Quality summary of the block holding a given ring sample
+ * @param ring_index Free-running index, e.g. eeg_sample_span_t.first_index + i
+ */
+const eeg_block_quality_t *eeg_buffer_get_block_quality(uint32_t ring_index)
+{
+    return &eeg_buffer.blocks[(ring_index & EEG_BUFFER_INDEX_MASK) / EEG_QUALITY_BLOCK_SAMPLES].quality;
+}
+
+/**
+ * @brief Reconstruct a sample timestamp from its block base and deltas
+ */
+uint32_t eeg_buffer_timestamp_at(uint32_t ring_index)
+{
+    uint32_t slot = ring_index & EEG_BUFFER_INDEX_MASK;
+    uint32_t offset = slot & (EEG_QUALITY_BLOCK_SAMPLES - 1U);
+    const eeg_block_meta_t *block = &eeg_buffer.blocks[slot / EEG_QUALITY_BLOCK_SAMPLES];
+    uint32_t timestamp = block->base_timestamp_us;
+
+    for (uint32_t i = 1; i <= offset; i++) {
+        timestamp += block->timestamp_delta_us[i];
+    }
+    return timestamp;
+}
+
+/**
+ * @brief Reconstruct a sample's acquisition sequence number from its block base and deltas
+ */
+uint32_t eeg_buffer_sequence_at(uint32_t ring_index)
+{
+    uint32_t slot = ring_index & EEG_BUFFER_INDEX_MASK;
+    uint32_t offset = slot & (EEG_QUALITY_BLOCK_SAMPLES - 1U);
+    const eeg_block_meta_t *block = &eeg_buffer.blocks[slot / EEG_QUALITY_BLOCK_SAMPLES];
+    uint32_t sequence = block->base_sequence;
+
+    for (uint32_t i = 1; i <= offset; i++) {
+        sequence += block->sequence_delta[i];
+    }
+    return sequence;
+}
+
+/**
+ * @brief Get Latest Real EEG Samples from Your Brain (copying reader)
+ */
+fsp_err_t eeg_get_samples(eeg_raw_sample_t *samples, uint32_t count, uint32_t *samples_read)
+{
+    eeg_sample_span_t spans[2];
+    uint32_t out = 0;
+
+    if (!samples || !samples_read) return FSP_ERR_INVALID_POINTER;
+
+    *samples_read = eeg_buffer_peek_spans(spans, count);
+
+    /* Re-interleave real brain samples, rebuilding timestamps from block deltas */
+    uint32_t timestamp = (*samples_read > 0) ? eeg_buffer_timestamp_at(spans[0].first_index) : 0;
+    for (uint32_t s = 0; s < 2; s++) {
+        for (uint32_t i = 0; i < spans[s].count; i++) {
+            uint32_t slot = (spans[s].first_index + i) & EEG_BUFFER_INDEX_MASK;
+            uint32_t offset = slot & (EEG_QUALITY_BLOCK_SAMPLES - 1U);
+            if (out > 0) {
+                timestamp = (offset == 0) ? eeg_buffer.blocks[slot / EEG_QUALITY_BLOCK_SAMPLES].base_timestamp_us
+                                          : timestamp + eeg_buffer.blocks[slot / EEG_QUALITY_BLOCK_SAMPLES].timestamp_delta_us[offset];
+            }
+            for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                samples[out].channel[ch] = spans[s].channel[ch][i];
+            }
+            samples[out].drl_feedback = spans[s].drl[i];
+            samples[out].timestamp_us = timestamp;
+            out++;
+        }
+    }
+
+    eeg_buffer_commit_read(*samples_read);
+
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Start or stop the raw recorder (any task; the producer applies it)
+ * @return FSP_SUCCESS once queued, FSP_ERR_NOT_OPEN without a recording medium
+ */
+fsp_err_t eeg_buffer_request_record(bool enable)
+{
+    if (enable && (NULL == eeg_recorder_storage_get())) return FSP_ERR_NOT_OPEN;
+
+    __atomic_store_n(&record_request, enable ? RECORD_REQUEST_START : RECORD_REQUEST_STOP, __ATOMIC_RELEASE);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Feed the recorder from its ring cursor (producer side, after each write)
+ * @param now_us Current time, mixed into a new session's id
+ * @return true when a block is ready for the writer (eeg_recorder_write_pending())
+ * @note Packing runs here so the cursor has a single owner; only whole-block
+ *       erase/program work is left to the writer task. Samples the recorder
+ *       cannot take yet (both block buffers queued) stay in the ring, and a
+ *       pending rate switch closes the recorder's block at the ring index it
+ *       took effect.
+ */
+bool eeg_buffer_record_service(uint32_t now_us)
+{
+    bool block_ready = false;
+    uint32_t request = __atomic_exchange_n(&record_request, RECORD_REQUEST_NONE, __ATOMIC_ACQ_REL);
+    uint32_t write_index = __atomic_load_n(&eeg_buffer.write_index, __ATOMIC_RELAXED);
+
+    if ((RECORD_REQUEST_START == request) && !eeg_recorder_active()) {
+        fsp_err_t err = eeg_recorder_start(++record_session_id ^ now_us, eeg_rate_get(), &eeg_ring_source);
+        if (FSP_SUCCESS == err) {
+            eeg_buffer.record_index = write_index;
+            record_rate_pending = false;
+            printf("SHRAVYA: 💾 Recording session %08lX to %s (%u-byte blocks, %s)\r\n",
+                   (unsigned long) eeg_recorder_get_stats()->session_id, eeg_recorder_storage_get()->name,
+                   (unsigned) EEG_RECORDER_BLOCK_BYTES, EEG_RECORDER_COMPRESSION ? "lossless coded" : "packed 24-bit");
+        } else {
+            printf("SHRAVYA: ⚠️ Recorder start failed: %u\r\n", (unsigned) err);
+        }
+    }
+    if (!eeg_recorder_active()) return false;
+
+    uint32_t limit = write_index;
+    if (record_rate_pending) {
+        if ((int32_t) (eeg_buffer.record_index - rate_switch_index) >= 0) {
+            block_ready |= eeg_recorder_set_rate(&rate_switch);
+            record_rate_pending = false;
+        } else {
+            limit = rate_switch_index;
+        }
+    }
+
+    uint32_t count = limit - eeg_buffer.record_index;
+    uint32_t space = eeg_recorder_space();
+    if (count > space) count = space;
+
+    eeg_sample_span_t spans[2];
+    eeg_buffer_spans_at(eeg_buffer.record_index, count, spans);
+    for (int s = 0; s < 2 && spans[s].count > 0U; s++) {
+        uint32_t taken = eeg_recorder_append(&spans[s], &block_ready);
+        eeg_buffer.record_index += taken;
+        if (taken < spans[s].count) break;
+    }
+
+    if (RECORD_REQUEST_STOP == request) {
+        block_ready |= eeg_recorder_stop();
+        printf("SHRAVYA: 💾 Recording stopped: %lu samples packed, %lu not recorded\r\n",
+               (unsigned long) eeg_recorder_get_stats()->samples_packed,
+               (unsigned long) (write_index - eeg_buffer.record_index + eeg_buffer.record_overruns));
+    }
+    return block_ready;
+}
@@ -0,0 +1,331 @@
+#include "hal_data.h"
+#include "eegCODEC.h"
+#include <string.h>
+
+/**
+ * @file eegCODEC.c
+ * @brief Lossless EEG frame codec - fixed polynomial prediction + partitioned Rice coding
+ *
+ * Per channel the encoder tries the five fixed predictors on the frame, keeps
+ * the one with the smallest absolute residual sum and picks each partition's
+ * Rice parameter from the exact bit count around the mean-derived estimate.
+ * A subframe that would not beat the 24-bit samples is stored verbatim, so a
+ * frame never exceeds EEG_CODEC_FRAME_BOUND(). Integer-only; EEG's strong
+ * low-frequency content makes order 2-3 the usual choice.
+ * @note Scratch buffers are static: one encoder/decoder caller at a time
+ *       (the recorder in the acquisition task, or a host tool).
+ */
+
+#define SUBFRAME_VERBATIM 7U
+#define RICE_ESCAPE 31U
+
+typedef struct {
+    uint8_t *out;
+    uint32_t capacity;
+    uint32_t pos;
+    uint64_t acc;
+    uint32_t bits;
+    bool overflow;
+} bit_writer_t;
+
+typedef struct {
+    const uint8_t *in;
+    uint32_t length;
+    uint32_t pos;
+    uint64_t acc;
+    uint32_t bits;
+    bool error;
+} bit_reader_t;
+
+/* History (oldest first) followed by the frame, per channel being coded */
+static int32_t codec_x[EEG_CODEC_MAX_ORDER + EEG_CODEC_MAX_SAMPLES];
+static uint32_t codec_u[EEG_CODEC_MAX_SAMPLES];
+
+static inline uint32_t bit_mask(uint32_t count)
+{
+    return (count >= 32U) ? 0xFFFFFFFFu : ((1U << count) - 1U);
+}
+
+static void put_bits(bit_writer_t *bw, uint32_t value, uint32_t count)
+{
+    if (0U == count) return;
+    bw->acc = (bw->acc << count) | (value & bit_mask(count));
+    bw->bits += count;
+    while (bw->bits >= 8U) {
+        bw->bits -= 8U;
+        if (bw->pos < bw->capacity) {
+            bw->out[bw->pos] = (uint8_t) (bw->acc >> bw->bits);
+        } else {
+            bw->overflow = true;
+        }
+        bw->pos++;
+    }
+}
+
+static void put_zeros(bit_writer_t *bw, uint32_t count)
+{
+    while (count > 24U) {
+        put_bits(bw, 0U, 24U);
+        count -= 24U;
+    }
+    put_bits(bw, 0U, count);
+}
+
+static void put_flush(bit_writer_t *bw)
+{
+    if (bw->bits > 0U) put_bits(bw, 0U, 8U - bw->bits);
+}
+
+static uint32_t get_bits(bit_reader_t *br, uint32_t count)
+{
+    if (0U == count) return 0U;
+    while (br->bits < count) {
+        if (br->pos >= br->length) {
+            br->error = true;
+            return 0U;
+        }
+        br->acc = (br->acc << 8) | br->in[br->pos++];
+        br->bits += 8U;
+    }
+    br->bits -= count;
+    return (uint32_t) (br->acc >> br->bits) & bit_mask(count);
+}
+
+static uint32_t get_unary(bit_reader_t *br)
+{
+    uint32_t zeros = 0;
+    while (!br->error && (0U == get_bits(br, 1U))) {
+        if (++zeros > (1U << EEG_CODEC_SAMPLE_BITS)) br->error = true;
+    }
+    return zeros;
+}
+
+static inline uint32_t zigzag(int32_t value)
+{
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value)
+{
+    return (int32_t) (value >> 1) ^ -(int32_t) (value & 1U);
+}
+
+static inline uint32_t bit_length(uint32_t value)
+{
+    uint32_t bits = 0;
+    while (value) {
+        bits++;
+        value >>= 1;
+    }
+    return bits;
+}
+
+/** Fixed polynomial prediction of x[i] from the @p order samples before it */
+static inline int32_t predict(const int32_t *x, uint32_t i, uint32_t order)
+{
+    switch (order) {
+        case 0: return 0;
+        case 1: return x[i - 1];
+        case 2: return 2 * x[i - 1] - x[i - 2];
+        case 3: return 3 * x[i - 1] - 3 * x[i - 2] + x[i - 3];
+        default: return 4 * x[i - 1] - 6 * x[i - 2] + 4 * x[i - 3] - x[i - 4];
+    }
+}
+
+/** Order usable for frame sample j with @p history samples before the frame */
+static inline uint32_t usable_order(uint32_t order, uint32_t history, uint32_t j)
+{
+    uint32_t available = history + j;
+    return (order < available) ? order : available;
+}
+
+/**
+ * @brief Bits to Rice-code one partition, and the parameter that achieves it
+ * @param param Receives k (0-30) or RICE_ESCAPE
+ */
+static uint32_t partition_bits(const uint32_t *u, uint32_t n, uint32_t *param)
+{
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += u[i];
+        if (u[i] > max) max = u[i];
+    }
+
+    /* 2^k near the mean, then the exact cost of k - 1 and k */
+    uint32_t k = 0;
+    while ((k < 30U) && (((uint64_t) n << k) < sum)) k++;
+
+    uint32_t best_bits = 5U + 5U + n * bit_length(max);
+    *param = RICE_ESCAPE;
+    for (uint32_t candidate = (k > 0U) ? k - 1U : 0U; candidate <= k; candidate++) {
+        uint64_t bits = 5U + (uint64_t) n * (candidate + 1U);
+        for (uint32_t i = 0; i < n; i++) bits += u[i] >> candidate;
+        if (bits < best_bits) {
+            best_bits = (uint32_t) bits;
+            *param = candidate;
+        }
+    }
+    return best_bits;
+}
+
+/**
+ * @brief Forget the prediction history (start of a recorder block or stream)
+ */
+void eeg_codec_reset(eeg_codec_state_t *state, uint8_t channel_count)
+{
+    memset(state, 0, sizeof(*state));
+    state->channel_count = channel_count;
+}
+
+/**
+ * @brief Encode one frame
+ * @param channel Per-channel sample pointers; sample j of channel c is channel[c][j * stride]
+ * @param samples 1..EEG_CODEC_MAX_SAMPLES
+ * @param capacity Bytes available at @p out
+ * @return Frame bytes written, or 0 if the frame does not fit (state unchanged)
+ */
+uint32_t eeg_codec_encode(eeg_codec_state_t *state, const int32_t *const channel[], uint32_t stride,
+                          uint32_t samples, uint8_t *out, uint32_t capacity)
+{
+    if (!state || !channel || !out || (0U == samples) || (samples > EEG_CODEC_MAX_SAMPLES)) return 0;
+
+    bit_writer_t bw = { out, capacity, 0, 0, 0, false };
+    const uint32_t history = state->history_count;
+    const uint32_t base = EEG_CODEC_MAX_ORDER;
+
+    put_bits(&bw, samples - 1U, 8U);
+
+    for (uint32_t c = 0; c < state->channel_count; c++) {
+        int32_t *x = codec_x;
+        for (uint32_t h = 0; h < EEG_CODEC_MAX_ORDER; h++) {
+            x[base - 1U - h] = state->history[c][h];
+        }
+        for (uint32_t j = 0; j < samples; j++) {
+            x[base + j] = channel[c][j * stride];
+        }
+
+        /* Fixed predictor with the smallest absolute residual sum */
+        uint64_t cost[EEG_CODEC_MAX_ORDER + 1] = {0};
+        for (uint32_t j = 0; j < samples; j++) {
+            for (uint32_t order = 0; order <= EEG_CODEC_MAX_ORDER; order++) {
+                int32_t r = x[base + j] - predict(x, base + j, usable_order(order, history, j));
+                cost[order] += (r < 0) ? (uint32_t) -r : (uint32_t) r;
+            }
+        }
+        uint32_t order = 0;
+        for (uint32_t o = 1; o <= EEG_CODEC_MAX_ORDER; o++) {
+            if (cost[o] < cost[order]) order = o;
+        }
+
+        for (uint32_t j = 0; j < samples; j++) {
+            codec_u[j] = zigzag(x[base + j] - predict(x, base + j, usable_order(order, history, j)));
+        }
+
+        uint32_t params[(EEG_CODEC_MAX_SAMPLES + EEG_CODEC_PARTITION - 1) / EEG_CODEC_PARTITION];
+        uint32_t coded_bits = 0;
+        uint32_t partitions = 0;
+        for (uint32_t start = 0; start < samples; start += EEG_CODEC_PARTITION) {
+            uint32_t n = (samples - start < EEG_CODEC_PARTITION) ? samples - start : EEG_CODEC_PARTITION;
+            coded_bits += partition_bits(&codec_u[start], n, &params[partitions++]);
+        }
+
+        if (coded_bits >= samples * EEG_CODEC_SAMPLE_BITS) {
+            put_bits(&bw, SUBFRAME_VERBATIM, 3U);
+            for (uint32_t j = 0; j < samples; j++) put_bits(&bw, (uint32_t) x[base + j], EEG_CODEC_SAMPLE_BITS);
+        } else {
+            put_bits(&bw, order, 3U);
+            for (uint32_t p = 0, start = 0; p < partitions; p++, start += EEG_CODEC_PARTITION) {
+                uint32_t n = (samples - start < EEG_CODEC_PARTITION) ? samples - start : EEG_CODEC_PARTITION;
+                const uint32_t *u = &codec_u[start];
+                put_bits(&bw, params[p], 5U);
+                if (RICE_ESCAPE == params[p]) {
+                    uint32_t width = 0;
+                    for (uint32_t i = 0; i < n; i++) {
+                        uint32_t bits = bit_length(u[i]);
+                        if (bits > width) width = bits;
+                    }
+                    put_bits(&bw, width, 5U);
+                    for (uint32_t i = 0; i < n; i++) put_bits(&bw, u[i], width);
+                } else {
+                    uint32_t k = params[p];
+                    for (uint32_t i = 0; i < n; i++) {
+                        put_zeros(&bw, u[i] >> k);
+                        put_bits(&bw, 1U, 1U);
+                        put_bits(&bw, u[i], k);
+                    }
+                }
+            }
+        }
+        if (bw.overflow) return 0;
+    }
+    put_flush(&bw);
+    if (bw.overflow) return 0;
+
+    /* Commit the history only once the whole frame fitted (oldest slot first, in place) */
+    for (uint32_t c = 0; c < state->channel_count; c++) {
+        for (uint32_t h = EEG_CODEC_MAX_ORDER; h-- > 0U;) {
+            state->history[c][h] = (h < samples) ? channel[c][(samples - 1U - h) * stride] : state->history[c][h - samples];
+        }
+    }
+    state->history_count = (history + samples > EEG_CODEC_MAX_ORDER) ? EEG_CODEC_MAX_ORDER : history + samples;
+    return bw.pos;
+}
+
+/**
+ * @brief Decode one frame
+ * @param out Receives samples sample-interleaved (out[j * channel_count + c])
+ * @param max_samples Capacity of @p out in samples
+ * @param samples Receives the frame's sample count
+ * @return Frame bytes consumed, or 0 on a malformed or truncated frame
+ */
+uint32_t eeg_codec_decode(eeg_codec_state_t *state, const uint8_t *in, uint32_t length,
+                          int32_t *out, uint32_t max_samples, uint32_t *samples)
+{
+    if (!state || !in || !out || !samples) return 0;
+
+    bit_reader_t br = { in, length, 0, 0, 0, false };
+    const uint32_t history = state->history_count;
+    const uint32_t base = EEG_CODEC_MAX_ORDER;
+    const uint32_t channels = state->channel_count;
+    uint32_t n = get_bits(&br, 8U) + 1U;
+    if (br.error || n > max_samples) return 0;
+
+    for (uint32_t c = 0; c < channels; c++) {
+        int32_t *x = codec_x;
+        for (uint32_t h = 0; h < EEG_CODEC_MAX_ORDER; h++) {
+            x[base - 1U - h] = state->history[c][h];
+        }
+
+        uint32_t type = get_bits(&br, 3U);
+        if (SUBFRAME_VERBATIM == type) {
+            for (uint32_t j = 0; j < n; j++) {
+                x[base + j] = (int32_t) (get_bits(&br, EEG_CODEC_SAMPLE_BITS) << (32U - EEG_CODEC_SAMPLE_BITS)) >>
+                              (32U - EEG_CODEC_SAMPLE_BITS);
+            }
+        } else if (type <= EEG_CODEC_MAX_ORDER) {
+            for (uint32_t start = 0; start < n && !br.error; start += EEG_CODEC_PARTITION) {
+                uint32_t count = (n - start < EEG_CODEC_PARTITION) ? n - start : EEG_CODEC_PARTITION;
+                uint32_t k = get_bits(&br, 5U);
+                uint32_t width = (RICE_ESCAPE == k) ? get_bits(&br, 5U) : 0U;
+                for (uint32_t j = start; j < start + count && !br.error; j++) {
+                    uint32_t u = (RICE_ESCAPE == k) ? get_bits(&br, width)
+                                                    : ((get_unary(&br) << k) | get_bits(&br, k));
+                    x[base + j] = unzigzag(u) + predict(x, base + j, usable_order(type, history, j));
+                }
+            }
+        } else {
+            return 0;
+        }
+        if (br.error) return 0;
+
+        for (uint32_t j = 0; j < n; j++) out[j * channels + c] = x[base + j];
+        for (uint32_t h = 0; h < EEG_CODEC_MAX_ORDER; h++) {
+            state->history[c][h] = x[base + n - 1U - h];
+        }
+    }
+    state->history_count = (history + n > EEG_CODEC_MAX_ORDER) ? EEG_CODEC_MAX_ORDER : history + n;
+
+    *samples = n;
+    return br.pos;
+}
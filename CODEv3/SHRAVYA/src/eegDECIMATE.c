@@ -0,0 +1,158 @@
+#include "hal_data.h"
+#include "eegDECIMATE.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file eegDECIMATE.c
+ * @brief Polyphase FIR decimation of the conditioned signal to the window rate
+ *
+ * The conditioning lowpass already limits the signal to 45 Hz; this FIR only
+ * has to keep what lies above the output rate's Nyquist from folding into
+ * the band. A Blackman-windowed sinc with EEG_DECIMATE_TAPS_PER_PHASE taps
+ * per phase has its transition over ~0.46x the output rate, centred on its
+ * Nyquist: flat to ~0.27x, and -74 dB from ~0.73x, where the aliases into
+ * the 0.27x passband start (54 Hz at a 200 Hz window rate).
+ */
+
+#define PI_F 3.14159265358979323846f
+#define DECIMATE_VECTOR_FLOATS 4
+
+#if (EEG_DECIMATE_TAPS_PER_PHASE % DECIMATE_VECTOR_FLOATS) != 0
+#error "EEG_DECIMATE_TAPS_PER_PHASE must be a multiple of 4 (one Helium vector)"
+#endif
+
+typedef float decimate_vector_t __attribute__((vector_size(DECIMATE_VECTOR_FLOATS * sizeof(float))));
+
+/**
+ * @brief Design the filter for decimation by @p factor and clear the delay lines
+ * @param factor 1 (pass-through) .. EEG_DECIMATE_MAX_FACTOR, clamped
+ * @note The first output comes after @p factor inputs; unity gain at DC.
+ */
+void eeg_decimator_init(eeg_decimator_t *decimator, uint32_t factor)
+{
+    if (factor < 1U) factor = 1U;
+    if (factor > EEG_DECIMATE_MAX_FACTOR) factor = EEG_DECIMATE_MAX_FACTOR;
+
+    memset(decimator, 0, sizeof(*decimator));
+    decimator->factor = factor;
+    decimator->phase = factor - 1U;
+    decimator->flag_phase = factor - 1U;
+    if (1U == factor) return;
+
+    const uint32_t taps = factor * EEG_DECIMATE_TAPS_PER_PHASE;
+    const float centre = 0.5f * (float) (taps - 1U);
+    float sum = 0.0f;
+    for (uint32_t k = 0; k < taps; k++) {
+        float t = ((float) k - centre) / (float) factor;
+        float sinc = (fabsf(t) < 1e-6f) ? 1.0f : sinf(PI_F * t) / (PI_F * t);
+        float w = 2.0f * PI_F * (float) k / (float) (taps - 1U);
+        float h = sinc * (0.42f - 0.5f * cosf(w) + 0.08f * cosf(2.0f * w));
+        decimator->coeff[k % factor][k / factor] = h;
+        sum += h;
+    }
+    for (uint32_t p = 0; p < factor; p++) {
+        for (uint32_t j = 0; j < EEG_DECIMATE_TAPS_PER_PHASE; j++) {
+            decimator->coeff[p][j] /= sum;
+        }
+    }
+}
+
+/**
+ * @brief Decimate in[ch][0..count) of the first @p channels channels
+ * @param out Receives out[ch][0..n), n = outputs this block; may be @p in
+ * @return n, 0..ceil(count / factor); the commutator carries across calls,
+ *         so the outputs do not depend on how the input is split into blocks
+ * @note Input phase p = M-1 .. 0 of an output period goes to delay line p;
+ *       after phase 0 the output is the sum over phases of line p against
+ *       its taps, each a contiguous EEG_DECIMATE_TAPS_PER_PHASE dot product
+ *       accumulated 4 taps at a time (one Helium multiply-add on the M85).
+ */
+uint32_t eeg_decimate(eeg_decimator_t *decimator, const float (*in)[EEG_FILTER_BLOCK_SAMPLES],
+                      float (*out)[EEG_FILTER_BLOCK_SAMPLES], uint32_t channels, uint32_t count)
+{
+    const uint32_t factor = decimator->factor;
+    uint32_t produced = 0;
+
+    if (1U == factor) {
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            if (out[ch] != in[ch]) memcpy(out[ch], in[ch], count * sizeof(float));
+        }
+        return count;
+    }
+
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        float (*lines)[2 * EEG_DECIMATE_TAPS_PER_PHASE] = decimator->lines[ch];
+        uint32_t phase = decimator->phase;
+        uint32_t position = decimator->position;
+        uint32_t n = 0;
+
+        for (uint32_t i = 0; i < count; i++) {
+            float x = in[ch][i];
+            lines[phase][position] = x;
+            lines[phase][position + EEG_DECIMATE_TAPS_PER_PHASE] = x;
+            if (phase-- > 0U) continue;
+
+            decimate_vector_t acc = { 0 };
+            for (uint32_t p = 0; p < factor; p++) {
+                const float *line = &lines[p][position];
+                const float *taps = decimator->coeff[p];
+                for (uint32_t j = 0; j < EEG_DECIMATE_TAPS_PER_PHASE; j += DECIMATE_VECTOR_FLOATS) {
+                    decimate_vector_t h, u;
+                    memcpy(&h, &taps[j], sizeof(h));
+                    memcpy(&u, &line[j], sizeof(u));   // Any alignment: the newest entry moves every output
+                    acc += h * u;
+                }
+            }
+            out[ch][n++] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            phase = factor - 1U;
+            position = (0U == position) ? EEG_DECIMATE_TAPS_PER_PHASE - 1U : position - 1U;
+        }
+
+        /* Every channel sees the same inputs, so leaves the commutator in the same place */
+        if (ch + 1U == channels) {
+            decimator->phase = phase;
+            decimator->position = position;
+            produced = n;
+        }
+    }
+    return produced;
+}
+
+/**
+ * @brief Carry per-sample channel flags (bit n = channel n) through the decimator
+ * @param in Flags of the @p count inputs about to go through eeg_decimate()
+ * @param out Receives the flags of each output; may be @p in
+ * @return Outputs, the same as eeg_decimate() returns for the same @p count
+ * @note A channel is flagged on an output when any input it has seen within
+ *       the FIR span was flagged: the output period the input fell in, then
+ *       the EEG_DECIMATE_TAPS_PER_PHASE - 1 outputs that still carry it.
+ */
+uint32_t eeg_decimate_flags(eeg_decimator_t *decimator, const uint32_t *in, uint32_t *out, uint32_t count)
+{
+    const uint32_t factor = decimator->factor;
+    uint32_t n = 0;
+
+    if (1U == factor) {
+        if (out != in) memcpy(out, in, count * sizeof(uint32_t));
+        return count;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        decimator->flags_pending |= in[i];
+        if (decimator->flag_phase-- > 0U) continue;
+
+        uint32_t flags = 0;
+        for (uint32_t ch = 0; ch < EEG_CHANNELS; ch++) {
+            if (decimator->flags_pending & (1U << ch)) decimator->flag_hold[ch] = EEG_DECIMATE_TAPS_PER_PHASE;
+            if (decimator->flag_hold[ch] > 0U) {
+                decimator->flag_hold[ch]--;
+                flags |= 1U << ch;
+            }
+        }
+        out[n++] = flags;
+        decimator->flags_pending = 0;
+        decimator->flag_phase = factor - 1U;
+    }
+    return n;
+}
@@ -0,0 +1,271 @@
+/**
+ * @file eegFILTERTABLES.c
+ * @brief Conditioning cascades per sample rate and mains frequency
+ * @note GENERATED by host/shravyaFILTERS.c (make -C host tables) - do not edit.
+ *       Highpass: Butterworth order 4, -3 dB at 0.5 Hz.
+ *       Lowpass: elliptic order 4, edge 45 Hz (at most 90% of Nyquist), 0.1 dB ripple, 40 dB stopband.
+ *       Mains: Butterworth band-stop order 4, 2.0 Hz wide (-3 dB), at the mains alias (last sections).
+ */
+#include "hal_data.h"
+#include "eegFILTERTABLES.h"
+
+const eeg_filter_table_t eeg_filter_tables[] = {
+    { 20, 50, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 9.0 Hz: -0.10 dB */
+        { 8.683451917e-01f, -1.736690383e+00f, 8.683451917e-01f, -1.725933395e+00f, 7.474473719e-01f },
+        { 9.377083729e-01f, -1.875416746e+00f, 9.377083729e-01f, -1.863800492e+00f, 8.870329997e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 20, 60, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 9.0 Hz: -0.10 dB */
+        { 8.683451917e-01f, -1.736690383e+00f, 8.683451917e-01f, -1.725933395e+00f, 7.474473719e-01f },
+        { 9.377083729e-01f, -1.875416746e+00f, 9.377083729e-01f, -1.863800492e+00f, 8.870329997e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 25, 50, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 11.2 Hz: -0.10 dB */
+        { 8.926902400e-01f, -1.785380480e+00f, 8.926902400e-01f, -1.778313488e+00f, 7.924474718e-01f },
+        { 9.504700035e-01f, -1.900940007e+00f, 9.504700035e-01f, -1.893415601e+00f, 9.084644129e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 25, 60, 6, 2, {    /* mains at 10.0 Hz: -30.4 dB; lowpass edge 11.2 Hz: -0.97 dB */
+        { 8.926902400e-01f, -1.785380480e+00f, 8.926902400e-01f, -1.778313488e+00f, 7.924474718e-01f },
+        { 9.504700035e-01f, -1.900940007e+00f, 9.504700035e-01f, -1.893415601e+00f, 9.084644129e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 7.566263101e-01f, 1.263956608e+00f, 7.566263101e-01f, 1.142132148e+00f, 6.350770800e-01f },
+        { 9.248611993e-01f, 1.544995737e+00f, 9.248611993e-01f, 1.620304679e+00f, 7.744134574e-01f },
+    } },
+    { 33, 50, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 14.8 Hz: -0.10 dB */
+        { 9.171881892e-01f, -1.834376378e+00f, 9.171881892e-01f, -1.830213855e+00f, 8.385389017e-01f },
+        { 9.627158505e-01f, -1.925431701e+00f, 9.627158505e-01f, -1.921062557e+00f, 9.298008448e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 33, 60, 6, 2, {    /* mains at 6.0 Hz: -54.5 dB; lowpass edge 14.8 Hz: -0.10 dB */
+        { 9.171881892e-01f, -1.834376378e+00f, 9.171881892e-01f, -1.830213855e+00f, 8.385389017e-01f },
+        { 9.627158505e-01f, -1.925431701e+00f, 9.627158505e-01f, -1.921062557e+00f, 9.298008448e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.075525142e+00f, -9.100238991e-01f, 1.075525142e+00f, -5.099014840e-01f, 7.509278690e-01f },
+        { 7.099095698e-01f, -6.006690588e-01f, 7.099095698e-01f, -9.582558075e-01f, 7.774058884e-01f },
+    } },
+    { 50, 50, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 22.5 Hz: -0.10 dB */
+        { 9.442373297e-01f, -1.888474659e+00f, 9.442373297e-01f, -1.886609583e+00f, 8.903397363e-01f },
+        { 9.755714633e-01f, -1.951142927e+00f, 9.755714633e-01f, -1.949215958e+00f, 9.530698953e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 50, 60, 6, 2, {    /* mains at 10.0 Hz: -67.7 dB; lowpass edge 22.5 Hz: -0.10 dB */
+        { 9.442373297e-01f, -1.888474659e+00f, 9.442373297e-01f, -1.886609583e+00f, 8.903397363e-01f },
+        { 9.755714633e-01f, -1.951142927e+00f, 9.755714633e-01f, -1.949215958e+00f, 9.530698953e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.032797110e+00f, -6.433769369e-01f, 1.032797110e+00f, -4.106112652e-01f, 8.328285487e-01f },
+        { 8.105069062e-01f, -5.049021202e-01f, 8.105069062e-01f, -7.254742287e-01f, 8.415859210e-01f },
+    } },
+    { 80, 50, 6, 2, {    /* mains at 30.0 Hz: -56.2 dB; lowpass edge 36.0 Hz: -0.10 dB */
+        { 9.646262319e-01f, -1.929252464e+00f, 9.646262319e-01f, -1.928508485e+00f, 9.299964424e-01f },
+        { 9.848185248e-01f, -1.969637050e+00f, 9.848185248e-01f, -1.968877497e+00f, 9.703966018e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 9.216923152e-01f, 1.307500360e+00f, 9.216923152e-01f, 1.261568887e+00f, 8.893161029e-01f },
+        { 9.708864785e-01f, 1.377286540e+00f, 9.708864785e-01f, 1.418589300e+00f, 9.004701974e-01f },
+    } },
+    { 80, 60, 6, 2, {    /* mains at 20.0 Hz: -608.0 dB; lowpass edge 36.0 Hz: -0.10 dB */
+        { 9.646262319e-01f, -1.929252464e+00f, 9.646262319e-01f, -1.928508485e+00f, 9.299964424e-01f },
+        { 9.848185248e-01f, -1.969637050e+00f, 9.848185248e-01f, -1.968877497e+00f, 9.703966018e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 8.947127366e-01f, -1.986661361e-16f, 8.947127366e-01f, -1.054502985e-01f, 8.948757716e-01f },
+        { 1.000163035e+00f, -2.220808060e-16f, 1.000163035e+00f, 1.054502985e-01f, 8.948757716e-01f },
+    } },
+    { 100, 50, 6, 2, {    /* mains aliases too close to DC/Nyquist: pass-through; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.715588773e-01f, -1.943117755e+00f, 9.715588773e-01f, -1.942638231e+00f, 9.435972785e-01f },
+        { 9.878786068e-01f, -1.975757214e+00f, 9.878786068e-01f, -1.975269635e+00f, 9.762447924e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { 100, 60, 6, 2, {    /* mains at 40.0 Hz: -54.6 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.715588773e-01f, -1.943117755e+00f, 9.715588773e-01f, -1.942638231e+00f, 9.435972785e-01f },
+        { 9.878786068e-01f, -1.975757214e+00f, 9.878786068e-01f, -1.975269635e+00f, 9.762447924e-01f },
+        { 7.625846502e-01f, 1.507350516e+00f, 7.625846502e-01f, 1.465334981e+00f, 5.671848358e-01f },
+        { 9.235785026e-01f, 1.843010968e+00f, 9.235785026e-01f, 1.830181283e+00f, 9.027168216e-01f },
+        { 9.403466759e-01f, 1.524521177e+00f, 9.403466759e-01f, 1.495237904e+00f, 9.099766249e-01f },
+        { 9.730125788e-01f, 1.577480221e+00f, 9.730125788e-01f, 1.603501910e+00f, 9.200034686e-01f },
+    } },
+    { 133, 50, 6, 2, {    /* mains at 50.0 Hz: -75.4 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.785085551e-01f, -1.957017110e+00f, 9.785085551e-01f, -1.956744105e+00f, 9.572901158e-01f },
+        { 9.909042073e-01f, -1.981808415e+00f, 9.909042073e-01f, -1.981531951e+00f, 9.820848787e-01f },
+        { 4.436204794e-01f, 7.672087586e-01f, 4.436204794e-01f, 4.841806377e-01f, 1.702690798e-01f },
+        { 7.042969586e-01f, 1.370047037e+00f, 7.042969586e-01f, 1.068216329e+00f, 7.425997708e-01f },
+        { 9.529103631e-01f, 1.357067315e+00f, 9.529103631e-01f, 1.329633159e+00f, 9.332548816e-01f },
+        { 9.815933141e-01f, 1.397915538e+00f, 9.815933141e-01f, 1.423606686e+00f, 9.374954803e-01f },
+    } },
+    { 133, 60, 6, 2, {    /* mains at 60.0 Hz: -90.7 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.785085551e-01f, -1.957017110e+00f, 9.785085551e-01f, -1.956744105e+00f, 9.572901158e-01f },
+        { 9.909042073e-01f, -1.981808415e+00f, 9.909042073e-01f, -1.981531951e+00f, 9.820848787e-01f },
+        { 4.436204794e-01f, 7.672087586e-01f, 4.436204794e-01f, 4.841806377e-01f, 1.702690798e-01f },
+        { 7.042969586e-01f, 1.370047037e+00f, 7.042969586e-01f, 1.068216329e+00f, 7.425997708e-01f },
+        { 9.588417703e-01f, 1.830020664e+00f, 9.588417703e-01f, 1.818982105e+00f, 9.287221004e-01f },
+        { 9.755211655e-01f, 1.861854528e+00f, 9.755211655e-01f, 1.870825777e+00f, 9.420710813e-01f },
+    } },
+    { 200, 50, 6, 2, {    /* mains at 50.0 Hz: -595.0 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.856351059e-01f, -1.971270212e+00f, 9.856351059e-01f, -1.971148609e+00f, 9.713918146e-01f },
+        { 9.939636701e-01f, -1.987927340e+00f, 9.939636701e-01f, -1.987804710e+00f, 9.880499706e-01f },
+        { 2.671289220e-01f, 2.745446179e-01f, 2.671289220e-01f, -3.378422766e-01f, 1.466447385e-01f },
+        { 4.287541880e-01f, 7.582987679e-01f, 4.287541880e-01f, -5.058481986e-02f, 6.851021287e-01f },
+        { 9.565329599e-01f, -2.123929832e-16f, 9.565329599e-01f, -4.347777219e-02f, 9.565436921e-01f },
+        { 1.000010732e+00f, -2.220469879e-16f, 1.000010732e+00f, 4.347777219e-02f, 9.565436921e-01f },
+    } },
+    { 200, 60, 6, 2, {    /* mains at 60.0 Hz: -113.8 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.856351059e-01f, -1.971270212e+00f, 9.856351059e-01f, -1.971148609e+00f, 9.713918146e-01f },
+        { 9.939636701e-01f, -1.987927340e+00f, 9.939636701e-01f, -1.987804710e+00f, 9.880499706e-01f },
+        { 2.671289220e-01f, 2.745446179e-01f, 2.671289220e-01f, -3.378422766e-01f, 1.466447385e-01f },
+        { 4.287541880e-01f, 7.582987679e-01f, 4.287541880e-01f, -5.058481986e-02f, 6.851021287e-01f },
+        { 9.622143360e-01f, 5.949747482e-01f, 9.622143360e-01f, 5.631667954e-01f, 9.562366249e-01f },
+        { 9.941061879e-01f, 6.146947273e-01f, 9.941061879e-01f, 6.460562453e-01f, 9.568508578e-01f },
+    } },
+    { 240, 50, 6, 2, {    /* mains at 50.0 Hz: -100.5 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.880089645e-01f, -1.976017929e+00f, 9.880089645e-01f, -1.975933280e+00f, 9.761025777e-01f },
+        { 9.949731727e-01f, -1.989946345e+00f, 9.949731727e-01f, -1.989861100e+00f, 9.900315907e-01f },
+        { 2.276926451e-01f, 1.419809981e-01f, 2.276926451e-01f, -5.970059382e-01f, 1.943722265e-01f },
+        { 3.370178391e-01f, 5.511300740e-01f, 3.370178391e-01f, -4.554497222e-01f, 6.948022252e-01f },
+        { 1.005548531e+00f, -5.206886480e-01f, 1.005548531e+00f, -4.730674732e-01f, 9.634758865e-01f },
+        { 9.583354105e-01f, -4.962409611e-01f, 9.583354105e-01f, -5.434002671e-01f, 9.638301271e-01f },
+    } },
+    { 240, 60, 6, 2, {    /* mains at 60.0 Hz: -575.6 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.880089645e-01f, -1.976017929e+00f, 9.880089645e-01f, -1.975933280e+00f, 9.761025777e-01f },
+        { 9.949731727e-01f, -1.989946345e+00f, 9.949731727e-01f, -1.989861100e+00f, 9.900315907e-01f },
+        { 2.276926451e-01f, 1.419809981e-01f, 2.276926451e-01f, -5.970059382e-01f, 1.943722265e-01f },
+        { 3.370178391e-01f, 5.511300740e-01f, 3.370178391e-01f, -4.554497222e-01f, 6.948022252e-01f },
+        { 9.636467586e-01f, -0.000000000e+00f, 9.636467586e-01f, -3.635947324e-02f, 9.636529905e-01f },
+        { 1.000006232e+00f, -0.000000000e+00f, 1.000006232e+00f, 3.635947324e-02f, 9.636529905e-01f },
+    } },
+    { 300, 50, 6, 2, {    /* mains at 50.0 Hz: -90.6 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.903908827e-01f, -1.980781765e+00f, 9.903908827e-01f, -1.980727460e+00f, 9.808360706e-01f },
+        { 9.959813108e-01f, -1.991962622e+00f, 9.959813108e-01f, -1.991908010e+00f, 9.920172334e-01f },
+        { 1.962244277e-01f, 2.017074711e-02f, 1.962244277e-01f, -8.576368185e-01f, 2.702564211e-01f },
+        { 2.503705144e-01f, 3.533895438e-01f, 2.503705144e-01f, -8.569576778e-01f, 7.209786164e-01f },
+        { 1.010783623e+00f, -1.011005353e+00f, 1.010783623e+00f, -9.600072643e-01f, 9.705691571e-01f },
+        { 9.604578242e-01f, -9.606685147e-01f, 9.604578242e-01f, -1.010814037e+00f, 9.710611707e-01f },
+    } },
+    { 300, 60, 6, 2, {    /* mains at 60.0 Hz: -112.5 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.903908827e-01f, -1.980781765e+00f, 9.903908827e-01f, -1.980727460e+00f, 9.808360706e-01f },
+        { 9.959813108e-01f, -1.991962622e+00f, 9.959813108e-01f, -1.991908010e+00f, 9.920172334e-01f },
+        { 1.962244277e-01f, 2.017074711e-02f, 1.962244277e-01f, -8.576368185e-01f, 2.702564211e-01f },
+        { 2.503705144e-01f, 3.533895438e-01f, 2.503705144e-01f, -8.569576778e-01f, 7.209786164e-01f },
+        { 1.005524788e+00f, -6.215848192e-01f, 1.005524788e+00f, -5.812119461e-01f, 9.706767025e-01f },
+        { 9.654809619e-01f, -5.968309448e-01f, 9.654809619e-01f, -6.368226039e-01f, 9.709535828e-01f },
+    } },
+    { 400, 50, 6, 2, {    /* mains at 50.0 Hz: -85.8 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.927809027e-01f, -1.985561805e+00f, 9.927809027e-01f, -1.985531185e+00f, 9.855924256e-01f },
+        { 9.969880736e-01f, -1.993976147e+00f, 9.969880736e-01f, -1.993945397e+00f, 9.940068971e-01f },
+        { 1.730669701e-01f, -9.171921328e-02f, 1.730669701e-01f, -1.124148470e+00f, 3.785631973e-01f },
+        { 1.732554752e-01f, 1.749196228e-01f, 1.732554752e-01f, -1.237273757e+00f, 7.647422122e-01f },
+        { 1.015716763e+00f, -1.436617654e+00f, 1.015716763e+00f, -1.382973248e+00f, 9.777891202e-01f },
+        { 9.628968575e-01f, -1.361909811e+00f, 9.628968575e-01f, -1.414388053e+00f, 9.782719574e-01f },
+    } },
+    { 400, 60, 6, 2, {    /* mains at 60.0 Hz: -101.5 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.927809027e-01f, -1.985561805e+00f, 9.927809027e-01f, -1.985531185e+00f, 9.855924256e-01f },
+        { 9.969880736e-01f, -1.993976147e+00f, 9.969880736e-01f, -1.993945397e+00f, 9.940068971e-01f },
+        { 1.730669701e-01f, -9.171921328e-02f, 1.730669701e-01f, -1.124148470e+00f, 3.785631973e-01f },
+        { 1.732554752e-01f, 1.749196228e-01f, 1.732554752e-01f, -1.237273757e+00f, 7.647422122e-01f },
+        { 1.010664947e+00f, -1.188254493e+00f, 1.010664947e+00f, -1.144779734e+00f, 9.778551340e-01f },
+        { 9.677099047e-01f, -1.137751583e+00f, 9.677099047e-01f, -1.180537689e+00f, 9.782059154e-01f },
+    } },
+    { 480, 50, 6, 2, {    /* mains at 50.0 Hz: -84.3 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.939789642e-01f, -1.987957928e+00f, 9.939789642e-01f, -1.987936639e+00f, 9.879792180e-01f },
+        { 9.974909358e-01f, -1.994981872e+00f, 9.974909358e-01f, -1.994960507e+00f, 9.950032364e-01f },
+        { 1.649761078e-01f, -1.438270340e-01f, 1.649761078e-01f, -1.260967689e+00f, 4.470928704e-01f },
+        { 1.399360558e-01f, 9.662272391e-02f, 1.399360558e-01f, -1.412560517e+00f, 7.934149577e-01f },
+        { 1.018070289e+00f, -1.615517335e+00f, 1.018070289e+00f, -1.560815779e+00f, 9.814390232e-01f },
+        { 9.642342759e-01f, -1.530088054e+00f, 9.642342759e-01f, -1.583497093e+00f, 9.818775914e-01f },
+    } },
+    { 480, 60, 6, 2, {    /* mains at 60.0 Hz: -98.4 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.939789642e-01f, -1.987957928e+00f, 9.939789642e-01f, -1.987936639e+00f, 9.879792180e-01f },
+        { 9.974909358e-01f, -1.994981872e+00f, 9.974909358e-01f, -1.994960507e+00f, 9.950032364e-01f },
+        { 1.649761078e-01f, -1.438270340e-01f, 1.649761078e-01f, -1.260967689e+00f, 4.470928704e-01f },
+        { 1.399360558e-01f, 9.662272391e-02f, 1.399360558e-01f, -1.412560517e+00f, 7.934149577e-01f },
+        { 1.013095053e+00f, -1.432855520e+00f, 1.013095053e+00f, -1.388155459e+00f, 9.814900447e-01f },
+        { 9.689695606e-01f, -1.370447304e+00f, 9.689695606e-01f, -1.414334732e+00f, 9.818265498e-01f },
+    } },
+    { 600, 50, 6, 2, {    /* mains at 50.0 Hz: -83.2 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.951790671e-01f, -1.990358134e+00f, 9.951790671e-01f, -1.990344492e+00f, 9.903717759e-01f },
+        { 9.979934501e-01f, -1.995986900e+00f, 9.979934501e-01f, -1.995973220e+00f, 9.960005805e-01f },
+        { 1.595649675e-01f, -1.930885146e-01f, 1.595649675e-01f, -1.400866303e+00f, 5.269077235e-01f },
+        { 1.111150467e-01f, 2.787974792e-02f, 1.111150467e-01f, -1.573591208e+00f, 8.265971846e-01f },
+        { 1.020348314e+00f, -1.767392028e+00f, 1.020348314e+00f, -1.711807728e+00f, 9.851123278e-01f },
+        { 9.656501547e-01f, -1.672646843e+00f, 9.656501547e-01f, -1.726833267e+00f, 9.854867341e-01f },
+    } },
+    { 600, 60, 6, 2, {    /* mains at 60.0 Hz: -96.2 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.951790671e-01f, -1.990358134e+00f, 9.951790671e-01f, -1.990344492e+00f, 9.903717759e-01f },
+        { 9.979934501e-01f, -1.995986900e+00f, 9.979934501e-01f, -1.995973220e+00f, 9.960005805e-01f },
+        { 1.595649675e-01f, -1.930885146e-01f, 1.595649675e-01f, -1.400866303e+00f, 5.269077235e-01f },
+        { 1.111150467e-01f, 2.787974792e-02f, 1.111150467e-01f, -1.573591208e+00f, 8.265971846e-01f },
+        { 1.015432561e+00f, -1.643094490e+00f, 1.015432561e+00f, -1.597380138e+00f, 9.851507716e-01f },
+        { 9.703249085e-01f, -1.570104772e+00f, 9.703249085e-01f, -1.614903232e+00f, 9.854482772e-01f },
+    } },
+    { 800, 50, 6, 2, {    /* mains at 50.0 Hz: -82.3 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.963812167e-01f, -1.992762433e+00f, 9.963812167e-01f, -1.992754751e+00f, 9.927701162e-01f },
+        { 9.984956150e-01f, -1.996991230e+00f, 9.984956150e-01f, -1.996983531e+00f, 9.969989291e-01f },
+        { 1.572294266e-01f, -2.390949864e-01f, 1.572294266e-01f, -1.544338936e+00f, 6.197028024e-01f },
+        { 8.760382799e-02f, -2.947208707e-02f, 8.760382799e-02f, -1.716739822e+00f, 8.641629293e-01f },
+        { 1.022550516e+00f, -1.889485262e+00f, 1.022550516e+00f, -1.833191177e+00f, 9.888069480e-01f },
+        { 9.671446374e-01f, -1.787105389e+00f, 9.671446374e-01f, -1.841917689e+00f, 9.891015739e-01f },
+    } },
+    { 800, 60, 6, 2, {    /* mains at 60.0 Hz: -94.6 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.963812167e-01f, -1.992762433e+00f, 9.963812167e-01f, -1.992754751e+00f, 9.927701162e-01f },
+        { 9.984956150e-01f, -1.996991230e+00f, 9.984956150e-01f, -1.996983531e+00f, 9.969989291e-01f },
+        { 1.572294266e-01f, -2.390949864e-01f, 1.572294266e-01f, -1.544338936e+00f, 6.197028024e-01f },
+        { 8.760382799e-02f, -2.947208707e-02f, 8.760382799e-02f, -1.716739822e+00f, 8.641629293e-01f },
+        { 1.017677647e+00f, -1.813570781e+00f, 1.017677647e+00f, -1.767049995e+00f, 9.888345079e-01f },
+        { 9.717755427e-01f, -1.731770109e+00f, 9.717755427e-01f, -1.777293030e+00f, 9.890740065e-01f },
+    } },
+    { 1200, 50, 6, 2, {    /* mains at 50.0 Hz: -81.8 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.975854185e-01f, -1.995170837e+00f, 9.975854185e-01f, -1.995167418e+00f, 9.951742557e-01f },
+        { 9.989974292e-01f, -1.997994858e+00f, 9.989974292e-01f, -1.997991435e+00f, 9.979982820e-01f },
+        { 1.585028734e-01f, -2.812278224e-01f, 1.585028734e-01f, -1.691823668e+00f, 7.276015920e-01f },
+        { 7.023466733e-02f, -7.353436917e-02f, 7.023466733e-02f, -1.838158403e+00f, 9.058684386e-01f },
+        { 1.024676373e+00f, -1.979549880e+00f, 1.024676373e+00f, -1.922718098e+00f, 9.925209642e-01f },
+        { 9.687180936e-01f, -1.871445303e+00f, 9.687180936e-01f, -1.926733249e+00f, 9.927241324e-01f },
+    } },
+    { 1200, 60, 6, 2, {    /* mains at 60.0 Hz: -93.6 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.975854185e-01f, -1.995170837e+00f, 9.975854185e-01f, -1.995167418e+00f, 9.951742557e-01f },
+        { 9.989974292e-01f, -1.997994858e+00f, 9.989974292e-01f, -1.997991435e+00f, 9.979982820e-01f },
+        { 1.585028734e-01f, -2.812278224e-01f, 1.585028734e-01f, -1.691823668e+00f, 7.276015920e-01f },
+        { 7.023466733e-02f, -7.353436917e-02f, 7.023466733e-02f, -1.838158403e+00f, 9.058684386e-01f },
+        { 1.019830136e+00f, -1.939858784e+00f, 1.019830136e+00f, -1.892737291e+00f, 9.925387792e-01f },
+        { 9.733214461e-01f, -1.851392786e+00f, 9.733214461e-01f, -1.897456208e+00f, 9.927063142e-01f },
+    } },
+    { 2400, 50, 6, 2, {    /* mains at 50.0 Hz: -81.5 dB; lowpass edge 45.0 Hz: -0.11 dB */
+        { 9.987916778e-01f, -1.997583356e+00f, 9.987916778e-01f, -1.997582500e+00f, 9.975842113e-01f },
+        { 9.994988914e-01f, -1.998997783e+00f, 9.994988914e-01f, -1.998996926e+00f, 9.989986390e-01f },
+        { 1.640960924e-01f, -3.185889914e-01f, 1.640960924e-01f, -1.843656937e+00f, 8.532601303e-01f },
+        { 5.982950253e-02f, -1.024148054e-01f, 5.982950253e-02f, -1.933885344e+00f, 9.513292219e-01f },
+        { 1.026725140e+00f, -2.035889705e+00f, 1.026725140e+00f, -1.978691991e+00f, 9.962525656e-01f },
+        { 9.703711383e-01f, -1.924145551e+00f, 9.703711383e-01f, -1.979759598e+00f, 9.963563231e-01f },
+    } },
+    { 2400, 60, 6, 2, {    /* mains at 60.0 Hz: -93.0 dB; lowpass edge 45.0 Hz: -0.10 dB */
+        { 9.987916778e-01f, -1.997583356e+00f, 9.987916778e-01f, -1.997582500e+00f, 9.975842113e-01f },
+        { 9.994988914e-01f, -1.998997783e+00f, 9.994988914e-01f, -1.998996926e+00f, 9.989986390e-01f },
+        { 1.640960924e-01f, -3.185889914e-01f, 1.640960924e-01f, -1.843656937e+00f, 8.532601303e-01f },
+        { 5.982950253e-02f, -1.024148054e-01f, 5.982950253e-02f, -1.933885344e+00f, 9.513292219e-01f },
+        { 1.021889468e+00f, -2.018623544e+00f, 1.021889468e+00f, -1.971105931e+00f, 9.962613238e-01f },
+        { 9.749630211e-01f, -1.925925817e+00f, 9.749630211e-01f, -1.972347339e+00f, 9.963475640e-01f },
+    } },
+};
+
+const uint32_t eeg_filter_table_count = sizeof(eeg_filter_tables) / sizeof(eeg_filter_tables[0]);
@@ -0,0 +1,231 @@
+#include "hal_data.h"
+#include "eegMAINS.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file eegMAINS.c
+ * @brief Mains frequency detection and adaptive mains cancellation
+ *
+ * Only one mains frequency exists at a site, so the chain starts with the
+ * EEG_MAINS_HZ band-stop, listens for EEG_MAINS_DETECT_S seconds, and then
+ * hands mains over to the canceller and drops the band-stop sections.
+ *
+ * The canceller is the LMS sinusoidal-reference scheme: with unit-amplitude
+ * cos/sin references at w0 and weight update w += mu e ref, it behaves as a
+ * notch at w0 whose -3 dB width is mu rad/sample, but it also follows slow
+ * drift in the interference's amplitude and phase, and handles harmonics -
+ * including ones above Nyquist that alias into the EEG band at low rates -
+ * for two weights each. Adaptation time is about 1 / (pi * width) seconds.
+ */
+
+#define MAINS_EDGE_MIN_HZ        1.0f   // Tones this close to DC/Nyquist are left to the highpass/lowpass
+#define MAINS_NEIGHBOUR_HZ       2.0f   // Detector's reference bins either side of a candidate
+#define MAINS_DETECT_RATIO       10.0f  // A line needs 10 dB more power than its neighbours
+#define TWOPI                    6.28318530717958647692f
+
+#if EEG_MAINS_MAX_HARMONICS != 4
+#error "EEG_MAINS_MAX_HARMONICS must be 4: eeg_mains_cancel() sums one 4-float vector by hand"
+#endif
+
+typedef float mains_vector_t __attribute__((vector_size(EEG_MAINS_MAX_HARMONICS * sizeof(float))));
+
+static const float mains_candidates_hz[EEG_MAINS_CANDIDATES] = { 50.0f, 60.0f };
+
+/** Where a tone at @p hz lands after sampling at @p sample_rate_hz (0..Nyquist) */
+static float mains_alias_hz(float hz, float sample_rate_hz)
+{
+    return fabsf(hz - sample_rate_hz * floorf(hz / sample_rate_hz + 0.5f));
+}
+
+static bool mains_alias_usable(float alias_hz, float sample_rate_hz)
+{
+    return (alias_hz >= MAINS_EDGE_MIN_HZ) && (alias_hz <= sample_rate_hz / 2.0f - MAINS_EDGE_MIN_HZ);
+}
+
+/**
+ * @brief Start detection at a (new) rate; power gathered so far is dropped
+ */
+void eeg_mains_detector_init(eeg_mains_detector_t *detector, uint32_t sample_rate_hz)
+{
+    float fs = (float) sample_rate_hz;
+    float alias[EEG_MAINS_CANDIDATES];
+
+    memset(detector, 0, sizeof(*detector));
+    detector->block_samples = sample_rate_hz;
+    for (int c = 0; c < EEG_MAINS_CANDIDATES; c++) {
+        alias[c] = mains_alias_hz(mains_candidates_hz[c], fs);
+        detector->usable[c] = mains_alias_usable(alias[c] - MAINS_NEIGHBOUR_HZ, fs) &&
+                              mains_alias_usable(alias[c] + MAINS_NEIGHBOUR_HZ, fs);
+        for (int j = 0; j < 3; j++) {
+            float hz = alias[c] + MAINS_NEIGHBOUR_HZ * (float) ((j + 1) % 3 - 1);   // alias, below, above
+            detector->coeff[c * 3 + j] = 2.0f * cosf(TWOPI * hz / fs);
+        }
+    }
+    /* Candidates that land on each other's bins cannot be told apart */
+    if (fabsf(alias[0] - alias[1]) <= MAINS_NEIGHBOUR_HZ) {
+        memset(detector->usable, 0, sizeof(detector->usable));
+    }
+}
+
+/**
+ * @brief Feed one input sample of every channel (μV, before filtering)
+ * @return 0 while listening, then the mains frequency: the candidate whose
+ *         line stands out most from its neighbours, or EEG_MAINS_HZ when
+ *         neither does (no pickup, or a rate that aliases both to DC/Nyquist)
+ */
+uint32_t eeg_mains_detect(eeg_mains_detector_t *detector, const float uv[EEG_CHANNELS])
+{
+    if (!detector->usable[0] && !detector->usable[1]) {
+        return EEG_MAINS_HZ;
+    }
+
+    if (0U == detector->block_fill) {
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            detector->origin[ch] = uv[ch];
+        }
+    }
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        /* Electrode offsets are orders of magnitude above the pickup; keep them out of the float recursion */
+        float x = uv[ch] - detector->origin[ch];
+        for (int t = 0; t < EEG_MAINS_TONES; t++) {
+            float s0 = x + detector->coeff[t] * detector->s1[ch][t] - detector->s2[ch][t];
+            detector->s2[ch][t] = detector->s1[ch][t];
+            detector->s1[ch][t] = s0;
+        }
+    }
+
+    if (++detector->block_fill < detector->block_samples) {
+        return 0U;
+    }
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        for (int t = 0; t < EEG_MAINS_TONES; t++) {
+            float s1 = detector->s1[ch][t];
+            float s2 = detector->s2[ch][t];
+            detector->power[t] += s1 * s1 + s2 * s2 - detector->coeff[t] * s1 * s2;
+        }
+    }
+    memset(detector->s1, 0, sizeof(detector->s1));
+    memset(detector->s2, 0, sizeof(detector->s2));
+    detector->block_fill = 0;
+
+    if (++detector->blocks < EEG_MAINS_DETECT_S) {
+        return 0U;
+    }
+
+    uint32_t mains_hz = EEG_MAINS_HZ;
+    float best = MAINS_DETECT_RATIO;
+    for (int c = 0; c < EEG_MAINS_CANDIDATES; c++) {
+        const float *p = &detector->power[c * 3];
+        float floor_power = 0.5f * (p[1] + p[2]) + 1e-12f;
+        if (detector->usable[c] && (p[0] > best * floor_power)) {
+            best = p[0] / floor_power;
+            mains_hz = (uint32_t) mains_candidates_hz[c];
+        }
+    }
+    return mains_hz;
+}
+
+/**
+ * @brief Configure the canceller for @p mains_hz at a (new) rate, weights cleared
+ * @note Takes the first EEG_MAINS_HARMONICS multiples of @p mains_hz, skipping
+ *       any whose alias sits at DC/Nyquist or on top of an earlier one.
+ */
+void eeg_mains_canceller_init(eeg_mains_canceller_t *canceller, uint32_t mains_hz, uint32_t sample_rate_hz)
+{
+    float fs = (float) sample_rate_hz;
+
+    memset(canceller, 0, sizeof(*canceller));
+    canceller->mains_hz = mains_hz;
+    canceller->step = TWOPI * EEG_MAINS_BANDWIDTH_HZ / fs;
+
+    for (uint32_t h = 1; (h <= EEG_MAINS_HARMONICS) && (canceller->harmonics < EEG_MAINS_MAX_HARMONICS); h++) {
+        float alias = mains_alias_hz((float) (h * mains_hz), fs);
+        bool distinct = mains_alias_usable(alias, fs);
+        for (uint32_t k = 0; k < canceller->harmonics; k++) {
+            distinct &= fabsf(alias - canceller->alias_hz[k]) >= MAINS_EDGE_MIN_HZ;
+        }
+        if (!distinct) continue;
+
+        uint32_t k = canceller->harmonics++;
+        canceller->alias_hz[k] = alias;
+        canceller->rotate_cos[k] = cosf(TWOPI * alias / fs);
+        canceller->rotate_sin[k] = sinf(TWOPI * alias / fs);
+        canceller->ref_cos[k] = 1.0f;
+        canceller->ref_sin[k] = 0.0f;
+        canceller->coupling += canceller->rotate_cos[k];
+    }
+}
+
+/**
+ * @brief Cancel mains in place in samples[ch][0..count) of the first @p channels channels
+ * @param count Up to EEG_FILTER_BLOCK_SAMPLES consecutive samples
+ * @note The references for the block are generated once and shared by every
+ *       channel; each channel then runs its own weights through the block,
+ *       each output sample being the error the weights adapt on.
+ *
+ *       The harmonics are the lanes of one 4-float vector (Helium on the
+ *       M85), so the estimate and the weight update are one multiply-add
+ *       each whatever EEG_MAINS_HARMONICS is; unused harmonics have zero
+ *       references. The weights a sample adapts to only reach its
+ *       successor's estimate through the reference product, which for unit
+ *       phasors is the constant coupling = sum(cos w_k):
+ *           estimate[i] = w[i-1] . r[i] + adapt[i-1] * coupling
+ *       so the weight update runs off the sample-to-sample dependency chain.
+ */
+void eeg_mains_cancel(eeg_mains_canceller_t *canceller, float (*samples)[EEG_FILTER_BLOCK_SAMPLES],
+                      uint32_t channels, uint32_t count)
+{
+    static mains_vector_t ref_cos[EEG_FILTER_BLOCK_SAMPLES];
+    static mains_vector_t ref_sin[EEG_FILTER_BLOCK_SAMPLES];
+    const float step = canceller->step;
+    const float coupling = canceller->coupling;
+    const float feedback = step * coupling;
+    mains_vector_t c, s, rc, rs;
+
+    if ((0U == canceller->harmonics) || (0U == count) || (count > EEG_FILTER_BLOCK_SAMPLES)) {
+        return;
+    }
+
+    memcpy(&c, canceller->ref_cos, sizeof(c));
+    memcpy(&s, canceller->ref_sin, sizeof(s));
+    memcpy(&rc, canceller->rotate_cos, sizeof(rc));
+    memcpy(&rs, canceller->rotate_sin, sizeof(rs));
+    for (uint32_t i = 0; i < count; i++) {
+        ref_cos[i] = c;
+        ref_sin[i] = s;
+        mains_vector_t next = c * rc - s * rs;
+        s = s * rc + c * rs;
+        c = next;
+    }
+    /* Pull the oscillators back onto the unit circle (one Newton step) */
+    mains_vector_t gain = 1.5f - 0.5f * (c * c + s * s);
+    c *= gain;
+    s *= gain;
+    memcpy(canceller->ref_cos, &c, sizeof(c));
+    memcpy(canceller->ref_sin, &s, sizeof(s));
+
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        float *x = samples[ch];
+        mains_vector_t wc, ws;
+        float adapt = 0.0f;
+
+        memcpy(&wc, canceller->weights_cos[ch], sizeof(wc));
+        memcpy(&ws, canceller->weights_sin[ch], sizeof(ws));
+        for (uint32_t i = 0; i < count; i++) {
+            mains_vector_t products = wc * ref_cos[i] + ws * ref_sin[i];
+            float partial = (products[0] + products[1]) + (products[2] + products[3]);
+            float residual = x[i] - partial;
+            x[i] = residual - adapt * coupling;
+            if (i > 0U) {
+                wc += adapt * ref_cos[i - 1U];
+                ws += adapt * ref_sin[i - 1U];
+            }
+            adapt = step * residual - feedback * adapt;     // step * error, one multiply-add on the chain
+        }
+        wc += adapt * ref_cos[count - 1U];
+        ws += adapt * ref_sin[count - 1U];
+        memcpy(canceller->weights_cos[ch], &wc, sizeof(wc));
+        memcpy(canceller->weights_sin[ch], &ws, sizeof(ws));
+    }
+}
@@ -0,0 +1,173 @@
+#include "hal_data.h"
+#include "eegMEDIAN.h"
+
+/**
+ * @file eegMEDIAN.c
+ * @brief Streaming sliding-window median/percentile (double heap over a ring)
+ *
+ * Used for the conditioning baseline (signalPROCESSING.c): a running median
+ * does not move while less than half its window is artifact, where a
+ * one-pole average is dragged off by every blink and takes seconds to come
+ * back. Any other percentile serves robust amplitude tracking the same way
+ * (e.g. the running median of |x - baseline| is a running MAD).
+ */
+
+/** Whether slot a belongs nearer the root than slot b: low is a max-heap, high a min-heap */
+static inline bool above(const eeg_median_tracker_t *tracker, bool low, uint16_t a, uint16_t b)
+{
+    return low ? (tracker->value[a] > tracker->value[b]) : (tracker->value[a] < tracker->value[b]);
+}
+
+static inline void place(eeg_median_tracker_t *tracker, bool low, uint16_t k, uint16_t slot)
+{
+    if (low) {
+        tracker->low[k] = slot;
+        tracker->where[slot] = (int16_t) (-1 - (int) k);
+    } else {
+        tracker->high[k] = slot;
+        tracker->where[slot] = (int16_t) k;
+    }
+}
+
+static uint16_t sift_up(eeg_median_tracker_t *tracker, bool low, uint16_t k)
+{
+    const uint16_t *heap = low ? tracker->low : tracker->high;
+    const uint16_t slot = heap[k];
+
+    while (k > 0U) {
+        uint16_t parent = (uint16_t) ((k - 1U) / 2U);
+        if (!above(tracker, low, slot, heap[parent])) break;
+        place(tracker, low, k, heap[parent]);
+        k = parent;
+    }
+    place(tracker, low, k, slot);
+    return k;
+}
+
+static void sift_down(eeg_median_tracker_t *tracker, bool low, uint16_t k)
+{
+    const uint16_t *heap = low ? tracker->low : tracker->high;
+    const uint16_t n = low ? tracker->low_count : tracker->high_count;
+    const uint16_t slot = heap[k];
+
+    for (;;) {
+        uint32_t child = 2U * k + 1U;
+        if (child >= n) break;
+        if ((child + 1U < n) && above(tracker, low, heap[child + 1U], heap[child])) child++;
+        if (!above(tracker, low, heap[child], slot)) break;
+        place(tracker, low, k, heap[child]);
+        k = (uint16_t) child;
+    }
+    place(tracker, low, k, slot);
+}
+
+static void heap_push(eeg_median_tracker_t *tracker, bool low, uint16_t slot)
+{
+    uint16_t k = low ? tracker->low_count++ : tracker->high_count++;
+    place(tracker, low, k, slot);
+    (void) sift_up(tracker, low, k);
+}
+
+static uint16_t heap_pop(eeg_median_tracker_t *tracker, bool low)
+{
+    const uint16_t *heap = low ? tracker->low : tracker->high;
+    uint16_t top = heap[0];
+    uint16_t n = low ? --tracker->low_count : --tracker->high_count;
+
+    if (n > 0U) {
+        place(tracker, low, 0, heap[n]);
+        sift_down(tracker, low, 0);
+    }
+    return top;
+}
+
+/**
+ * @brief Track the @p percentile of the last @p window inputs taken, one input in @p decimation
+ * @return FSP_ERR_INVALID_ARGUMENT unless 1 <= window <= EEG_MEDIAN_MAX_WINDOW,
+ *         decimation >= 1 and 0 <= percentile <= 1
+ */
+fsp_err_t eeg_median_init(eeg_median_tracker_t *tracker, uint32_t window, float percentile, uint32_t decimation)
+{
+    if ((0U == window) || (window > EEG_MEDIAN_MAX_WINDOW) || (0U == decimation) ||
+        !(percentile >= 0.0f) || (percentile > 1.0f)) {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    tracker->window = (uint16_t) window;
+    tracker->percentile = percentile;
+    tracker->decimation = decimation;
+    eeg_median_reset(tracker);
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Forget every input; the next one is taken and is the percentile on its own
+ */
+void eeg_median_reset(eeg_median_tracker_t *tracker)
+{
+    tracker->count = 0;
+    tracker->next = 0;
+    tracker->low_count = 0;
+    tracker->high_count = 0;
+    tracker->phase = tracker->decimation - 1U;
+}
+
+/**
+ * @brief Offer one input
+ * @return true if it was taken (every decimation-th), false if skipped
+ */
+bool eeg_median_push(eeg_median_tracker_t *tracker, float x)
+{
+    if (++tracker->phase < tracker->decimation) {
+        return false;
+    }
+    tracker->phase = 0;
+
+    const uint16_t slot = tracker->next;
+    tracker->next = (uint16_t) ((slot + 1U == tracker->window) ? 0U : slot + 1U);
+    tracker->value[slot] = x;
+
+    if (tracker->count == tracker->window) {
+        /* The oldest input's slot takes the new one: re-sift it where it is ... */
+        const int16_t where = tracker->where[slot];
+        const bool low = (where < 0);
+        const uint16_t k = (uint16_t) (low ? -1 - where : where);
+        if (sift_up(tracker, low, k) == k) {
+            sift_down(tracker, low, k);
+        }
+
+        /* ... then one exchange of roots restores low <= high if it crossed over */
+        if ((0U != tracker->low_count) && (0U != tracker->high_count) &&
+            (tracker->value[tracker->low[0]] > tracker->value[tracker->high[0]])) {
+            const uint16_t a = tracker->low[0];
+            const uint16_t b = tracker->high[0];
+            place(tracker, true, 0, b);
+            place(tracker, false, 0, a);
+            sift_down(tracker, true, 0);
+            sift_down(tracker, false, 0);
+        }
+        return true;
+    }
+
+    /* Still filling: insert on the right side, then move roots across until low holds its share */
+    tracker->count++;
+    const bool low = (0U == tracker->low_count) || (x <= tracker->value[tracker->low[0]]);
+    heap_push(tracker, low, slot);
+
+    const uint16_t target = (uint16_t) ((uint32_t) (tracker->percentile * (float) (tracker->count - 1U)) + 1U);
+    while (tracker->low_count > target) {
+        heap_push(tracker, false, heap_pop(tracker, true));
+    }
+    while (tracker->low_count < target) {
+        heap_push(tracker, true, heap_pop(tracker, false));
+    }
+    return true;
+}
+
+/**
+ * @brief Current percentile of the inputs held (the lower middle one for an even median); 0 before any
+ */
+float eeg_median_value(const eeg_median_tracker_t *tracker)
+{
+    return (0U != tracker->count) ? tracker->value[tracker->low[0]] : 0.0f;
+}
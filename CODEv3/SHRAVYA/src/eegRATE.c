@@ -0,0 +1,151 @@
+#include "hal_data.h"
+#include "eegRATE.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+#include <string.h>
+
+/**
+ * @file eegRATE.c
+ * @brief The one sample-rate descriptor every module derives its timing from
+ *
+ * The ADS1263 only converts at its native data rates, so a requested
+ * per-channel rate is rounded to the nearest one of them (250 -> 400,
+ * 500 -> 400, 1000 -> 1200, 2000 -> 2400 on an ADC1-only direct montage).
+ * ADC2 tops out at 800 SPS, so a montage with a channel on ADC2 only gets
+ * the rates ADC2 keeps up with: a faster one would hold each ADC2 conversion
+ * across samples and pass the images of that hold off as signal.
+ * The descriptor also carries the feature window the rate implies - the
+ * decimation to the window rate, and the window length and hop there - so
+ * the filters, windows and spectral bins of a switch all come from one place.
+ */
+
+typedef struct {
+    uint16_t adc1_sps;
+    uint8_t mode2_dr;
+    uint16_t adc2_sps;
+    uint8_t adc2cfg_dr;
+} eeg_rate_entry_t;
+
+/* ADS1263 data rates usable for the 0.5-45 Hz EEG band (MODE2 DR / ADC2CFG DR2 codes; ADC2 at most 800) */
+static const eeg_rate_entry_t eeg_rates[] = {
+    {  100, 0x07, 100, 0x01 },
+    {  400, 0x08, 400, 0x02 },
+    { 1200, 0x09, 800, 0x03 },
+    { 2400, 0x0A, 800, 0x03 },
+};
+#define EEG_RATE_COUNT (sizeof(eeg_rates) / sizeof(eeg_rates[0]))
+
+static eeg_rate_t current_rate;
+static bool current_rate_valid = false;
+
+/**
+ * @brief Describe the native rate nearest @p requested_hz per channel
+ * @param requested_hz Per-channel rate wanted, e.g. 250/500/1000/2000
+ * @param scan_depth ADC1 routes scanned through INPMUX on the busiest device (>= 1)
+ * @param adc2_routed A montage channel converts on ADC2: only rates where ADC2
+ *        converts at least once per sample
+ * @param rate Receives the descriptor
+ * @return FSP_SUCCESS or FSP_ERR_INVALID_ARGUMENT for a zero request
+ */
+fsp_err_t eeg_rate_describe(uint32_t requested_hz, uint32_t scan_depth, bool adc2_routed, eeg_rate_t *rate)
+{
+    if (!rate) return FSP_ERR_INVALID_POINTER;
+    if (0U == requested_hz) return FSP_ERR_INVALID_ARGUMENT;
+    if (0U == scan_depth) scan_depth = 1U;
+
+    /* Nearest per-channel rate, ties to the faster one (the slowest entry always qualifies) */
+    uint32_t best = 0;
+    for (uint32_t i = 1; i < EEG_RATE_COUNT; i++) {
+        uint32_t best_hz = eeg_rates[best].adc1_sps / scan_depth;
+        uint32_t hz = eeg_rates[i].adc1_sps / scan_depth;
+        if (adc2_routed && (eeg_rates[i].adc2_sps < hz)) continue;
+        uint32_t best_error = (best_hz > requested_hz) ? best_hz - requested_hz : requested_hz - best_hz;
+        uint32_t error = (hz > requested_hz) ? hz - requested_hz : requested_hz - hz;
+        if (error <= best_error) best = i;
+    }
+
+    const eeg_rate_entry_t *entry = &eeg_rates[best];
+    rate->adc1_sps = entry->adc1_sps;
+    rate->adc2_sps = entry->adc2_sps;
+    rate->mode2_dr = entry->mode2_dr;
+    rate->adc2cfg_dr = entry->adc2cfg_dr;
+    rate->sample_rate_hz = entry->adc1_sps / scan_depth;
+    if (0U == rate->sample_rate_hz) rate->sample_rate_hz = 1U;
+    rate->sample_interval_us = 1000000U / rate->sample_rate_hz;
+
+    /* Slowest whole division of the rate still at or above EEG_DECIMATED_RATE_HZ */
+    rate->decimation = 1U;
+    for (uint32_t m = 2; (EEG_DECIMATED_RATE_HZ > 0) && (m <= EEG_DECIMATE_MAX_FACTOR); m++) {
+        if ((0U == rate->sample_rate_hz % m) && (rate->sample_rate_hz / m >= EEG_DECIMATED_RATE_HZ)) {
+            rate->decimation = m;
+        }
+    }
+    rate->window_rate_hz = rate->sample_rate_hz / rate->decimation;
+
+    /* Power of two nearest (on a log scale) to EEG_WINDOW_SECONDS of window samples */
+    float target = (float) rate->window_rate_hz * EEG_WINDOW_SECONDS;
+    uint32_t window = EEG_WINDOW_MIN_SAMPLES;
+    while ((window < EEG_WINDOW_MAX_SAMPLES) && ((float) window * 1.41421356f < target)) {
+        window <<= 1;
+    }
+    rate->window_samples = window;
+    rate->hop_samples = (uint32_t) ((float) window * EEG_WINDOW_HOP_FRACTION + 0.5f);
+    if (rate->hop_samples < 1U) rate->hop_samples = 1U;
+    if (rate->hop_samples > window) rate->hop_samples = window;
+    rate->bin_hz = (float) rate->window_rate_hz / (float) window;
+
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Every per-channel rate eeg_rate_describe() can return, ascending
+ * @param rates Receives up to @p max rates (one per native rate and scan depth 1..ADS1263_MAX_PAIRS)
+ * @return Number of distinct rates
+ */
+uint32_t eeg_rate_sample_rates(uint32_t *rates, uint32_t max)
+{
+    uint32_t count = 0;
+
+    for (uint32_t depth = 1; depth <= ADS1263_MAX_PAIRS; depth++) {
+        for (uint32_t i = 0; i < EEG_RATE_COUNT; i++) {
+            uint32_t hz = eeg_rates[i].adc1_sps / depth;
+            uint32_t at = 0;
+            while ((at < count) && (rates[at] < hz)) at++;
+            if (((at < count) && (rates[at] == hz)) || (count >= max)) continue;
+            memmove(&rates[at + 1U], &rates[at], (count - at) * sizeof(rates[0]));
+            rates[at] = hz;
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Make the rate nearest @p requested_hz the one the montage image programs
+ * @param rate Receives the new descriptor (may be NULL)
+ * @note Only changes the descriptor; ads1263_montage_apply_rate() (task path)
+ *       or ads1263_montage_rate_bytes() (DTC path) put it on the devices.
+ */
+fsp_err_t eeg_rate_select(uint32_t requested_hz, eeg_rate_t *rate)
+{
+    eeg_rate_t selected;
+    fsp_err_t err = eeg_rate_describe(requested_hz, ads1263_montage_scan_depth(), ads1263_montage_uses_adc2(),
+                                      &selected);
+    if (FSP_SUCCESS != err) return err;
+
+    current_rate = selected;
+    current_rate_valid = true;
+    if (rate) *rate = selected;
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Rate the ADS1263s run at (EEG_SAMPLE_RATE_HZ until eeg_rate_select())
+ */
+const eeg_rate_t *eeg_rate_get(void)
+{
+    if (!current_rate_valid) {
+        (void) eeg_rate_select(EEG_SAMPLE_RATE_HZ, NULL);
+    }
+    return &current_rate;
+}
@@ -0,0 +1,213 @@
+#include "hal_data.h"
+#include "eegRECORD.h"
+#include "eegCODEC.h"
+#include <string.h>
+
+/**
+ * @file eegRECORD.c
+ * @brief Raw recording block format - header codec, 24-bit packing, CRC-32
+ *
+ * Headers are serialized field by field (little-endian) rather than written
+ * as a struct, so the on-media layout does not depend on the compiler's
+ * padding and the host decoder reads exactly what the recorder wrote.
+ */
+
+static uint32_t crc_table[256];
+static bool crc_table_ready = false;
+
+static void crc_table_init(void)
+{
+    for (uint32_t i = 0; i < 256U; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        crc_table[i] = crc;
+    }
+    crc_table_ready = true;
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3, same polynomial as ads1263_crc32), table-driven
+ * @param crc 0 to start, or the result of the previous call to continue
+ */
+uint32_t eeg_record_crc32(uint32_t crc, const void *data, uint32_t length)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+
+    if (!crc_table_ready) crc_table_init();
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = (crc >> 8) ^ crc_table[(crc ^ bytes[i]) & 0xFFU];
+    }
+    return ~crc;
+}
+
+static void put16(uint8_t *out, uint16_t value)
+{
+    out[0] = (uint8_t) value;
+    out[1] = (uint8_t) (value >> 8);
+}
+
+static void put32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t) value;
+    out[1] = (uint8_t) (value >> 8);
+    out[2] = (uint8_t) (value >> 16);
+    out[3] = (uint8_t) (value >> 24);
+}
+
+static uint16_t get16(const uint8_t *in)
+{
+    return (uint16_t) (in[0] | (in[1] << 8));
+}
+
+static uint32_t get32(const uint8_t *in)
+{
+    return (uint32_t) in[0] | ((uint32_t) in[1] << 8) | ((uint32_t) in[2] << 16) | ((uint32_t) in[3] << 24);
+}
+
+/**
+ * @brief Serialize @p header and fill in its header CRC
+ * @note payload_bytes/payload_crc32 must already be set; header_crc32 is computed here.
+ */
+void eeg_record_header_encode(const eeg_record_header_t *header, uint8_t bytes[EEG_RECORD_HEADER_BYTES])
+{
+    put32(&bytes[0], EEG_RECORD_MAGIC);
+    put16(&bytes[4], EEG_RECORD_VERSION);
+    put16(&bytes[6], EEG_RECORD_HEADER_BYTES);
+    put32(&bytes[8], header->block_bytes);
+    put32(&bytes[12], header->session_id);
+    put32(&bytes[16], header->block_sequence);
+    put32(&bytes[20], header->first_sample);
+    put32(&bytes[24], header->first_sequence);
+    put32(&bytes[28], header->timestamp_us);
+    put32(&bytes[32], header->sample_rate_hz);
+    put16(&bytes[36], header->sample_count);
+    bytes[38] = header->channel_count;
+    bytes[39] = header->flags;
+    memcpy(&bytes[40], header->channel_map, sizeof(header->channel_map));
+    put32(&bytes[88], header->payload_bytes);
+    put32(&bytes[92], header->payload_crc32);
+    put32(&bytes[96], eeg_record_crc32(0, bytes, 96U));
+}
+
+/**
+ * @brief Parse and validate a serialized header
+ * @return FSP_SUCCESS, FSP_ERR_NOT_FOUND (erased/foreign data or other version)
+ *         or FSP_ERR_INVALID_DATA (header CRC or field mismatch)
+ */
+fsp_err_t eeg_record_header_decode(const uint8_t *bytes, eeg_record_header_t *header)
+{
+    if (!bytes || !header) return FSP_ERR_INVALID_POINTER;
+    if ((get32(&bytes[0]) != EEG_RECORD_MAGIC) || (get16(&bytes[4]) != EEG_RECORD_VERSION)) {
+        return FSP_ERR_NOT_FOUND;
+    }
+
+    header->magic = get32(&bytes[0]);
+    header->version = get16(&bytes[4]);
+    header->header_bytes = get16(&bytes[6]);
+    header->block_bytes = get32(&bytes[8]);
+    header->session_id = get32(&bytes[12]);
+    header->block_sequence = get32(&bytes[16]);
+    header->first_sample = get32(&bytes[20]);
+    header->first_sequence = get32(&bytes[24]);
+    header->timestamp_us = get32(&bytes[28]);
+    header->sample_rate_hz = get32(&bytes[32]);
+    header->sample_count = get16(&bytes[36]);
+    header->channel_count = bytes[38];
+    header->flags = bytes[39];
+    memcpy(header->channel_map, &bytes[40], sizeof(header->channel_map));
+    header->payload_bytes = get32(&bytes[88]);
+    header->payload_crc32 = get32(&bytes[92]);
+    header->header_crc32 = get32(&bytes[96]);
+
+    if (header->header_crc32 != eeg_record_crc32(0, bytes, 96U)) return FSP_ERR_INVALID_DATA;
+    uint32_t packed = (uint32_t) header->sample_count * header->channel_count * EEG_RECORD_SAMPLE_BYTES;
+    if ((header->header_bytes != EEG_RECORD_HEADER_BYTES) ||
+        (header->channel_count == 0U) || (header->channel_count > EEG_RECORD_MAX_CHANNELS) ||
+        (header->payload_bytes > header->block_bytes - EEG_RECORD_HEADER_BYTES) ||
+        (!(header->flags & EEG_RECORD_FLAG_CODED) && (header->payload_bytes != packed))) {
+        return FSP_ERR_INVALID_DATA;
+    }
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Validate a whole block - header, then payload CRC
+ * @param length Bytes available at @p block (at least the block size the header claims)
+ */
+fsp_err_t eeg_record_block_check(const uint8_t *block, uint32_t length, eeg_record_header_t *header)
+{
+    if (length < EEG_RECORD_HEADER_BYTES) return FSP_ERR_INVALID_SIZE;
+
+    fsp_err_t err = eeg_record_header_decode(block, header);
+    if (FSP_SUCCESS != err) return err;
+    if (header->block_bytes > length) return FSP_ERR_INVALID_SIZE;
+
+    if (header->payload_crc32 != eeg_record_crc32(0, block + EEG_RECORD_HEADER_BYTES, header->payload_bytes)) {
+        return FSP_ERR_INVALID_DATA;
+    }
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Store the low 24 bits of @p value, little-endian
+ */
+void eeg_record_pack24(uint8_t *out, int32_t value)
+{
+    out[0] = (uint8_t) value;
+    out[1] = (uint8_t) ((uint32_t) value >> 8);
+    out[2] = (uint8_t) ((uint32_t) value >> 16);
+}
+
+/**
+ * @brief Sign-extend a packed 24-bit value
+ */
+int32_t eeg_record_unpack24(const uint8_t *in)
+{
+    uint32_t raw = (uint32_t) in[0] | ((uint32_t) in[1] << 8) | ((uint32_t) in[2] << 16);
+    return (int32_t) (raw << 8) >> 8;
+}
+
+/**
+ * @brief Reconstruct every raw ADC count of a checked block
+ * @param values Receives sample_count x channel_count values, sample-interleaved,
+ *               in acquisition units (ADC1 rescaled to 32-bit counts)
+ * @return FSP_SUCCESS, or FSP_ERR_INVALID_DATA when coded frames do not add up
+ */
+fsp_err_t eeg_record_block_samples(const uint8_t *block, const eeg_record_header_t *header, int32_t *values)
+{
+    const uint8_t *payload = block + EEG_RECORD_HEADER_BYTES;
+    const uint32_t channels = header->channel_count;
+    const uint32_t total = header->sample_count;
+
+    if (header->flags & EEG_RECORD_FLAG_CODED) {
+        static eeg_codec_state_t codec;
+        uint32_t done = 0;
+        uint32_t used = 0;
+
+        eeg_codec_reset(&codec, (uint8_t) channels);
+        while (done < total) {
+            uint32_t frame_samples = 0;
+            uint32_t bytes = eeg_codec_decode(&codec, payload + used, header->payload_bytes - used,
+                                              values + done * channels, total - done, &frame_samples);
+            if (0U == bytes) return FSP_ERR_INVALID_DATA;
+            used += bytes;
+            done += frame_samples;
+        }
+        if (used != header->payload_bytes) return FSP_ERR_INVALID_DATA;
+    } else {
+        for (uint32_t i = 0; i < total * channels; i++) {
+            values[i] = eeg_record_unpack24(payload + i * EEG_RECORD_SAMPLE_BYTES);
+        }
+    }
+
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        if (1U != header->channel_map[ch][1]) continue;
+        for (uint32_t i = 0; i < total; i++) {
+            values[i * channels + ch] = (int32_t) ((uint32_t) values[i * channels + ch] << 8);
+        }
+    }
+    return FSP_SUCCESS;
+}
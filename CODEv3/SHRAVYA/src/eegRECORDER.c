@@ -0,0 +1,411 @@
+#include "hal_data.h"
+#include "eegRECORDER.h"
+#include "ads1263HAL.h"
+#include "shravyaCONFIG.h"
+#include <string.h>
+
+/**
+ * @file eegRECORDER.c
+ * @brief Continuous raw EEG recorder - packs ring samples into eegRECORD.h blocks
+ *
+ * Two block buffers sit between the producer and the medium. The acquisition
+ * task packs samples into one (eeg_recorder_append()) while the writer task
+ * erases and programs the other (eeg_recorder_write_pending()), so a flash
+ * erase never stalls a DRDY. When both buffers are queued append() takes
+ * nothing and the samples simply stay in the acquisition ring until a buffer
+ * frees up; the ring's depth, not this module, absorbs slow erases.
+ *
+ * Blocks are only closed at a full payload, a ring discontinuity, a rate
+ * switch or stop, so every block holds one rate and one contiguous run of
+ * ring indices. Plain C over a storage table; the host build records to a file.
+ *
+ * With EEG_RECORDER_COMPRESSION the payload is eegCODEC frames: samples are
+ * staged per channel and coded a frame at a time. A frame is never staged
+ * larger than the block could hold stored verbatim, so every staged frame
+ * fits - a forced close never needs a second buffer, and the last frames
+ * of a block shrink instead of leaving its tail unused.
+ */
+
+typedef enum {
+    BLOCK_FREE = 0,           // Owned by the producer, not in use
+    BLOCK_FILLING,            // Producer packing samples into it
+    BLOCK_FULL                // Queued for the writer
+} recorder_block_state_t;
+
+static const eeg_recorder_storage_t *recorder_storage = NULL;
+static eeg_recorder_source_t recorder_source;
+
+static uint8_t block_buffer[2][EEG_RECORDER_BLOCK_BYTES] __attribute__((aligned(8)));
+static volatile uint32_t block_state[2];
+static uint16_t block_samples[2];
+static uint32_t block_payload[2];
+
+/* Producer side (acquisition task) */
+static volatile bool recording = false;
+static uint32_t fill_slot = 0;            // Buffer the next sample goes to
+static uint32_t fill_count = 0;           // Samples in it, 0 = not opened yet
+static uint32_t fill_next_index = 0;      // Ring index that continues the open block
+static uint32_t block_sequence = 0;
+static uint32_t rate_hz = 0;
+static uint8_t channel_shift[EEG_CHANNELS];  // ADC1 keeps its top 24 bits
+static uint8_t channel_map[EEG_RECORD_MAX_CHANNELS][3];
+static eeg_record_header_t fill_header;
+static bool stalled = false;
+
+#if EEG_RECORDER_COMPRESSION
+static int32_t staging[EEG_CHANNELS][EEG_RECORDER_FRAME_SAMPLES];
+static uint32_t staged = 0;               // Samples of the open block not coded yet
+static uint32_t frame_limit = 0;          // Staged samples that still fit the block verbatim
+static uint32_t fill_bytes = 0;           // Coded payload bytes in the open block
+static eeg_codec_state_t codec;
+#endif
+
+/* Writer side (writer task) */
+static uint32_t write_slot = 0;
+static uint32_t write_offset = 0;
+
+static eeg_recorder_stats_t stats;
+
+/**
+ * @brief Bind the medium blocks are written to
+ */
+void eeg_recorder_storage_register(const eeg_recorder_storage_t *storage)
+{
+    recorder_storage = storage;
+}
+
+const eeg_recorder_storage_t *eeg_recorder_storage_get(void)
+{
+    return recorder_storage;
+}
+
+/**
+ * @brief Start a new session at the beginning of the storage region
+ * @param session_id Written to every block, tells recordings apart on the medium
+ * @param rate Rate of the first sample appended
+ * @param source Resolves the timestamp/sequence of a block's first sample
+ * @return FSP_SUCCESS, FSP_ERR_NOT_OPEN (no storage) or FSP_ERR_IN_USE (previous
+ *         session still active or flushing)
+ */
+fsp_err_t eeg_recorder_start(uint32_t session_id, const eeg_rate_t *rate, const eeg_recorder_source_t *source)
+{
+    if (!rate || !source) return FSP_ERR_INVALID_POINTER;
+    if (!recorder_storage) return FSP_ERR_NOT_OPEN;
+    if ((recorder_storage->erase_bytes % EEG_RECORDER_BLOCK_BYTES) != 0U ||
+        (recorder_storage->capacity_bytes < recorder_storage->erase_bytes)) {
+        return FSP_ERR_INVALID_SIZE;
+    }
+    if (recording || !eeg_recorder_idle()) return FSP_ERR_IN_USE;
+
+    const ads1263_route_t *routes = ads1263_montage_routes();
+    memset(channel_map, 0, sizeof(channel_map));
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        channel_map[ch][0] = routes[ch].device;
+        channel_map[ch][1] = routes[ch].adc;
+        channel_map[ch][2] = routes[ch].mux;
+        channel_shift[ch] = (1U == routes[ch].adc) ? 8U : 0U;
+    }
+
+    recorder_source = *source;
+    memset(&stats, 0, sizeof(stats));
+    stats.session_id = session_id;
+    rate_hz = rate->sample_rate_hz;
+    block_sequence = 0;
+    fill_slot = 0;
+    fill_count = 0;
+    write_slot = 0;
+    write_offset = 0;
+    stalled = false;
+    block_state[0] = BLOCK_FREE;
+    block_state[1] = BLOCK_FREE;
+    __atomic_store_n(&recording, true, __ATOMIC_RELEASE);
+    return FSP_SUCCESS;
+}
+
+#if EEG_RECORDER_COMPRESSION
+/**
+ * @brief Largest frame the open block can still take if every sample is stored verbatim
+ */
+static uint32_t recorder_frame_limit(void)
+{
+    uint32_t room = EEG_RECORDER_BLOCK_BYTES - EEG_RECORD_HEADER_BYTES - fill_bytes;
+    if (room <= 1U) return 0;
+
+    uint32_t channel_bits = 8U * (room - 1U) / EEG_CHANNELS;
+    if (channel_bits < 3U + EEG_CODEC_SAMPLE_BITS) return 0;
+
+    uint32_t limit = (channel_bits - 3U) / EEG_CODEC_SAMPLE_BITS;
+    if (limit > EEG_RECORDER_FRAME_SAMPLES) limit = EEG_RECORDER_FRAME_SAMPLES;
+    if (limit > 0xFFFFU - fill_count) limit = 0xFFFFU - fill_count;  // u16 sample_count
+    return limit;
+}
+
+/**
+ * @brief Code the staged samples as one frame at the end of the open block
+ */
+static void recorder_code_staged(void)
+{
+    const int32_t *channel[EEG_CHANNELS];
+
+    if (staged > 0U) {
+        uint32_t room = EEG_RECORDER_BLOCK_BYTES - EEG_RECORD_HEADER_BYTES - fill_bytes;
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) channel[ch] = staging[ch];
+        fill_bytes += eeg_codec_encode(&codec, channel, 1U, staged,
+                                       block_buffer[fill_slot] + EEG_RECORD_HEADER_BYTES + fill_bytes, room);
+        staged = 0;
+    }
+    frame_limit = recorder_frame_limit();
+}
+#endif
+
+/**
+ * @brief Finish the open block and queue it for the writer
+ */
+static void recorder_close_block(uint8_t flags)
+{
+    uint8_t *block = block_buffer[fill_slot];
+#if EEG_RECORDER_COMPRESSION
+    recorder_code_staged();
+    uint32_t payload = fill_bytes;
+    flags |= EEG_RECORD_FLAG_CODED;
+#else
+    uint32_t payload = fill_count * EEG_CHANNELS * EEG_RECORD_SAMPLE_BYTES;
+#endif
+
+    fill_header.sample_count = (uint16_t) fill_count;
+    fill_header.payload_bytes = payload;
+    fill_header.flags |= flags;
+    fill_header.payload_crc32 = eeg_record_crc32(0, block + EEG_RECORD_HEADER_BYTES, payload);
+    eeg_record_header_encode(&fill_header, block);
+    memset(block + EEG_RECORD_HEADER_BYTES + payload, 0xFF,
+           EEG_RECORDER_BLOCK_BYTES - EEG_RECORD_HEADER_BYTES - payload);
+
+    block_samples[fill_slot] = (uint16_t) fill_count;
+    block_payload[fill_slot] = payload;
+    __atomic_store_n(&block_state[fill_slot], BLOCK_FULL, __ATOMIC_RELEASE);
+    fill_slot ^= 1U;
+    fill_count = 0;
+}
+
+/**
+ * @brief Open a block in the next buffer for samples starting at @p ring_index
+ * @return false while that buffer is still queued for the writer
+ */
+static bool recorder_open_block(uint32_t ring_index)
+{
+    if (__atomic_load_n(&block_state[fill_slot], __ATOMIC_ACQUIRE) != BLOCK_FREE) {
+        if (!stalled) stats.buffer_stalls++;
+        stalled = true;
+        return false;
+    }
+    stalled = false;
+
+    memset(&fill_header, 0, sizeof(fill_header));
+    fill_header.block_bytes = EEG_RECORDER_BLOCK_BYTES;
+    fill_header.session_id = stats.session_id;
+    fill_header.block_sequence = block_sequence++;
+    fill_header.first_sample = ring_index;
+    fill_header.first_sequence = recorder_source.sequence_at(ring_index);
+    fill_header.timestamp_us = recorder_source.timestamp_at(ring_index);
+    fill_header.sample_rate_hz = rate_hz;
+    fill_header.channel_count = EEG_CHANNELS;
+    fill_header.flags = (0U == fill_header.block_sequence) ? EEG_RECORD_FLAG_FIRST : 0U;
+    memcpy(fill_header.channel_map, channel_map, sizeof(channel_map));
+
+    block_state[fill_slot] = BLOCK_FILLING;
+    fill_next_index = ring_index;
+#if EEG_RECORDER_COMPRESSION
+    eeg_codec_reset(&codec, EEG_CHANNELS);
+    staged = 0;
+    fill_bytes = 0;
+    frame_limit = recorder_frame_limit();
+#endif
+    return true;
+}
+
+/**
+ * @brief Samples the next append() can take without waiting for the writer
+ */
+uint32_t eeg_recorder_space(void)
+{
+    if (!__atomic_load_n(&recording, __ATOMIC_ACQUIRE)) return 0;
+#if EEG_RECORDER_COMPRESSION
+    /* Up to the end of the current frame; coded size decides the rest */
+    if (fill_count > 0U) return frame_limit - staged;
+    return (__atomic_load_n(&block_state[fill_slot], __ATOMIC_ACQUIRE) == BLOCK_FREE) ? EEG_RECORDER_FRAME_SAMPLES : 0U;
+#else
+    if (fill_count > 0U) return EEG_RECORDER_BLOCK_SAMPLES - fill_count;
+    return (__atomic_load_n(&block_state[fill_slot], __ATOMIC_ACQUIRE) == BLOCK_FREE) ? EEG_RECORDER_BLOCK_SAMPLES : 0U;
+#endif
+}
+
+/**
+ * @brief Pack ring samples into the open block (acquisition task)
+ * @param span Samples in ring order; first_index continues the previous call
+ *             unless the ring skipped samples, which starts a new block
+ * @param block_ready Set when a block was queued - wake the writer
+ * @return Samples taken from the front of @p span; the rest must be offered again
+ */
+uint32_t eeg_recorder_append(const eeg_sample_span_t *span, bool *block_ready)
+{
+    uint32_t taken = 0;
+
+    if (!span || !__atomic_load_n(&recording, __ATOMIC_ACQUIRE)) return 0;
+
+    if ((fill_count > 0U) && (span->first_index != fill_next_index)) {
+        recorder_close_block(0U);
+        if (block_ready) *block_ready = true;
+    }
+
+    while (taken < span->count) {
+        if ((0U == fill_count) && !recorder_open_block(span->first_index + taken)) break;
+
+#if EEG_RECORDER_COMPRESSION
+        uint32_t run = frame_limit - staged;
+        if (run > span->count - taken) run = span->count - taken;
+
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            const int32_t *in = &span->channel[ch][taken];
+            int32_t *out = &staging[ch][staged];
+            for (uint32_t i = 0; i < run; i++) out[i] = in[i] >> channel_shift[ch];
+        }
+        staged += run;
+        fill_count += run;
+        taken += run;
+        fill_next_index += run;
+
+        if (staged == frame_limit) {
+            recorder_code_staged();
+            if (0U == frame_limit) {
+                recorder_close_block(0U);
+                if (block_ready) *block_ready = true;
+            }
+        }
+#else
+        uint32_t run = EEG_RECORDER_BLOCK_SAMPLES - fill_count;
+        if (run > span->count - taken) run = span->count - taken;
+
+        uint8_t *out = block_buffer[fill_slot] + EEG_RECORD_HEADER_BYTES +
+                       fill_count * EEG_CHANNELS * EEG_RECORD_SAMPLE_BYTES;
+        for (uint32_t i = taken; i < taken + run; i++) {
+            for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                eeg_record_pack24(out, span->channel[ch][i] >> channel_shift[ch]);
+                out += EEG_RECORD_SAMPLE_BYTES;
+            }
+        }
+        fill_count += run;
+        taken += run;
+        fill_next_index += run;
+
+        if (fill_count == EEG_RECORDER_BLOCK_SAMPLES) {
+            recorder_close_block(0U);
+            if (block_ready) *block_ready = true;
+        }
+#endif
+    }
+
+    stats.samples_packed += taken;
+    return taken;
+}
+
+/**
+ * @brief Samples appended from now on run at @p rate (acquisition task)
+ * @return true when the partial block was queued - wake the writer
+ */
+bool eeg_recorder_set_rate(const eeg_rate_t *rate)
+{
+    bool queued = false;
+
+    if (!rate) return false;
+    if (recording && (fill_count > 0U) && (rate->sample_rate_hz != rate_hz)) {
+        recorder_close_block(EEG_RECORD_FLAG_RATE);
+        queued = true;
+    }
+    rate_hz = rate->sample_rate_hz;
+    return queued;
+}
+
+/**
+ * @brief Stop accepting samples and queue the partial block (acquisition task)
+ * @return true when a block was queued - wake the writer to flush it
+ */
+bool eeg_recorder_stop(void)
+{
+    bool queued = false;
+
+    if (!recording) return false;
+    if (fill_count > 0U) {
+        recorder_close_block(EEG_RECORD_FLAG_LAST);
+        queued = true;
+    }
+    __atomic_store_n(&recording, false, __ATOMIC_RELEASE);
+    return queued;
+}
+
+bool eeg_recorder_active(void)
+{
+    return __atomic_load_n(&recording, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief No block is being filled or waiting for the writer
+ */
+bool eeg_recorder_idle(void)
+{
+    return (__atomic_load_n(&block_state[0], __ATOMIC_ACQUIRE) != BLOCK_FULL) &&
+           (__atomic_load_n(&block_state[1], __ATOMIC_ACQUIRE) != BLOCK_FULL) &&
+           (!recording || (0U == fill_count));
+}
+
+/**
+ * @brief Write the oldest queued block to the medium (writer task)
+ * @return true when a block was written (or dropped on error); call again until false
+ * @note Erases each erase unit as the write position enters it. The region is
+ *       circular: after the last block the session continues at offset 0,
+ *       overwriting its own oldest blocks.
+ */
+bool eeg_recorder_write_pending(void)
+{
+    if (__atomic_load_n(&block_state[write_slot], __ATOMIC_ACQUIRE) != BLOCK_FULL) return false;
+
+    if (write_offset + EEG_RECORDER_BLOCK_BYTES > recorder_storage->capacity_bytes) {
+        write_offset = 0;
+        stats.wraps++;
+    }
+
+    fsp_err_t err = FSP_SUCCESS;
+    if ((write_offset % recorder_storage->erase_bytes) == 0U) {
+        err = recorder_storage->erase(write_offset);
+    }
+    if (FSP_SUCCESS == err) {
+        err = recorder_storage->program(write_offset, block_buffer[write_slot], EEG_RECORDER_BLOCK_BYTES);
+    }
+
+    if (FSP_SUCCESS == err) {
+        stats.blocks_written++;
+        stats.samples_written += block_samples[write_slot];
+        stats.payload_bytes_written += block_payload[write_slot];
+        write_offset += EEG_RECORDER_BLOCK_BYTES;
+    } else {
+        /* A failing medium ends the session; the ring keeps feeding processing */
+        stats.write_errors++;
+        __atomic_store_n(&recording, false, __ATOMIC_RELEASE);
+    }
+
+    __atomic_store_n(&block_state[write_slot], BLOCK_FREE, __ATOMIC_RELEASE);
+    write_slot ^= 1U;
+    return true;
+}
+
+/**
+ * @brief Fold one measured write_pending() duration into the stats
+ */
+void eeg_recorder_note_write_time(uint32_t elapsed_us)
+{
+    if (elapsed_us > stats.max_write_us) stats.max_write_us = elapsed_us;
+}
+
+const eeg_recorder_stats_t *eeg_recorder_get_stats(void)
+{
+    return &stats;
+}
@@ -0,0 +1,236 @@
+#include "hal_data.h"
+#include "eegWAVELET.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file eegWAVELET.c
+ * @brief Lifting-scheme wavelet denoising and octave energies of a window
+ *
+ * CDF 9/7 (the JPEG 2000 lossy wavelet): four vanishing moments like
+ * db4/sym4, but symmetric, so mirroring the window about its end samples
+ * extends it exactly and neither edge leaks into the other the way a
+ * periodic db4 would. Each level is four lifting steps and a scaling over
+ * the approximation of the level before, in place - the whole
+ * decomposition costs under 2 x 5 multiply-adds per sample (O(N)) and no
+ * buffer beyond the window, and the inverse undoes the same steps in
+ * reverse, so an untouched transform gives the window back to rounding.
+ *
+ * Denoising soft-thresholds each detail level at BayesShrink's
+ * sigma^2 / sigma_signal, with the noise sigma estimated (MAD / 0.6745) on
+ * the finest details the conditioning lowpass has not already emptied and
+ * sigma_signal what the level's variance holds beyond it: a level carrying
+ * a rhythm well above the noise is barely touched, a level that is mostly
+ * the broadband floor EMG and sensor noise spread over the details is
+ * thresholded hard, one with nothing beyond the noise is cleared. A single
+ * universal threshold (sigma * sqrt(2 ln N)) takes the same full threshold
+ * off every rhythm's coefficients, and on these short windows that cost a
+ * tone more than the noise it removed. The level energies are the
+ * alternative route to band powers - octave resolution only, so each band
+ * takes the share of every octave it overlaps.
+ */
+
+#define LIFT_ALPHA      -1.586134342f   // Predict 1
+#define LIFT_BETA       -0.05298011854f // Update 1
+#define LIFT_GAMMA       0.8829110762f  // Predict 2
+#define LIFT_DELTA       0.4435068522f  // Update 2
+#define LOW_GAIN         1.149604399f   // sqrt(2) / K: DC gain sqrt(2) per level, so energies are preserved
+#define HIGH_GAIN        0.8698644516f  // K / sqrt(2)
+#define MAD_TO_SIGMA     (1.0f / 0.6745f)  // Gaussian SD from the median absolute coefficient
+
+static float scratch[EEG_WINDOW_MAX_SAMPLES / 2];
+
+/**
+ * @brief Decomposition for windows of @p samples at @p rate_hz
+ * @return FSP_ERR_INVALID_ARGUMENT unless @p samples is a power of two of at least 4
+ * @note Levels go as deep as it takes for the approximation to lie below
+ *       EEG_WAVELET_APPROX_HZ, up to EEG_WAVELET_MAX_LEVELS and while it
+ *       keeps at least two coefficients; noise is estimated on the finest
+ *       level reaching below EEG_WAVELET_NOISE_HZ.
+ */
+fsp_err_t eeg_wavelet_plan(eeg_wavelet_plan_t *plan, uint32_t samples, uint32_t rate_hz)
+{
+    if ((samples < 4U) || (0U != (samples & (samples - 1U))) || (samples > EEG_WINDOW_MAX_SAMPLES) ||
+        (0U == rate_hz)) {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    uint32_t levels = 1;
+    while ((levels < EEG_WAVELET_MAX_LEVELS) && ((samples >> (levels + 1U)) >= 2U) &&
+           ((float) rate_hz / (float) (2U << levels) > EEG_WAVELET_APPROX_HZ)) {
+        levels++;
+    }
+    /* Noise is measured where the conditioning lowpass still passes it */
+    uint32_t noise_level = 0;
+    while ((noise_level + 1U < levels) && ((float) rate_hz / (float) (4U << noise_level) >= EEG_WAVELET_NOISE_HZ)) {
+        noise_level++;
+    }
+    plan->samples = samples;
+    plan->levels = levels;
+    plan->noise_level = noise_level;
+    plan->rate_hz = (float) rate_hz;
+    return FSP_SUCCESS;
+}
+
+/** x[k] += c (x[k - 1] + x[k + 1]) on the odd k of x[0], x[stride], ... (m of them, m even) */
+static void lift_odd(float *x, uint32_t m, uint32_t stride, float c)
+{
+    for (uint32_t k = stride; k + stride < m * stride; k += 2U * stride) {
+        x[k] += c * (x[k - stride] + x[k + stride]);
+    }
+    x[(m - 1U) * stride] += 2.0f * c * x[(m - 2U) * stride];    // Mirrored: x[m] = x[m - 2]
+}
+
+/** Same on the even k */
+static void lift_even(float *x, uint32_t m, uint32_t stride, float c)
+{
+    x[0] += 2.0f * c * x[stride];                                // Mirrored: x[-1] = x[1]
+    for (uint32_t k = 2U * stride; k < m * stride; k += 2U * stride) {
+        x[k] += c * (x[k - stride] + x[k + stride]);
+    }
+}
+
+static void scale(float *x, uint32_t m, uint32_t stride, float low, float high)
+{
+    for (uint32_t k = 0; k < m * stride; k += 2U * stride) {
+        x[k] *= low;
+        x[k + stride] *= high;
+    }
+}
+
+/**
+ * @brief Forward transform of plan->samples values, in place (layout: eeg_wavelet_plan_t)
+ */
+void eeg_wavelet_forward(const eeg_wavelet_plan_t *plan, float *x)
+{
+    for (uint32_t j = 0; j < plan->levels; j++) {
+        const uint32_t stride = 1U << j;
+        const uint32_t m = plan->samples >> j;
+        lift_odd(x, m, stride, LIFT_ALPHA);
+        lift_even(x, m, stride, LIFT_BETA);
+        lift_odd(x, m, stride, LIFT_GAMMA);
+        lift_even(x, m, stride, LIFT_DELTA);
+        scale(x, m, stride, LOW_GAIN, HIGH_GAIN);
+    }
+}
+
+/**
+ * @brief Inverse of eeg_wavelet_forward(), in place
+ */
+void eeg_wavelet_inverse(const eeg_wavelet_plan_t *plan, float *x)
+{
+    for (uint32_t j = plan->levels; j-- > 0U;) {
+        const uint32_t stride = 1U << j;
+        const uint32_t m = plan->samples >> j;
+        scale(x, m, stride, 1.0f / LOW_GAIN, 1.0f / HIGH_GAIN);
+        lift_even(x, m, stride, -LIFT_DELTA);
+        lift_odd(x, m, stride, -LIFT_GAMMA);
+        lift_even(x, m, stride, -LIFT_BETA);
+        lift_odd(x, m, stride, -LIFT_ALPHA);
+    }
+}
+
+/** k-th smallest of v[0..n), reordering v (Wirth's selection, as eegARTIFACT.c) */
+static float select_kth(float *v, int n, int k)
+{
+    int lo = 0;
+    int hi = n - 1;
+
+    while (lo < hi) {
+        float pivot = v[k];
+        int i = lo;
+        int j = hi;
+        do {
+            while (v[i] < pivot) i++;
+            while (pivot < v[j]) j--;
+            if (i <= j) {
+                float t = v[i];
+                v[i++] = v[j];
+                v[j--] = t;
+            }
+        } while (i <= j);
+        if (j < k) lo = i;
+        if (k < i) hi = j;
+    }
+    return v[k];
+}
+
+/**
+ * @brief Decompose one window channel, optionally denoise it, and rebuild it in place
+ * @param energy Receives the sum of squares of each level after thresholding
+ *               (D_1..D_levels, then the approximation)
+ * @return The noise SD the thresholds were set from, μV (0 without @p denoise)
+ */
+float eeg_wavelet_process(const eeg_wavelet_plan_t *plan, float *x, float energy[EEG_WAVELET_MAX_LEVELS + 1],
+                          bool denoise)
+{
+    const uint32_t n = plan->samples;
+    float noise_variance = 0.0f;
+
+    eeg_wavelet_forward(plan, x);
+
+    if (denoise) {
+        const uint32_t stride = 1U << plan->noise_level;
+        uint32_t count = 0;
+        for (uint32_t i = stride; i < n; i += 2U * stride) {
+            scratch[count++] = fabsf(x[i]);
+        }
+        float sigma = MAD_TO_SIGMA * select_kth(scratch, (int) count, (int) count / 2);
+        noise_variance = sigma * sigma;
+    }
+
+    /* Per level: BayesShrink threshold, soft threshold (a no-op at 0) and energy; then the approximation */
+    for (uint32_t j = 0; j < plan->levels; j++) {
+        const uint32_t stride = 1U << j;
+        const uint32_t count = n >> (j + 1U);
+        float sum = 0.0f;
+        float threshold = 0.0f;
+
+        if (denoise) {
+            for (uint32_t i = stride; i < n; i += 2U * stride) {
+                sum += x[i] * x[i];
+            }
+            float signal_variance = sum / (float) count - noise_variance;
+            threshold = (signal_variance > 0.0f) ? noise_variance / sqrtf(signal_variance) : INFINITY;
+            sum = 0.0f;
+        }
+        for (uint32_t i = stride; i < n; i += 2U * stride) {
+            float c = copysignf(fmaxf(fabsf(x[i]) - threshold, 0.0f), x[i]);
+            x[i] = c;
+            sum += c * c;
+        }
+        energy[j] = sum;
+    }
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i += 1U << plan->levels) {
+        sum += x[i] * x[i];
+    }
+    energy[plan->levels] = sum;
+
+    eeg_wavelet_inverse(plan, x);
+    return sqrtf(noise_variance);
+}
+
+/**
+ * @brief Band powers from level energies, on the scale of the DFT band powers
+ * @param band_edges_hz bands x {low, high}
+ * @note Each octave's energy is shared out by the fraction of the octave a
+ *       band overlaps; scaled by 1 / 2N, the one-sided sum of |X_k / N|^2
+ *       the DFT path adds up for the same energy.
+ */
+void eeg_wavelet_band_power(const eeg_wavelet_plan_t *plan, const float energy[EEG_WAVELET_MAX_LEVELS + 1],
+                            const float band_edges_hz[][2], uint32_t bands, float power[])
+{
+    const float scale_to_dft = 1.0f / (2.0f * (float) plan->samples);
+
+    memset(power, 0, bands * sizeof(float));
+    for (uint32_t j = 0; j <= plan->levels; j++) {
+        float high = plan->rate_hz / (float) (2U << j);
+        float low = (j < plan->levels) ? 0.5f * high : 0.0f;     // The approximation reaches down to DC
+        float share = energy[j] * scale_to_dft / (high - low);
+        for (uint32_t b = 0; b < bands; b++) {
+            float overlap = fminf(high, band_edges_hz[b][1]) - fmaxf(low, band_edges_hz[b][0]);
+            power[b] += (overlap > 0.0f) ? share * overlap : 0.0f;
+        }
+    }
+}
@@ -0,0 +1,148 @@
+#include "hal_data.h"
+#include "eegWINDOW.h"
+#include <string.h>
+
+/**
+ * @file eegWINDOW.c
+ * @brief Feature windows handed between tasks by pointer through two mailboxes
+ *
+ * Signal processing fills windows in buffers it took from the free mailbox
+ * and posts each one to the ready mailbox once complete; feature
+ * extraction receives it, reads it in place for as long as it needs and
+ * sends it back to the free mailbox. A buffer is only ever touched by its
+ * current owner, so the two tasks need no lock and never copy a window -
+ * the only kernel calls are one receive when a window opens and one send
+ * when it completes. Overlapping windows are filled side by side instead of
+ * sharing a ring: window / hop writes per sample (two at 50% overlap) buy
+ * windows that stay still while they are read.
+ */
+
+/**
+ * @brief Take ownership of the buffers: drain both mailboxes, then free every window
+ * @return FSP_ERR_NOT_INITIALIZED if the mailboxes do not exist
+ * @note Call once, before either task runs; eeg_window_pool_restart() sets the rate.
+ */
+fsp_err_t eeg_window_pool_init(eeg_window_pool_t *pool, ID ready_mailbox, ID free_mailbox)
+{
+    T_MSG *msg;
+
+    if ((ready_mailbox <= 0) || (free_mailbox <= 0)) {
+        return FSP_ERR_NOT_INITIALIZED;     // initialize_global_semaphores() has not run
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    pool->ready_mailbox = ready_mailbox;
+    pool->free_mailbox = free_mailbox;
+    while (E_OK == tk_rcv_mbx(ready_mailbox, &msg, TMO_POL)) {}
+    while (E_OK == tk_rcv_mbx(free_mailbox, &msg, TMO_POL)) {}
+    for (int w = 0; w < EEG_WINDOW_POOL_DEPTH; w++) {
+        if (E_OK != tk_snd_mbx(free_mailbox, &pool->windows[w].message)) {
+            return FSP_ERR_NOT_INITIALIZED;
+        }
+    }
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Start over at a new rate: windows being filled go back to the free mailbox
+ * @return FSP_ERR_INVALID_ARGUMENT if the window does not fit EEG_WINDOW_MAX_SAMPLES
+ * @note Windows already posted or held by the consumer keep their old rate
+ *       in eeg_window_t.rate; the consumer decides what to do with them.
+ */
+fsp_err_t eeg_window_pool_restart(eeg_window_pool_t *pool, const eeg_rate_t *rate)
+{
+    if ((0U == rate->window_samples) || (rate->window_samples > EEG_WINDOW_MAX_SAMPLES) ||
+        (0U == rate->hop_samples) || (rate->hop_samples > rate->window_samples)) {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    for (uint32_t k = 0; k < pool->open_count; k++) {
+        (void) tk_snd_mbx(pool->free_mailbox, &pool->open[k]->message);
+    }
+    pool->open_count = 0;
+    pool->rate = *rate;
+    pool->until_open = 0;
+    pool->sequence = 0;
+    pool->completed = 0;
+    return FSP_SUCCESS;
+}
+
+/**
+ * @brief Append one window-rate sample of every channel
+ * @param mask Flags the sample starts with in each window's mask (0 = nothing known yet)
+ * @return The window this sample completed (the first after window_samples
+ *         samples, then one every hop), still the caller's until
+ *         eeg_window_post(); NULL otherwise
+ */
+eeg_window_t *eeg_window_push(eeg_window_pool_t *pool, const float sample[EEG_CHANNELS],
+                              const uint8_t mask[EEG_CHANNELS])
+{
+    if (0U == pool->until_open) {
+        T_MSG *msg;
+        pool->until_open = pool->rate.hop_samples;
+        pool->sequence++;
+        if ((pool->open_count < EEG_WINDOW_POOL_DEPTH) &&
+            (E_OK == tk_rcv_mbx(pool->free_mailbox, &msg, TMO_POL))) {
+            eeg_window_t *window = (eeg_window_t *) msg;
+            window->rate = pool->rate;
+            window->sequence = pool->sequence;
+            window->fill = 0;
+            pool->open[pool->open_count++] = window;
+        } else {
+            pool->skipped++;
+        }
+    }
+    pool->until_open--;
+
+    for (uint32_t k = 0; k < pool->open_count; k++) {
+        eeg_window_t *window = pool->open[k];
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            window->channel[ch][window->fill] = sample[ch];
+            window->mask[ch][window->fill] = mask[ch];
+        }
+        window->fill++;
+    }
+
+    /* Windows open in order, so only the oldest can have just filled */
+    if ((0U == pool->open_count) || (pool->open[0]->fill < pool->rate.window_samples)) {
+        return NULL;
+    }
+    eeg_window_t *done = pool->open[0];
+    pool->open_count--;
+    memmove(&pool->open[0], &pool->open[1], pool->open_count * sizeof(pool->open[0]));
+    return done;
+}
+
+/**
+ * @brief Hand a window from eeg_window_push() to the consumer (ready mailbox)
+ */
+void eeg_window_post(eeg_window_pool_t *pool, eeg_window_t *window)
+{
+    pool->completed++;
+    (void) tk_snd_mbx(pool->ready_mailbox, &window->message);
+}
+
+/**
+ * @brief Take the oldest completed window
+ * @param tmout TMO_POL, TMO_FEVR or a timeout in ms
+ * @return The window, owned by the caller until eeg_window_release(); NULL on timeout
+ */
+eeg_window_t *eeg_window_receive(eeg_window_pool_t *pool, INT tmout)
+{
+    T_MSG *msg;
+
+    if (E_OK != tk_rcv_mbx(pool->ready_mailbox, &msg, tmout)) {
+        return NULL;
+    }
+    return (eeg_window_t *) msg;
+}
+
+/**
+ * @brief Give a received window back for refilling
+ */
+void eeg_window_release(eeg_window_pool_t *pool, eeg_window_t *window)
+{
+    if (window) {
+        (void) tk_snd_mbx(pool->free_mailbox, &window->message);
+    }
+}
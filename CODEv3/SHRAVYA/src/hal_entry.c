@@ -59,6 +59,7 @@ extern void task_classification_entry(INT stacd, void *exinf);
 extern void task_haptic_feedback_entry(INT stacd, void *exinf);
 extern void task_communication_entry(INT stacd, void *exinf);
 extern void task_shravya_main_entry(INT stacd, void *exinf);
+extern void task_eeg_recorder_entry(INT stacd, void *exinf);
 
 /* ✅ EXTERNAL HARDWARE FUNCTION DECLARATIONS */
 extern fsp_err_t eeg_acquisition_init(void);
@@ -68,6 +69,7 @@ extern fsp_err_t power_management_init(void);
 
 /* ✅ EXTERNAL DRDY CALLBACK - ALREADY EXISTS IN eegACQUISITION.c */
 extern void ads1263_drdy_callback(external_irq_callback_args_t *p_args);
+extern void ads1263_spi_transfer_callback(spi_callback_args_t *p_args);
 
 /* μT-Kernel Function Prototypes */
 extern ER tk_ini_ker(void);
@@ -84,10 +86,8 @@ extern ER tk_sig_sem(ID semid, INT cnt);
  */
 void spi_callback(spi_callback_args_t *p_args)
 {
-    (void)p_args;
-
-    /* SPI transaction complete - can be used for non-blocking SPI operations */
-    /* For SHRAVYA EEG system, this could signal completion of ADS1263 communication */
+    /* Chain the next ADS1263 RDATA frame / complete the DTC block */
+    ads1263_spi_transfer_callback(p_args);
 
     switch (p_args->event) {
         case SPI_EVENT_TRANSFER_COMPLETE:
@@ -388,7 +388,18 @@ static ER create_shravya_tasks(void)
     ercd = tk_sta_tsk(task_id, 0);
     if (ercd != E_OK) return ercd;
 
-    printf("SHRAVYA: All 7 tasks created and started successfully\r\n");
+    /* ✅ Task 8: Raw Recorder Writer Task */
+    ctsk.task = (void*)task_eeg_recorder_entry;
+    ctsk.itskpri = TASK_PRIORITY_RECORDER;
+    ctsk.stksz = 1024;
+
+    task_id = tk_cre_tsk(&ctsk);
+    if (task_id <= 0) return E_SYS;
+
+    ercd = tk_sta_tsk(task_id, 0);
+    if (ercd != E_OK) return ercd;
+
+    printf("SHRAVYA: All 8 tasks created and started successfully\r\n");
     return E_OK;
 }
 
@@ -92,11 +92,17 @@ typedef struct {
     uint32_t iflgptn;
 } T_CFLG;
 
+typedef struct {
+    void *exinf;
+    uint32_t mbxatr;
+} T_CMBX;
+
 /* ✅ SYSTEM MANAGEMENT */
 #define MAX_SHRAVYA_TASKS 8
 #define MAX_SEMAPHORES 16
 #define MAX_MUTEXES 8
 #define MAX_EVENTFLAGS 8
+#define MAX_MAILBOXES 4
 #define TASK_STACK_SIZE 4096
 
 /* Task Control Block */
@@ -131,6 +137,13 @@ typedef struct {
     uint32_t pattern;
 } mtk3_eventflag_t;
 
+/* Mailbox Control Block - FIFO of messages linked through T_MSG.msgque[0] */
+typedef struct {
+    bool active;
+    T_MSG *head;
+    T_MSG *tail;
+} mtk3_mailbox_t;
+
 /* ✅ GLOBAL KERNEL STATE */
 static bool kernel_initialized = false;
 static bool scheduler_running = false;
@@ -143,6 +156,7 @@ static uint32_t task_stacks[MAX_SHRAVYA_TASKS][TASK_STACK_SIZE / 4];
 static mtk3_semaphore_t semaphore_table[MAX_SEMAPHORES];
 static mtk3_mutex_t mutex_table[MAX_MUTEXES];
 static mtk3_eventflag_t eventflag_table[MAX_EVENTFLAGS];
+static mtk3_mailbox_t mailbox_table[MAX_MAILBOXES];
 
 /* ✅ WORKING DEBUG OUTPUT - Uses semi-hosting printf */
 static void debug_output(const char *msg)
@@ -195,6 +209,7 @@ ER tk_ini_ker(void)
     memset(semaphore_table, 0, sizeof(semaphore_table));
     memset(mutex_table, 0, sizeof(mutex_table));
     memset(eventflag_table, 0, sizeof(eventflag_table));
+    memset(mailbox_table, 0, sizeof(mailbox_table));
 
     /* Initialize system timer */
     mtk3_systick_init();
@@ -428,6 +443,89 @@ ER tk_sig_sem(ID semid)
     return E_LIMIT;
 }
 
+/* ✅ MAILBOX FUNCTIONS */
+
+/**
+ * @brief Create Mailbox
+ */
+ID tk_cre_mbx(T_CMBX *pk_cmbx)
+{
+    if (!pk_cmbx) return E_PAR;
+
+    for (int i = 0; i < MAX_MAILBOXES; i++) {
+        if (!mailbox_table[i].active) {
+            mailbox_table[i].active = true;
+            mailbox_table[i].head = NULL;
+            mailbox_table[i].tail = NULL;
+
+            printf("SHRAVYA: Mailbox %d created\r\n", i + 1);
+            return i + 1;
+        }
+    }
+
+    return E_LIMIT;
+}
+
+/**
+ * @brief Send to Mailbox - queues the message itself, nothing is copied
+ */
+ER tk_snd_mbx(ID mbxid, T_MSG *pk_msg)
+{
+    if (mbxid <= 0 || mbxid > MAX_MAILBOXES) {
+        return E_NOEXS;
+    }
+
+    int mbx_idx = mbxid - 1;
+    if (!mailbox_table[mbx_idx].active) {
+        return E_NOEXS;
+    }
+    if (!pk_msg) return E_PAR;
+
+    pk_msg->msgque[0] = NULL;
+    if (mailbox_table[mbx_idx].tail) {
+        mailbox_table[mbx_idx].tail->msgque[0] = pk_msg;
+    } else {
+        mailbox_table[mbx_idx].head = pk_msg;
+    }
+    mailbox_table[mbx_idx].tail = pk_msg;
+    return E_OK;
+}
+
+/**
+ * @brief Receive from Mailbox - oldest message first
+ * @param tmout TMO_POL to poll, otherwise waits like tk_wai_sem()
+ */
+ER tk_rcv_mbx(ID mbxid, T_MSG **ppk_msg, INT tmout)
+{
+    if (mbxid <= 0 || mbxid > MAX_MAILBOXES) {
+        return E_NOEXS;
+    }
+
+    int mbx_idx = mbxid - 1;
+    if (!mailbox_table[mbx_idx].active) {
+        return E_NOEXS;
+    }
+    if (!ppk_msg) return E_PAR;
+
+    volatile int wait_loops = 0;
+    const int MAX_WAIT_LOOPS = (TMO_POL == tmout) ? 1 : 10000;
+
+    while (wait_loops < MAX_WAIT_LOOPS) {
+        T_MSG *msg = mailbox_table[mbx_idx].head;
+        if (msg) {
+            mailbox_table[mbx_idx].head = (T_MSG *) msg->msgque[0];
+            if (!mailbox_table[mbx_idx].head) mailbox_table[mbx_idx].tail = NULL;
+            *ppk_msg = msg;
+            return E_OK;
+        }
+
+        for (volatile int i = 0; i < 100; i++); /* Brief busy wait */
+        wait_loops++;
+    }
+
+    return E_TMOUT;
+}
+
 /* ✅ MUTEX FUNCTIONS */
 
 /**
@@ -42,6 +42,10 @@ typedef int ID;
 #define TA_WMUL (0x00000002U)
 #endif
 
+#ifndef TA_MFIFO
+#define TA_MFIFO (0x00000000U)
+#endif
+
 /* ✅ μT-Kernel 3.0 Structure Types */
 typedef struct {
     uint32_t sematr;    // Semaphore attributes
@@ -49,9 +53,15 @@ typedef struct {
     int maxsem;         // Maximum semaphore count
 } T_CSEM;
 
+typedef struct {
+    void *exinf;        // Extended information
+    uint32_t mbxatr;    // Mailbox attributes
+} T_CMBX;
+
 /* ✅ μT-Kernel 3.0 Function Prototypes */
 extern ID tk_cre_sem(T_CSEM *pk_csem);
-ID processed_semaphore = 0;/* ✅ Global semaphore definitions - PRESERVED FOR TRON CONTEST */
+extern ID tk_cre_mbx(T_CMBX *pk_cmbx);
+/* ✅ Global semaphore definitions - PRESERVED FOR TRON CONTEST */
 ID eeg_data_semaphore = 0;
 ID preprocessing_semaphore = 0;
 ID feature_extraction_semaphore = 0;
@@ -61,6 +71,9 @@ ID communication_semaphore = 0;
 ID features_ready_semaphore = 0;
 ID classification_ready_semaphore = 0;
 ID feedback_ready_semaphore = 0;
+ID recorder_semaphore = 0;
+ID window_ready_mailbox = 0;
+ID window_free_mailbox = 0;
 /**
  * @brief Initialize all global semaphores for REAL hardware operation
  * ✅ TRON Programming Contest 2025 Compliant
@@ -95,17 +108,7 @@ ER initialize_global_semaphores(void)
         return E_SYS;
     }
     printf("SHRAVYA: Semaphore 2 created (Signal Processing)\r\n");
-    /* Used for producer-consumer handoff between acquisition and processing */
-    csem.sematr = TA_TFIFO | TA_WMUL;
-    csem.isemcnt = 0;   // Start with 1 - allows first acquisition cycle
-    csem.maxsem = 1;    // Binary semaphore (0 or 1 only)
 
-    processed_semaphore = tk_cre_sem(&csem);
-    //tk_sig_sem(processed_semaphore, 1);
-    if (processed_semaphore <= 0) {
-        printf("SHRAVYA: Processed handoff semaphore creation failed\r\n");
-        return E_SYS;
-    }
     /* ✅ Feature Extraction Semaphore - Triggered by signal processing */
     csem.sematr = TA_TFIFO | TA_WMUL;
     csem.isemcnt = 0;   // Start with 0
@@ -187,7 +190,30 @@ ER initialize_global_semaphores(void)
     }
     printf("SHRAVYA: Semaphore 10 created (Feedback Ready)\r\n");
 
-    printf("SHRAVYA: All 10 semaphores created for real hardware operation\r\n");
+    /* Recorder Semaphore - one count per block buffer queued for the writer */
+    csem.sematr = TA_TFIFO | TA_WMUL;
+    csem.isemcnt = 0;
+    csem.maxsem = 2;    // Double-buffered
+    recorder_semaphore = tk_cre_sem(&csem);
+    if (recorder_semaphore <= 0) {
+        printf("SHRAVYA: Recorder semaphore creation failed\r\n");
+        return E_SYS;
+    }
+    printf("SHRAVYA: Semaphore 11 created (Recorder Writer)\r\n");
+
+    /* Window Mailboxes - filled feature windows one way, empty ones back (FIFO: oldest window first) */
+    T_CMBX cmbx;
+    cmbx.exinf = NULL;
+    cmbx.mbxatr = TA_TFIFO | TA_MFIFO;
+    window_ready_mailbox = tk_cre_mbx(&cmbx);
+    window_free_mailbox = tk_cre_mbx(&cmbx);
+    if ((window_ready_mailbox <= 0) || (window_free_mailbox <= 0)) {
+        printf("SHRAVYA: Window mailbox creation failed\r\n");
+        return E_SYS;
+    }
+    printf("SHRAVYA: Mailboxes 1-2 created (Feature Windows)\r\n");
+
+    printf("SHRAVYA: All 11 semaphores and 2 mailboxes created for real hardware operation\r\n");
 
     return E_OK;
 }
@@ -204,4 +230,5 @@ void print_semaphore_status(void)
     printf("  - Classification: ID=%d\r\n", (int)classification_semaphore);
     printf("  - Haptic Feedback: ID=%d\r\n", (int)haptic_semaphore);
     printf("  - Communication: ID=%d\r\n", (int)communication_semaphore);
+    printf("  - Window Ready/Free: ID=%d/%d\r\n", (int)window_ready_mailbox, (int)window_free_mailbox);
 }
@@ -2,11 +2,21 @@
 #include "eegTYPES.h"
 #include "shravyaCONFIG.h"
 #include "signalPROCESSING.h"
+#include "eegRATE.h"
+#include "eegBIQUAD.h"
+#include "eegFILTERTABLES.h"
+#include "eegMAINS.h"
+#include "eegDECIMATE.h"
+#include "eegWINDOW.h"
+#include "eegARTIFACT.h"
+#include "eegWAVELET.h"
+#include "eegMEDIAN.h"
+#include "ads1263HAL.h"
 #include "semaphoresGLOBAL.h"
 #include "cognitiveSTATES.h"
 #include "communicationN8N.h"
 //#include "mtk3_bsp2/include/tk/tkernel.h"
-#include <math.h>     // For sinf(), cosf(), fabsf(), sqrtf()
+#include <math.h>     // For fabsf(), sqrtf()
 #include <string.h>   // For memset(), memmove()
 
 #include <stdio.h>    // For printf()
@@ -48,34 +58,21 @@ extern ID preprocessing_semaphore;
 extern feature_vector_t current_features;  // ✅ This is the missing variable!
 
 // ✅ External function declarations from cognitive classifier
-extern void extract_frequency_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_time_domain_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_coherence_features(const float *left_signal, const float *right_signal, int size);
-extern void extract_quality_features(const float *left_signal, const float *right_signal, int size);
-
-
-/* DSP Constants */
-#define PI                          3.14159265358979323846f
-#define TWOPI                       6.28318530717958647692f
-#define SQRT2                       1.41421356237309504880f
-
-/* Filter Parameters */
-#define NOTCH_FREQ_50HZ             50.0f
-#define NOTCH_FREQ_60HZ             60.0f
-#define NOTCH_BANDWIDTH             2.0f
-#define BANDPASS_LOW_CUTOFF         0.5f    // EEG lower bound
-#define BANDPASS_HIGH_CUTOFF        45.0f   // EEG upper bound
-#define FILTER_ORDER                4       // 4th order filters
-
-/* Artifact Detection Thresholds */
-#define AMPLITUDE_THRESHOLD_UV      150.0f  // ±150μV amplitude limit
-#define GRADIENT_THRESHOLD          50.0f   // Max gradient between samples
+extern void extract_frequency_features(const float *const channels[], int channel_count, int size);
+extern void extract_wavelet_band_features(const float energy[][EEG_WAVELET_MAX_LEVELS + 1], int channel_count,
+                                          int levels);
+extern void extract_time_domain_features(const float *const channels[], int channel_count, int size);
+extern void extract_coherence_features(const float *const channels[], int channel_count, int size);
+extern void extract_quality_features(const float *const channels[], int channel_count, int size,
+                                     const float artifact_ratio[]);
+
+
+/* Artifact Detection Thresholds - per window in eegARTIFACT.c (EEG_ARTIFACT_* in shravyaCONFIG.h) */
 #define SATURATION_THRESHOLD        0x7F0000 // 24-bit ADC near saturation
 #define BASELINE_DRIFT_THRESHOLD    20.0f   // Baseline drift limit
+#define ARTIFACT_PERIOD_S           5       // Seconds per artifact history slot
 
-/* Processing Window Sizes */
-#define PROCESSING_WINDOW_SIZE      256     // 512ms at 500Hz (power of 2)
-#define OVERLAP_SIZE               128     // 50% overlap
+/* Processing Window - length and hop come from the rate descriptor (eeg_rate_t) */
 #define ARTIFACT_HISTORY_SIZE      10      // Track last 10 windows
 // ✅ Add these defines at the top of signalPROCESSING.c
 #define OUTPUT_LAYER_SIZE 6
@@ -89,34 +86,27 @@ extern void extract_quality_features(const float *left_signal, const float *righ
 #define COGNITIVE_STATE_EXCITED 5
 
 
-/* IIR Filter Structure (Biquad sections) */
-typedef struct {
-    float b0, b1, b2;  // Numerator coefficients
-    float a1, a2;      // Denominator coefficients (a0 = 1.0)
-    float x1, x2;      // Input history
-    float y1, y2;      // Output history
-} biquad_filter_t;
-
-/* Complete Filter Bank */
-typedef struct {
-    biquad_filter_t notch_50hz[2];      // 50Hz notch (2 cascaded biquads)
-    biquad_filter_t notch_60hz[2];      // 60Hz notch (2 cascaded biquads)
-    biquad_filter_t highpass[2];        // 0.5Hz highpass (2 cascaded biquads)
-    biquad_filter_t lowpass[2];         // 45Hz lowpass (2 cascaded biquads)
-} eeg_filter_bank_t;
-
-/* Signal Processing State */
+/* Signal Processing State - one filter bank, baseline and window per montage channel */
 typedef struct {
-    eeg_filter_bank_t left_filters;
-    eeg_filter_bank_t right_filters;
-    float processing_buffer_left[PROCESSING_WINDOW_SIZE];
-    float processing_buffer_right[PROCESSING_WINDOW_SIZE];
-    uint32_t buffer_index;
-    bool buffer_ready;
-    uint32_t artifact_count[ARTIFACT_HISTORY_SIZE];
+    eeg_rate_t rate;                    // Rate the filters/window are designed for
+#if EEG_FILTER_Q31
+    eeg_biquad_q31_t filters[EEG_CHANNELS];
+    uint8_t q31_shift[EEG_CHANNELS];    // Ring count -> Q31 full scale (ADC2 24-bit codes move up 8 bits)
+#else
+    eeg_biquad_lanes_t filters[EEG_FILTER_GROUPS];  // Channel ch is lane ch % EEG_FILTER_LANES of group ch / EEG_FILTER_LANES
+#endif
+    float count_uv[EEG_CHANNELS];       // μV per ring count of each channel's ADC
+    uint32_t mains_hz;                  // 0 while the detector listens (band-stop at EEG_MAINS_HZ), then the canceller's
+    eeg_mains_detector_t mains_detector;
+    eeg_mains_canceller_t mains_canceller;
+    eeg_decimator_t decimator;          // Conditioned samples -> window rate (rate.decimation)
+    eeg_window_pool_t windows;          // Feature windows over the window-rate samples, handed out by mailbox
+    eeg_artifact_detector_t artifacts;  // Flags and repairs each window before it is posted
+    eeg_wavelet_plan_t wavelet;         // Decomposition of each window, levels = 0 without one
+    uint32_t artifact_count[ARTIFACT_HISTORY_SIZE];     // Flagged window samples per ARTIFACT_PERIOD_S slot
     uint32_t artifact_index;
-    float baseline_left;
-    float baseline_right;
+    uint32_t artifact_rotate_at;        // samples_processed at which the next slot starts
+    eeg_median_tracker_t baseline[EEG_CHANNELS];    // Running median of each filtered channel, taken off it
     uint32_t samples_processed;
 } signal_processing_state_t;
 
@@ -130,17 +120,20 @@ extern ID preprocessing_semaphore;
 extern ID feature_extraction_semaphore;
 
 /* Private Function Prototypes */
-static void init_biquad_filter(biquad_filter_t *filter, float b0, float b1, float b2, float a1, float a2);
-static void design_notch_filter(biquad_filter_t filters[2], float freq_hz, float sample_rate_hz, float bandwidth);
-static void design_highpass_filter(biquad_filter_t filters[2], float cutoff_hz, float sample_rate_hz);
-static void design_lowpass_filter(biquad_filter_t filters[2], float cutoff_hz, float sample_rate_hz);
-static float process_biquad_cascade(biquad_filter_t filters[2], float input);
-static void init_filter_bank(eeg_filter_bank_t *bank);
-static float convert_adc_to_voltage(int32_t adc_value);
-static bool detect_artifacts(float left_sample, float right_sample, float prev_left, float prev_right);
-static void update_baseline(float left_sample, float right_sample);
-static void apply_signal_conditioning(float *left_sample, float *right_sample);
+static fsp_err_t load_filters(uint32_t sample_rate_hz);
+static void start_mains_canceller(uint32_t mains_hz);
+static float convert_adc_to_voltage(int ch, int32_t adc_value);
+static void apply_signal_conditioning(float samples[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES], uint32_t count);
+static uint32_t process_ring_samples(uint32_t max_samples, float last[EEG_CHANNELS]);
+static uint32_t drain_ring_samples(float last[EEG_CHANNELS]);
+static void rotate_artifact_history(void);
+static bool push_window_sample(const float sample[EEG_CHANNELS], uint32_t excluded);
+static void process_eeg_block(const int32_t *const counts[EEG_CHANNELS], uint32_t count,
+                              float filtered[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES]);
 void task_signal_processing_entry(INT stacd, void *exinf);
+void extract_eeg_features_direct(void);
+void classify_cognitive_state_direct(void);
+void send_to_n8n_direct(cognitive_classification_t classification_result);
 
 extern ER tk_sus_tsk(ID tskid);
 extern ER tk_rsm_tsk(ID tskid);
@@ -162,20 +155,36 @@ extern fsp_err_t send_to_n8n_webhook(const char *json_data);
  */
 fsp_err_t signal_processing_init(void)
 {
-    /* Clear processing state */
+    /* Clear processing state (filter histories, baselines, windows) */
     memset(&processing_state, 0, sizeof(processing_state));
 
-    /* Initialize filter banks for both channels */
-    init_filter_bank(&processing_state.left_filters);
-    init_filter_bank(&processing_state.right_filters);
+    /* Every window buffer starts in the free mailbox */
+    fsp_err_t err = eeg_window_pool_init(&processing_state.windows, window_ready_mailbox, window_free_mailbox);
+    if (FSP_SUCCESS != err) {
+        printf("SHRAVYA: ❌ Window mailboxes not available\r\n");
+        return err;
+    }
 
-    /* Initialize baseline estimates */
-    processing_state.baseline_left = 0.0f;
-    processing_state.baseline_right = 0.0f;
-    processing_state.buffer_index = 0;
-    processing_state.buffer_ready = false;
     processing_state.artifact_index = 0;
     processing_state.samples_processed = 0;
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        processing_state.count_uv[ch] = ads1263_montage_count_uv((uint32_t) ch);
+    }
+#if EEG_FILTER_Q31
+    const ads1263_route_t *routes = ads1263_montage_routes();
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        eeg_biquad_q31_init(&processing_state.filters[ch]);
+        processing_state.q31_shift[ch] = (2U == routes[ch].adc) ? 8U : 0U;
+    }
+#else
+    for (int g = 0; g < EEG_FILTER_GROUPS; g++) {
+        eeg_biquad_lanes_init(&processing_state.filters[g], EEG_FILTER_STAGES, EEG_FILTER_LANES);
+    }
+#endif
+
+    /* Filters, window and thresholds for the rate the ADS1263s run at */
+    signal_processing_set_rate(eeg_rate_get());
+    processing_state.artifact_rotate_at = ARTIFACT_PERIOD_S * processing_state.rate.sample_rate_hz;
 
     processing_initialized = true;
 
@@ -183,234 +192,292 @@ fsp_err_t signal_processing_init(void)
 }
 
 /**
- * @brief Initialize complete filter bank
+ * @brief Reconfigure the chain for a new sample rate
+ * @param rate Descriptor of the samples that follow
+ * @note Called between two samples, with the first sample at the new rate next
+ *       (process_ring_samples() does this at the ring index the acquisition
+ *       task switched at). Coefficients are swapped in place, so filter
+ *       histories carry over; the decimator and the windows being filled restart
+ *       empty at their new factor and length so no window mixes rates. A rate without a coefficient table
+ *       leaves the chain at the old rate. Mains detection restarts, or the
+ *       canceller re-adapts from zero weights at the new rate.
  */
-static void init_filter_bank(eeg_filter_bank_t *bank)
+fsp_err_t signal_processing_set_rate(const eeg_rate_t *rate)
 {
-    /* Design 50Hz notch filter (2nd order, cascaded for 4th order) */
-    design_notch_filter(bank->notch_50hz, NOTCH_FREQ_50HZ, EEG_SAMPLE_RATE_HZ, NOTCH_BANDWIDTH);
+    if (!rate || (0U == rate->sample_rate_hz) || (rate->window_samples > EEG_WINDOW_MAX_SAMPLES) ||
+        (0U == rate->hop_samples) || (rate->hop_samples > rate->window_samples) ||
+        (0U == rate->decimation) || (rate->decimation > EEG_DECIMATE_MAX_FACTOR)) {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
 
-    /* Design 60Hz notch filter (2nd order, cascaded for 4th order) */
-    design_notch_filter(bank->notch_60hz, NOTCH_FREQ_60HZ, EEG_SAMPLE_RATE_HZ, NOTCH_BANDWIDTH);
+    fsp_err_t err = load_filters(rate->sample_rate_hz);
+    if (FSP_SUCCESS != err) {
+        return err;
+    }
 
-    /* Design highpass filter for DC blocking (0.5Hz cutoff) */
-    design_highpass_filter(bank->highpass, BANDPASS_LOW_CUTOFF, EEG_SAMPLE_RATE_HZ);
+    processing_state.rate = *rate;
 
-    /* Design lowpass filter for anti-aliasing (45Hz cutoff) */
-    design_lowpass_filter(bank->lowpass, BANDPASS_HIGH_CUTOFF, EEG_SAMPLE_RATE_HZ);
+    /* Baseline median over EEG_BASELINE_WINDOW_S, taking about EEG_BASELINE_UPDATE_HZ samples a second */
+    uint32_t baseline_decimation = rate->sample_rate_hz / EEG_BASELINE_UPDATE_HZ;
+    if (0U == baseline_decimation) baseline_decimation = 1U;
+    uint32_t baseline_window = (uint32_t) (EEG_BASELINE_WINDOW_S * (float) rate->sample_rate_hz /
+                                           (float) baseline_decimation + 0.5f);
+    if (baseline_window > EEG_MEDIAN_MAX_WINDOW) baseline_window = EEG_MEDIAN_MAX_WINDOW;
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        (void) eeg_median_init(&processing_state.baseline[ch], baseline_window, 0.5f, baseline_decimation);
+    }
+
+    /* Detection restarts at the new rate; a canceller follows its references there */
+    if (0U == processing_state.mains_hz) {
+        eeg_mains_detector_init(&processing_state.mains_detector, rate->sample_rate_hz);
+    } else {
+        eeg_mains_canceller_init(&processing_state.mains_canceller, processing_state.mains_hz, rate->sample_rate_hz);
+    }
+
+    eeg_decimator_init(&processing_state.decimator, rate->decimation);
+    (void) eeg_window_pool_restart(&processing_state.windows, rate);
+    eeg_artifact_init(&processing_state.artifacts, rate);
+    if (FSP_SUCCESS != eeg_wavelet_plan(&processing_state.wavelet, rate->window_samples, rate->window_rate_hz)) {
+        processing_state.wavelet.levels = 0;
+    }
+
+    return FSP_SUCCESS;
 }
 
 /**
- * @brief Design notch filter using biquad sections
+ * @brief Rate the chain is currently configured for
  */
-static void design_notch_filter(biquad_filter_t filters[2], float freq_hz, float sample_rate_hz, float bandwidth)
+const eeg_rate_t *signal_processing_get_rate(void)
 {
-    float omega = TWOPI * freq_hz / sample_rate_hz;
-    float alpha = sinf(omega) * sinhf(logf(2.0f) / 2.0f * bandwidth * omega / sinf(omega));
-    float cos_omega = cosf(omega);
-
-    /* Notch filter coefficients */
-    float b0 = 1.0f;
-    float b1 = -2.0f * cos_omega;
-    float b2 = 1.0f;
-    float a0 = 1.0f + alpha;
-    float a1 = -2.0f * cos_omega;
-    float a2 = 1.0f - alpha;
-
-    /* Normalize coefficients */
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
-
-    /* Initialize first biquad */
-    init_biquad_filter(&filters[0], b0, b1, b2, a1, a2);
-
-    /* Second biquad identical for steeper rolloff */
-    init_biquad_filter(&filters[1], b0, b1, b2, a1, a2);
+    return &processing_state.rate;
 }
 
 /**
- * @brief Design highpass filter using biquad sections
+ * @brief Mains frequency the canceller runs at, 0 while it is still being detected
  */
-static void design_highpass_filter(biquad_filter_t filters[2], float cutoff_hz, float sample_rate_hz)
+uint32_t signal_processing_get_mains(void)
 {
-    float omega = TWOPI * cutoff_hz / sample_rate_hz;
-    float alpha = sinf(omega) / SQRT2; // Q = 0.707 for Butterworth
-    float cos_omega = cosf(omega);
-
-    /* Highpass filter coefficients */
-    float b0 = (1.0f + cos_omega) / 2.0f;
-    float b1 = -(1.0f + cos_omega);
-    float b2 = (1.0f + cos_omega) / 2.0f;
-    float a0 = 1.0f + alpha;
-    float a1 = -2.0f * cos_omega;
-    float a2 = 1.0f - alpha;
-
-    /* Normalize coefficients */
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
-
-    /* Initialize cascaded biquads */
-    init_biquad_filter(&filters[0], b0, b1, b2, a1, a2);
-    init_biquad_filter(&filters[1], b0, b1, b2, a1, a2);
+    return processing_state.mains_hz;
 }
 
 /**
- * @brief Design lowpass filter using biquad sections
+ * @brief Load the cascade for @p sample_rate_hz into every channel's filter
+ * @note With the band-stop while mains is being detected, without it once
+ *       the canceller runs; the band-stop sections come last, so dropping
+ *       them leaves the highpass/lowpass histories in place.
  */
-static void design_lowpass_filter(biquad_filter_t filters[2], float cutoff_hz, float sample_rate_hz)
+static fsp_err_t load_filters(uint32_t sample_rate_hz)
 {
-    float omega = TWOPI * cutoff_hz / sample_rate_hz;
-    float alpha = sinf(omega) / SQRT2; // Q = 0.707 for Butterworth
-    float cos_omega = cosf(omega);
-
-    /* Lowpass filter coefficients */
-    float b0 = (1.0f - cos_omega) / 2.0f;
-    float b1 = 1.0f - cos_omega;
-    float b2 = (1.0f - cos_omega) / 2.0f;
-    float a0 = 1.0f + alpha;
-    float a1 = -2.0f * cos_omega;
-    float a2 = 1.0f - alpha;
-
-    /* Normalize coefficients */
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
-
-    /* Initialize cascaded biquads */
-    init_biquad_filter(&filters[0], b0, b1, b2, a1, a2);
-    init_biquad_filter(&filters[1], b0, b1, b2, a1, a2);
+    eeg_biquad_cascade_t design;
+    eeg_biquad_init(&design, EEG_FILTER_STAGES);
+    fsp_err_t err = signal_processing_design_filters(&design, sample_rate_hz, processing_state.mains_hz ? 0U : EEG_MAINS_HZ);
+    if (FSP_SUCCESS != err) {
+        printf("SHRAVYA: ❌ No conditioning filter table for %lu SPS / %u Hz mains\n",
+               (unsigned long) sample_rate_hz, (unsigned) EEG_MAINS_HZ);
+        return err;
+    }
+
+#if EEG_FILTER_Q31
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        /* Q31 full scale in μV: the last section scales straight to μV */
+        float full_scale_uv = processing_state.count_uv[ch] * (float) (1UL << (31U - processing_state.q31_shift[ch]));
+        eeg_biquad_q31_load(&processing_state.filters[ch], &design, full_scale_uv);
+    }
+#else
+    for (int g = 0; g < EEG_FILTER_GROUPS; g++) {
+        eeg_biquad_lanes_load(&processing_state.filters[g], &design);
+    }
+#endif
+    return FSP_SUCCESS;
 }
 
 /**
- * @brief Initialize biquad filter structure
+ * @brief Hand mains over from the band-stop to the canceller at @p mains_hz
+ * @note Called mid-block by the detector; the whole block is then filtered
+ *       without the band-stop, and the canceller adapts from zero weights.
  */
-static void init_biquad_filter(biquad_filter_t *filter, float b0, float b1, float b2, float a1, float a2)
+static void start_mains_canceller(uint32_t mains_hz)
 {
-    filter->b0 = b0;
-    filter->b1 = b1;
-    filter->b2 = b2;
-    filter->a1 = a1;
-    filter->a2 = a2;
-    filter->x1 = 0.0f;
-    filter->x2 = 0.0f;
-    filter->y1 = 0.0f;
-    filter->y2 = 0.0f;
+    processing_state.mains_hz = mains_hz;
+    (void) load_filters(processing_state.rate.sample_rate_hz);
+    eeg_mains_canceller_init(&processing_state.mains_canceller, mains_hz, processing_state.rate.sample_rate_hz);
+
+    printf("SHRAVYA: ⚡ Mains %lu Hz - adaptive canceller on %lu harmonic(s), band-stop dropped\n",
+           (unsigned long) mains_hz, (unsigned long) processing_state.mains_canceller.harmonics);
 }
 
 /**
- * @brief Process input through cascaded biquad filters
+ * @brief Conditioning cascade (highpass, lowpass, mains band-stop) for one sample rate
+ * @param cascade Initialised with eeg_biquad_init(cascade, EEG_FILTER_STAGES); state is left untouched
+ * @param mains_hz Band-stop frequency (50 or 60), or 0 for highpass and lowpass only
+ * @return FSP_ERR_UNSUPPORTED if eegFILTERTABLES.c has no cascade for this rate and mains frequency
+ * @note Coefficients are designed offline (host/shravyaFILTERS.c); this only
+ *       selects them. The same coefficients every channel runs - also used by
+ *       benchmarks and tools.
  */
-static float process_biquad_cascade(biquad_filter_t filters[2], float input)
+fsp_err_t signal_processing_design_filters(eeg_biquad_cascade_t *cascade, uint32_t sample_rate_hz, uint32_t mains_hz)
 {
-    /* Process through first biquad */
-    float output1 = filters[0].b0 * input + filters[0].b1 * filters[0].x1 + filters[0].b2 * filters[0].x2
-                   - filters[0].a1 * filters[0].y1 - filters[0].a2 * filters[0].y2;
-
-    /* Update first biquad history */
-    filters[0].x2 = filters[0].x1;
-    filters[0].x1 = input;
-    filters[0].y2 = filters[0].y1;
-    filters[0].y1 = output1;
-
-    /* Process through second biquad */
-    float output2 = filters[1].b0 * output1 + filters[1].b1 * filters[1].x1 + filters[1].b2 * filters[1].x2
-                   - filters[1].a1 * filters[1].y1 - filters[1].a2 * filters[1].y2;
-
-    /* Update second biquad history */
-    filters[1].x2 = filters[1].x1;
-    filters[1].x1 = output1;
-    filters[1].y2 = filters[1].y1;
-    filters[1].y1 = output2;
-
-    return output2;
+    uint32_t table_mains_hz = mains_hz ? mains_hz : EEG_MAINS_HZ;   // Both tables share the sections before the band-stop
+
+    for (uint32_t t = 0; t < eeg_filter_table_count; t++) {
+        const eeg_filter_table_t *table = &eeg_filter_tables[t];
+        if ((table->sample_rate_hz != sample_rate_hz) || (table->mains_hz != table_mains_hz)) {
+            continue;
+        }
+        cascade->stages = mains_hz ? table->stages : (uint32_t) (table->stages - table->mains_stages);
+        for (uint32_t s = 0; s < cascade->stages; s++) {
+            eeg_biquad_set_stage(cascade, s, table->sos[s][0], table->sos[s][1], table->sos[s][2],
+                                 table->sos[s][3], table->sos[s][4]);
+        }
+        return FSP_SUCCESS;
+    }
+    return FSP_ERR_UNSUPPORTED;
 }
 
 /**
- * @brief Convert 24-bit ADC value to voltage in microvolts
+ * @brief Convert a ring value of channel @p ch to microvolts
+ * @note ADC1 values are 32-bit codes at PGA gain 1 (±2.5V), ADC2 values 24-bit
+ *       codes at gain 16 (±156.25mV) - see ads1263_montage_count_uv().
  */
-static float convert_adc_to_voltage(int32_t adc_value)
+static float convert_adc_to_voltage(int ch, int32_t adc_value)
 {
-    /* ADS1263 with 2.5V reference, PGA gain = 32, 24-bit resolution */
-    /* Full scale = ±2.5V / 32 = ±78.125mV */
-    /* LSB = 78125μV / 8388608 = 9.31μV per LSB */
-
-    return ((float)adc_value * 78125.0f) / 8388608.0f;
+    return (float) adc_value * processing_state.count_uv[ch];
 }
 
 /**
- * @brief Detect various types of artifacts in EEG signals
+ * @brief Apply additional signal conditioning to a filtered block
+ * @note Each sample is offered to its channel's baseline median before the
+ *       median is taken off it, so the result does not depend on the block length.
  */
-static bool detect_artifacts(float left_sample, float right_sample, float prev_left, float prev_right)
+static void apply_signal_conditioning(float samples[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES], uint32_t count)
 {
-    /* Check for amplitude saturation */
-    if (fabsf(left_sample) > AMPLITUDE_THRESHOLD_UV || fabsf(right_sample) > AMPLITUDE_THRESHOLD_UV)
+    /* Apply soft limiting to prevent excessive values */
+    const float soft_limit = 100.0f; // μV
+
+    for (int ch = 0; ch < EEG_CHANNELS; ch++)
     {
-        return true;
-    }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            /* Remove what drift and artifact offsets the highpass leaves */
+            (void) eeg_median_push(&processing_state.baseline[ch], samples[ch][i]);
+            float value = samples[ch][i] - eeg_median_value(&processing_state.baseline[ch]);
 
-    /* Check for excessive gradient (muscle artifacts, movement) */
-    float left_gradient = fabsf(left_sample - prev_left);
-    float right_gradient = fabsf(right_sample - prev_right);
+            if (value > soft_limit)
+                value = soft_limit + ((value - soft_limit) * 0.1f);
+            else if (value < -soft_limit)
+                value = -soft_limit + ((value + soft_limit) * 0.1f);
 
-    if (left_gradient > GRADIENT_THRESHOLD || right_gradient > GRADIENT_THRESHOLD)
-    {
-        return true;
+            samples[ch][i] = value;
+        }
     }
+}
 
-    /* Check for common-mode artifacts (both channels similar high amplitude) */
-    if (fabsf(left_sample) > 50.0f && fabsf(right_sample) > 50.0f)
-    {
-        float correlation = (left_sample * right_sample) / (fabsf(left_sample) * fabsf(right_sample));
-        if (correlation > 0.8f) // High correlation suggests common-mode noise
-        {
-            return true;
+/**
+ * @brief Filter samples straight out of the acquisition ring (zero-copy)
+ * @param max_samples Upper bound on samples consumed this call
+ * @param last Receives the last filtered value per channel (unchanged if none)
+ * @return Number of samples consumed and committed back to the ring
+ */
+static uint32_t process_ring_samples(uint32_t max_samples, float last[EEG_CHANNELS])
+{
+    static float block[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES];
+    static float decimated[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES];
+    static uint32_t excluded[EEG_FILTER_BLOCK_SAMPLES];
+    eeg_sample_span_t spans[2];
+    uint32_t total = eeg_buffer_peek_spans(spans, max_samples);
+
+    for (uint32_t s = 0; s < 2; s++) {
+        for (uint32_t i = 0; i < spans[s].count;) {
+            /* A rate switch takes effect on the first sample converted at the new rate */
+            uint32_t first = spans[s].first_index + i;
+            eeg_rate_t rate;
+            if (eeg_buffer_take_rate_switch(first, &rate)) {
+                signal_processing_set_rate(&rate);
+            }
+
+            /* Filter up to a block at once, ending it where a pending switch starts */
+            uint32_t count = spans[s].count - i;
+            uint32_t switch_index;
+            if (count > EEG_FILTER_BLOCK_SAMPLES) count = EEG_FILTER_BLOCK_SAMPLES;
+            if (eeg_buffer_peek_rate_switch(&switch_index) && (switch_index - first > 0U) &&
+                (switch_index - first < count)) {
+                count = switch_index - first;
+            }
+
+            const int32_t *counts[EEG_CHANNELS];
+            for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                counts[ch] = &spans[s].channel[ch][i];
+            }
+            process_eeg_block(counts, count, block);
+            i += count;
+
+            /* Down to the window rate; the window and its hop count window samples. Channels
+             * that were not EEG at acquisition (held, clipped) go along as flags, excluded in the window */
+            (void) eeg_decimate_flags(&processing_state.decimator, &spans[s].excluded[i - count], excluded, count);
+            uint32_t kept = eeg_decimate(&processing_state.decimator, block, decimated, EEG_CHANNELS, count);
+            for (uint32_t j = 0; j < kept; j++) {
+                float sample[EEG_CHANNELS];
+                for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                    sample[ch] = decimated[ch][j];
+                }
+                (void) push_window_sample(sample, excluded[j]);
+            }
+            for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+                last[ch] = block[ch][count - 1U];
+            }
         }
     }
 
-    return false;
+    /* Release the slots to the acquisition side only after filtering */
+    eeg_buffer_commit_read(total);
+
+    return total;
 }
 
 /**
- * @brief Update baseline estimates using adaptive filter
+ * @brief Filter everything the acquisition ring holds, a block at a time
+ * @note The acquisition side signals once per 64 conversions, so one wake
+ *       has to take all of them or the ring fills and drops new samples.
+ * @return Number of samples consumed
  */
-static void update_baseline(float left_sample, float right_sample)
+static uint32_t drain_ring_samples(float last[EEG_CHANNELS])
 {
-    /* Simple adaptive baseline with 0.99 forgetting factor */
-    const float alpha = 0.001f; // Adaptation rate
+    uint32_t total = 0;
+    uint32_t consumed;
 
-    processing_state.baseline_left = (1.0f - alpha) * processing_state.baseline_left + alpha * left_sample;
-    processing_state.baseline_right = (1.0f - alpha) * processing_state.baseline_right + alpha * right_sample;
+    while ((consumed = process_ring_samples(EEG_FILTER_BLOCK_SAMPLES, last)) > 0U) {
+        total += consumed;
+    }
+    return total;
 }
 
 /**
- * @brief Apply additional signal conditioning
+ * @brief One processing wake: filter what the ring holds, then advance the artifact history
+ * @param filtered Receives the last filtered value per channel (unchanged if none)
+ * @return Number of samples consumed; completed windows are in the ready mailbox
  */
-static void apply_signal_conditioning(float *left_sample, float *right_sample)
+uint32_t signal_processing_drain(float filtered[EEG_CHANNELS])
 {
-    /* Remove baseline drift */
-    *left_sample -= processing_state.baseline_left;
-    *right_sample -= processing_state.baseline_right;
-
-    /* Apply soft limiting to prevent excessive values */
-    const float soft_limit = 100.0f; // μV
+    uint32_t consumed = drain_ring_samples(filtered);
 
-    if (*left_sample > soft_limit)
-        *left_sample = soft_limit + ((*left_sample - soft_limit) * 0.1f);
-    else if (*left_sample < -soft_limit)
-        *left_sample = -soft_limit + ((*left_sample + soft_limit) * 0.1f);
+    rotate_artifact_history();
+    return consumed;
+}
 
-    if (*right_sample > soft_limit)
-        *right_sample = soft_limit + ((*right_sample - soft_limit) * 0.1f);
-    else if (*right_sample < -soft_limit)
-        *right_sample = -soft_limit + ((*right_sample + soft_limit) * 0.1f);
+/**
+ * @brief Start a new artifact history slot for each ARTIFACT_PERIOD_S boundary passed
+ * @note samples_processed moves by however many samples a wake drained, so
+ *       the boundary is tracked rather than hit exactly; a wake that spans
+ *       several periods clears a slot for each. Compared as a difference so
+ *       the counter wrapping does not stall it.
+ */
+static void rotate_artifact_history(void)
+{
+    while ((int32_t) (processing_state.samples_processed - processing_state.artifact_rotate_at) >= 0) {
+        processing_state.artifact_index++;
+        processing_state.artifact_count[processing_state.artifact_index % ARTIFACT_HISTORY_SIZE] = 0;
+        processing_state.artifact_rotate_at += ARTIFACT_PERIOD_S * processing_state.rate.sample_rate_hz;
+    }
 }
 
 /**
@@ -423,9 +490,8 @@ void process_eeg_samples_direct(void)
 
     // Static variables to maintain state between calls
     static bool processing_initialized_direct = false;
-    static eeg_raw_sample_t raw_samples[5];
     static uint32_t samples_read;
-    static float filtered_left, filtered_right;
+    static float filtered[EEG_CHANNELS];
 
     // Initialize signal processing if not already done
     if (!processing_initialized_direct) {
@@ -440,48 +506,22 @@ void process_eeg_samples_direct(void)
 
     printf("SHRAVYA: 📊 Getting EEG samples from buffer...\r\n");
 
-    /* Get latest samples from acquisition buffer */
-    if (eeg_get_samples(raw_samples, 5, &samples_read) == FSP_SUCCESS && samples_read > 0) {
+    /* Filter latest samples directly out of the acquisition ring */
+    uint32_t completed = processing_state.windows.completed;
+    samples_read = signal_processing_drain(filtered);
+    if (samples_read > 0) {
 
         printf("SHRAVYA: 🎛️ Signal Processing - Got %u samples\r\n", samples_read);
 
-        /* Process each sample through filtering pipeline */
-        for (uint32_t i = 0; i < samples_read; i++) {
-            // Process individual sample through complete pipeline
-            process_eeg_sample(&raw_samples[i], &filtered_left, &filtered_right);
-
-            /* Store in processing buffer */
-            processing_state.processing_buffer_left[processing_state.buffer_index] = filtered_left;
-            processing_state.processing_buffer_right[processing_state.buffer_index] = filtered_right;
-            processing_state.buffer_index++;
-        }
-
-        /* Process features - immediate processing for real-time response */
-        processing_state.buffer_ready = true;
-        printf("SHRAVYA: ✅ Processing %u samples - features ready\r\n", samples_read);
-
-        /* Reset buffer if it gets too full */
-        if (processing_state.buffer_index >= PROCESSING_WINDOW_SIZE) {
-            processing_state.buffer_index = OVERLAP_SIZE; // Reset with overlap
-
-            /* Move overlapped data to beginning of buffer */
-            memmove(processing_state.processing_buffer_left,
-                   &processing_state.processing_buffer_left[PROCESSING_WINDOW_SIZE - OVERLAP_SIZE],
-                   OVERLAP_SIZE * sizeof(float));
-            memmove(processing_state.processing_buffer_right,
-                   &processing_state.processing_buffer_right[PROCESSING_WINDOW_SIZE - OVERLAP_SIZE],
-                   OVERLAP_SIZE * sizeof(float));
+        /* Features only on a completed hop, never on a partial window */
+        if (processing_state.windows.completed != completed) {
+            printf("SHRAVYA: ✅ Processing %u samples - window ready\r\n", samples_read);
         }
 
-        /* Update artifact tracking */
-        if ((processing_state.samples_processed % 2500) == 0) { // Every 5 seconds
-            processing_state.artifact_index++;
-            processing_state.artifact_count[processing_state.artifact_index % ARTIFACT_HISTORY_SIZE] = 0;
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            printf("SHRAVYA: 📊 Processed sample: channel %d = %.2f μV\r\n", ch, filtered[ch]);
         }
 
-        printf("SHRAVYA: 📊 Processed samples: Left=%.2f μV, Right=%.2f μV\r\n",
-               filtered_left, filtered_right);
-
         // Optional: Trigger feature extraction directly if needed
         // You can add feature extraction logic here or call it directly
 
@@ -496,62 +536,115 @@ void process_eeg_samples_direct(void)
 
 
 /**
- * @brief Process single EEG sample through complete pipeline
+ * @brief Add one window-rate sample; flag, repair and denoise the window it completes, then post it
+ * @param excluded Channels (bit n = channel n) that were not EEG when this sample was acquired
+ * @return true when a window was posted
  */
-void process_eeg_sample(const eeg_raw_sample_t *raw_sample, float *filtered_left, float *filtered_right)
+static bool push_window_sample(const float sample[EEG_CHANNELS], uint32_t excluded)
 {
-    static float prev_left = 0.0f, prev_right = 0.0f;
-
-    /* Convert ADC values to microvolts */
-    float left_uv = convert_adc_to_voltage(raw_sample->left_channel);
-    float right_uv = convert_adc_to_voltage(raw_sample->right_channel);
-
-    /* Artifact detection */
-    bool artifact_detected = detect_artifacts(left_uv, right_uv, prev_left, prev_right);
-
-    if (artifact_detected)
-    {
-        /* Replace with interpolated values or zeros */
-        left_uv = prev_left * 0.9f; // Simple interpolation
-        right_uv = prev_right * 0.9f;
-
-        /* Update artifact counter */
-        processing_state.artifact_count[processing_state.artifact_index % ARTIFACT_HISTORY_SIZE]++;
+    uint8_t mask[EEG_CHANNELS];
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        mask[ch] = (excluded & (1U << ch)) ? EEG_ARTIFACT_EXCLUDED : 0U;
     }
+    eeg_window_t *window = eeg_window_push(&processing_state.windows, sample, mask);
+    if (!window) return false;
+
+    /* Count each flagged sample once: only the hop this window added is new */
+    uint32_t fresh = (0U == processing_state.windows.completed) ? window->rate.window_samples
+                                                                 : window->rate.hop_samples;
+    processing_state.artifact_count[processing_state.artifact_index % ARTIFACT_HISTORY_SIZE] +=
+        eeg_artifact_process(&processing_state.artifacts, window, fresh);
+
+    /* Wavelet stage on the repaired samples, so no artifact sets the noise estimate */
+    window->wavelet_levels = 0;
+#if EEG_WAVELET_DENOISE || EEG_WAVELET_BAND_POWER
+    if (0U != processing_state.wavelet.levels) {
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            (void) eeg_wavelet_process(&processing_state.wavelet, window->channel[ch], window->wavelet_energy[ch],
+                                       EEG_WAVELET_DENOISE);
+        }
+        window->wavelet_levels = processing_state.wavelet.levels;
+    }
+#endif
+    eeg_window_post(&processing_state.windows, window);
+    return true;
+}
 
-    /* Update baseline estimates */
-    update_baseline(left_uv, right_uv);
-
-    /* Apply digital filtering pipeline */
+/**
+ * @brief Process a block of raw ADC counts (counts[ch][i], one pointer per montage channel)
+ * @param count 1..EEG_FILTER_BLOCK_SAMPLES samples, all at the configured rate
+ * @param filtered Receives filtered[ch][i]
+ * @note Conversion and mains detection run sample by sample on the input
+ *       (artifacts are flagged and repaired per window, push_window_sample());
+ *       the filter cascade then runs once per channel group over the whole
+ *       block (eeg_biquad_lanes_process, all channels of a group in lockstep;
+ *       with EEG_FILTER_Q31, eeg_biquad_q31_process per channel on the counts),
+ *       and conditioning takes each filtered sample's running-median baseline
+ *       off it as it was at that sample, so the result does not depend on the
+ *       block length.
+ */
+static void process_eeg_block(const int32_t *const counts[EEG_CHANNELS], uint32_t count,
+                              float filtered[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES])
+{
+#if EEG_FILTER_Q31
+    static int32_t q31[EEG_CHANNELS][EEG_FILTER_BLOCK_SAMPLES];
+#else
+    static float frames[EEG_FILTER_GROUPS][EEG_FILTER_BLOCK_SAMPLES * EEG_FILTER_LANES];  // Unused lanes stay 0
+#endif
 
-    /* Step 1: DC blocking (highpass 0.5Hz) */
-    left_uv = process_biquad_cascade(processing_state.left_filters.highpass, left_uv);
-    right_uv = process_biquad_cascade(processing_state.right_filters.highpass, right_uv);
+    for (uint32_t i = 0; i < count; i++) {
+        float uv[EEG_CHANNELS];
+        int32_t raw[EEG_CHANNELS];
 
-    /* Step 2: 50Hz notch filter */
-    left_uv = process_biquad_cascade(processing_state.left_filters.notch_50hz, left_uv);
-    right_uv = process_biquad_cascade(processing_state.right_filters.notch_50hz, right_uv);
+        /* Convert ADC values to microvolts */
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+            raw[ch] = counts[ch][i];
+            uv[ch] = convert_adc_to_voltage(ch, raw[ch]);
+        }
 
-    /* Step 3: 60Hz notch filter */
-    left_uv = process_biquad_cascade(processing_state.left_filters.notch_60hz, left_uv);
-    right_uv = process_biquad_cascade(processing_state.right_filters.notch_60hz, right_uv);
+        /* Listen for the local mains frequency on the input */
+        if (0U == processing_state.mains_hz) {
+            uint32_t mains_hz = eeg_mains_detect(&processing_state.mains_detector, uv);
+            if (0U != mains_hz) {
+                start_mains_canceller(mains_hz);
+            }
+        }
 
-    /* Step 4: Anti-aliasing lowpass (45Hz) */
-    left_uv = process_biquad_cascade(processing_state.left_filters.lowpass, left_uv);
-    right_uv = process_biquad_cascade(processing_state.right_filters.lowpass, right_uv);
+        for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+#if EEG_FILTER_Q31
+            q31[ch][i] = (int32_t) ((uint32_t) raw[ch] << processing_state.q31_shift[ch]);
+#else
+            frames[ch / EEG_FILTER_LANES][i * EEG_FILTER_LANES + (uint32_t) (ch % EEG_FILTER_LANES)] = uv[ch];
+#endif
+        }
+    }
 
-    /* Step 5: Final signal conditioning */
-    apply_signal_conditioning(&left_uv, &right_uv);
+    /* Digital filtering pipeline: highpass 0.5Hz -> lowpass 45Hz (-> mains band-stop until detection) */
+#if EEG_FILTER_Q31
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        eeg_biquad_q31_process(&processing_state.filters[ch], q31[ch], filtered[ch], count);
+    }
+#else
+    for (int g = 0; g < EEG_FILTER_GROUPS; g++) {
+        eeg_biquad_lanes_process(&processing_state.filters[g], frames[g], frames[g], count);
+    }
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        const float *lane = &frames[ch / EEG_FILTER_LANES][ch % EEG_FILTER_LANES];
+        for (uint32_t i = 0; i < count; i++) {
+            filtered[ch][i] = lane[i * EEG_FILTER_LANES];
+        }
+    }
+#endif
 
-    /* Store results */
-    *filtered_left = left_uv;
-    *filtered_right = right_uv;
+    /* Mains fundamental and harmonics, once detection has handed over from the band-stop */
+    if (0U != processing_state.mains_hz) {
+        eeg_mains_cancel(&processing_state.mains_canceller, filtered, EEG_CHANNELS, count);
+    }
 
-    /* Update previous values */
-    prev_left = left_uv;
-    prev_right = right_uv;
+    /* Final signal conditioning */
+    apply_signal_conditioning(filtered, count);
 
-    processing_state.samples_processed++;
+    processing_state.samples_processed += count;
 }
 
 /**
@@ -560,14 +653,10 @@ void process_eeg_sample(const eeg_raw_sample_t *raw_sample, float *filtered_left
  */
 void task_signal_processing_entry(INT stacd, void *exinf)
 {
-    printf("SHRAVYA: 🚨 Signal processing task STARTED!\r\n");
-        printf("SHRAVYA: 🚨 About to enter main loop!\r\n");
     (void)stacd;
     (void)exinf;
 
-    eeg_raw_sample_t raw_samples[5]; // Process 10 samples at once (from 500Hz to 50Hz)
-    uint32_t samples_read;
-    float filtered_left, filtered_right;
+    float filtered[EEG_CHANNELS];
     ER ercd;
 
     /* Initialize signal processing */
@@ -585,20 +674,7 @@ void task_signal_processing_entry(INT stacd, void *exinf)
 
     while(1)
     {
-        printf("SHRAVYA: 🎛️ Waiting for preprocessing semaphore...\r\n");
-        printf("SHRAVYA: 🔍 DEBUG - Signal Processing Semaphore ID = %d\r\n", preprocessing_semaphore);
         ercd = tk_wai_sem(preprocessing_semaphore);
-        printf("SHRAVYA: 🔍 DEBUG - tk_wai_sem returned: %d\r\n", ercd);
-
-        // MODIFIED: Better debug output
-        if (ercd == E_OK) {
-            printf("SHRAVYA: Signal Processing - Semaphore received! Result: %d\n", ercd);
-        } else if (ercd == E_TMOUT) {
-            printf("SHRAVYA: Signal Processing - Semaphore TIMEOUT! Result: %d\n", ercd);
-        } else {
-            printf("SHRAVYA: Signal Processing - Semaphore ERROR! Result: %d\n", ercd);
-        }
-
         if (ercd != E_OK) {
             printf("SHRAVYA: Signal Processing - Semaphore failed: %d\n", ercd);
             // ✅ YIELD to higher priority tasks (like EEG)
@@ -609,77 +685,9 @@ void task_signal_processing_entry(INT stacd, void *exinf)
             continue;
         }
 
-        printf("SHRAVYA: Signal Processing - Starting processing...\n");
-
-        /* Get latest samples from acquisition buffer */
-        if (eeg_get_samples(raw_samples, 5, &samples_read) == FSP_SUCCESS && samples_read > 0)
-        {
-            // ✅ FIXED: Print AFTER getting samples_read value
-            printf("SHRAVYA: 🎛️ Signal Processing - Got %u samples\r\n", samples_read);
-
-            /* Process each sample through filtering pipeline */
-            for (uint32_t i = 0; i < samples_read; i++)
-            {
-                process_eeg_sample(&raw_samples[i], &filtered_left, &filtered_right);
-
-                /* Store in processing buffer */
-                processing_state.processing_buffer_left[processing_state.buffer_index] = filtered_left;
-                processing_state.processing_buffer_right[processing_state.buffer_index] = filtered_right;
-
-                processing_state.buffer_index++;
-
-                /* ALWAYS process features - immediate processing for real-time response */
-                if (true)  // Process every batch of 5 samples
-                {
-                    processing_state.buffer_ready = true;
-                    printf("SHRAVYA: ✅ Processing 5 samples - triggering features immediately\r\n");
-
-                    /* Reset buffer if it gets too full */
-                    if (processing_state.buffer_index >= PROCESSING_WINDOW_SIZE) {
-                        processing_state.buffer_index = OVERLAP_SIZE; // Reset with overlap
-
-                        /* Move overlapped data to beginning of buffer */
-                        memmove(processing_state.processing_buffer_left,
-                               &processing_state.processing_buffer_left[PROCESSING_WINDOW_SIZE - OVERLAP_SIZE],
-                               OVERLAP_SIZE * sizeof(float));
-                        memmove(processing_state.processing_buffer_right,
-                               &processing_state.processing_buffer_right[PROCESSING_WINDOW_SIZE - OVERLAP_SIZE],
-                               OVERLAP_SIZE * sizeof(float));
-                    }
-                }
-            }
-
-        }
-        else
-        {
-            // ✅ ADDED: Debug log when no samples available
-            printf("SHRAVYA: ⚠️ No EEG samples available\r\n");
-        }
-
-        /* Update artifact tracking */
-        /* Update artifact tracking */
-        if ((processing_state.samples_processed % 2500) == 0) // Every 5 seconds
-        {
-            processing_state.artifact_index++;
-            processing_state.artifact_count[processing_state.artifact_index % ARTIFACT_HISTORY_SIZE] = 0;
-        }
-
-        /* ALWAYS trigger feature extraction after processing samples */
-        printf("SHRAVYA: 📊 Signaling feature extraction...\r\n");
-        tk_sig_sem(feature_extraction_semaphore, 1);
-
-        /* WAIT for feature extraction to complete */
-        printf("SHRAVYA: ⏳ Waiting for feature extraction to complete...\r\n");
-        ER feat_wait = tk_wai_sem(features_ready_semaphore);
-        if (feat_wait == E_OK) {
-            printf("SHRAVYA: ✅ Feature extraction completed\r\n");
-        } else {
-            printf("SHRAVYA: ⚠️ Feature extraction wait failed: %d\r\n", feat_wait);
-        }
-
-        // ADDED: Processing cycle completion debug
-        tk_sig_sem(processed_semaphore, 1);
-        printf("SHRAVYA: ✅ Signal Processing cycle complete\r\n");
+        /* Filter latest samples directly out of the acquisition ring; completed
+         * windows go straight to the ready mailbox, feature extraction picks them up */
+        (void) signal_processing_drain(filtered);
     }
 }
 
@@ -691,34 +699,46 @@ void extract_eeg_features_direct(void)
     printf("SHRAVYA: 🧠🧠🧠 FEATURE EXTRACTION CALLED DIRECTLY! 🧠🧠🧠\r\n");
     printf("SHRAVYA: 🔬 Extracting advanced cognitive features...\r\n");
 
-    // Get processed signal buffers
-    float *left_buffer, *right_buffer;
-    uint32_t buffer_size;
+    // Take the newest completed window; older ones go straight back
+    const float *channel_buffers[EEG_CHANNELS];
+    eeg_window_t *window = signal_processing_receive_window(TMO_POL);
+    eeg_window_t *newer;
 
-    if (signal_processing_get_buffer(&left_buffer, &right_buffer, &buffer_size) != FSP_SUCCESS) {
+    if (!window) {
         printf("SHRAVYA: ⚠️ Signal processing buffer not ready for feature extraction\r\n");
         return;
     }
+    while ((newer = signal_processing_receive_window(TMO_POL)) != NULL) {
+        signal_processing_release_window(window);
+        window = newer;
+    }
+    for (int ch = 0; ch < EEG_CHANNELS; ch++) {
+        channel_buffers[ch] = window->channel[ch];
+    }
+    uint32_t buffer_size = window->rate.window_samples;
 
     printf("SHRAVYA: 📊 Processing %u samples from signal buffer\r\n", buffer_size);
 
     /* ✅ EXACT LOGIC FROM YOUR COGNITIVE CLASSIFIER */
 
     // 1. Extract frequency domain features (FFT analysis)
-    extract_frequency_features(left_buffer, right_buffer, (int)buffer_size);
+    extract_frequency_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
+    extract_wavelet_band_features(window->wavelet_energy, EEG_CHANNELS, (int)window->wavelet_levels);
     printf("SHRAVYA: ⚡ Frequency features extracted\r\n");
 
     // 2. Extract time domain features (statistical analysis)
-    extract_time_domain_features(left_buffer, right_buffer, (int)buffer_size);
+    extract_time_domain_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
     printf("SHRAVYA: ⏱️ Time domain features extracted\r\n");
 
     // 3. Extract coherence features (inter-channel analysis)
-    extract_coherence_features(left_buffer, right_buffer, (int)buffer_size);
+    extract_coherence_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size);
     printf("SHRAVYA: 🔗 Coherence features extracted\r\n");
 
     // 4. Extract quality features (signal integrity)
-    extract_quality_features(left_buffer, right_buffer, (int)buffer_size);
+    extract_quality_features((const float *const *)channel_buffers, EEG_CHANNELS, (int)buffer_size,
+                             window->artifact_ratio);
     printf("SHRAVYA: 🎛️ Quality features extracted\r\n");
+    signal_processing_release_window(window);
 
     // ✅ EXACT OUTPUT FROM YOUR CLASSIFIER
     float focus_score = (current_features.beta_power > 0.000001f) ?
@@ -829,8 +849,8 @@ void send_to_n8n_direct(cognitive_classification_t classification_result)
 
     // Signal quality
     payload.signal_quality.snr_db = current_features.snr_estimate;
-    payload.signal_quality.artifact_detected = (current_features.signal_stability < 0.7f);
-    payload.sampling_rate = 1000; // 1000 Hz from ADS1263
+    payload.signal_quality.artifact_detected = (current_features.artifact_ratio > EEG_ARTIFACT_MAX_RATIO);
+    payload.sampling_rate = processing_state.rate.sample_rate_hz;
 
     // Build JSON and send using your existing functions
     char json_buffer[2048];
@@ -851,7 +871,6 @@ void send_to_n8n_direct(cognitive_classification_t classification_result)
 }
 
 
-/*
 /**
  * @brief Get processing statistics
  */
@@ -869,19 +888,35 @@ void signal_processing_get_stats(uint32_t *samples_processed, uint32_t *total_ar
         *total_artifacts = total;
     }
 
-    if (is_ready) *is_ready = processing_state.buffer_ready && processing_initialized;
+    if (is_ready) *is_ready = (processing_state.windows.completed > 0U) && processing_initialized;
 }
 
 /**
- * @brief Get filtered signal buffer for feature extraction
+ * @brief Take the oldest completed feature window at the current rate
+ * @param tmout TMO_POL, TMO_FEVR or a timeout in ms (μT-Kernel)
+ * @return The window - read-only, owned by the caller until
+ *         signal_processing_release_window() - or NULL on timeout
+ * @note Windows completed before a rate switch are released unseen: their
+ *       length and bin spacing no longer match the feature tables.
  */
-fsp_err_t signal_processing_get_buffer(float **left_buffer, float **right_buffer, uint32_t *buffer_size)
+eeg_window_t *signal_processing_receive_window(INT tmout)
 {
-    if (!processing_state.buffer_ready) return FSP_ERR_NOT_READY;
+    eeg_window_t *window;
 
-    if (left_buffer) *left_buffer = processing_state.processing_buffer_left;
-    if (right_buffer) *right_buffer = processing_state.processing_buffer_right;
-    if (buffer_size) *buffer_size = PROCESSING_WINDOW_SIZE;
+    while ((window = eeg_window_receive(&processing_state.windows, tmout)) != NULL) {
+        if ((window->rate.window_samples == processing_state.rate.window_samples) &&
+            (window->rate.window_rate_hz == processing_state.rate.window_rate_hz)) {
+            break;
+        }
+        eeg_window_release(&processing_state.windows, window);
+    }
+    return window;
+}
 
-    return FSP_SUCCESS;
+/**
+ * @brief Hand a window from signal_processing_receive_window() back for refilling
+ */
+void signal_processing_release_window(eeg_window_t *window)
+{
+    eeg_window_release(&processing_state.windows, window);
 }